@@ -3,6 +3,7 @@ from python.kws import generate_kws
 from python.spectrogram import generate_spectrogram
 from python.camera_test import generate_camera_test
 from python.generate import generate_common_files
+from python.partition import with_partitions
 
 APPS = {'appa':generate_kws, 
     'appb':generate_spectrogram,
@@ -18,6 +19,8 @@ subparsers = parser.add_subparsers(dest="command",required=True,help='subcommand
 parser_gen = subparsers.add_parser('gen', help='Regenerate an application')
 parser_gen.add_argument("--all", help="Regenerate all applications", action='store_true')
 parser_gen.add_argument("--size", help="Code size optimization enabled", action='store_true')
+parser_gen.add_argument("--unroll", help="Unroll the schedules (faster, bigger code)", action='store_true')
+parser_gen.add_argument("--static", help="Static allocation of the FIFOs and nodes", action='store_true')
 parser_gen.add_argument('apps', nargs="*",choices=APPS, help='Application to regenerate')
 
 parser_flash = subparsers.add_parser('flash',help='Regenerate flash memory content')
@@ -39,12 +42,14 @@ apps = sorted(args.apps)
 for app in apps:
     f = APPS[app]
     print(f"=== Generating {app}...")
-    f(codeSizeOptimization=args.size)
+    f(codeSizeOptimization=args.size,unroll=args.unroll,staticAlloc=args.static)
     print("")
 if args.size:
     print("Regenerating all common files for code size optimization...")
-    print(ALL_APPS)
-    generate_common_files(all_apps=ALL_APPS)
+    # The partitions of a graph are graphs with their own templates
+    all_graphs = with_partitions(ALL_APPS)
+    print(all_graphs)
+    generate_common_files(all_apps=all_graphs)
 
 
 
@@ -3,12 +3,13 @@ from cmsis_stream.cg.scheduler import GenericNode
 from ..nodes.NodeTypes import F32_SCALAR
 
 class Mixer(GenericNode):
-    def __init__(self,name,outLength):
+    # theType : F32_SCALAR, Q15_SCALAR or F32_STEREO
+    def __init__(self,name,outLength,theType=F32_SCALAR):
         GenericNode.__init__(self,name,identified=False)
-        self.addInput("inl",F32_SCALAR,outLength)
-        self.addInput("inr",F32_SCALAR,outLength)
-        self.addOutput("oul",F32_SCALAR,outLength)
-        self.addOutput("our",F32_SCALAR,outLength)
+        self.addInput("inl",theType,outLength)
+        self.addInput("inr",theType,outLength)
+        self.addOutput("oul",theType,outLength)
+        self.addOutput("our",theType,outLength)
 
     @property
     def typeName(self):
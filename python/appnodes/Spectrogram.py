@@ -2,9 +2,10 @@ from cmsis_stream.cg.scheduler import GenericSink
 
 from ..nodes.NodeTypes import F32_COMPLEX
 class Spectrogram(GenericSink):
-    def __init__(self,name,nbSamples):
+    # theType : F32_COMPLEX, Q15_COMPLEX or Q31_COMPLEX
+    def __init__(self,name,nbSamples,theType=F32_COMPLEX):
         GenericSink.__init__(self,name,identified=False)
-        self.addInput("i",F32_COMPLEX,nbSamples)
+        self.addInput("i",theType,nbSamples)
         self.addEventOutput()
 
     @property
@@ -6,13 +6,29 @@ from .appnodes import *
 
 from .generate import generate
 
-def generate_camera_test(codeSizeOptimization=False):
+# Video source used by the demo:
+# debug  : synthetic frames
+# camera : Alif camera
+# file   : raw RGB565 frames read from a file (host testing)
+VIDEO_FILE = "/lfs/frames.rgb565"
+
+def generate_camera_test(codeSizeOptimization=False,source="debug",unroll=False,staticAlloc=False):
     the_graph = Graph()
     
-    src = ZephyrDebugVideoSource("video")
+    if source == "camera":
+        src = ZephyrVideoSource("video")
+    elif source == "file":
+        src = ZephyrFileVideoSource("video",VIDEO_FILE,480,272)
+    else:
+        src = ZephyrDebugVideoSource("video")
+    mailbox = FrameMailbox("mailbox")
     gain = CameraFrame("lcd")
     
-    the_graph.connect(src["oev0"],gain["iev0"])
+    # The mailbox keeps only the most recent frame when
+    # the display is slower than the video source
+    the_graph.connect(src["oev0"],mailbox["iev0"])
+    the_graph.connect(mailbox["oev0"],gain["iev0"])
+    the_graph.connect(gain["oev0"],mailbox["iev1"])
     
     class MyStyle(Style):
         
@@ -30,7 +46,7 @@ def generate_camera_test(codeSizeOptimization=False):
                     return("orange")
                 return(super().edge_color(edge))
     
-    generate("appc",the_graph,MyStyle(),codeSizeOptimization=codeSizeOptimization)
+    generate("appc",the_graph,MyStyle(),codeSizeOptimization=codeSizeOptimization,unroll=unroll,staticAlloc=staticAlloc)
 
 if __name__ == "__main__":
     import argparse
@@ -38,9 +54,12 @@ if __name__ == "__main__":
                     prog='kws',
                     description='Regenerate kws demo')
     parser.add_argument("--size", help="Code size optimization enabled", action='store_true')
+    parser.add_argument("--unroll", help="Unroll the schedule (faster, bigger code)", action='store_true')
+    parser.add_argument("--static", help="Static allocation of the FIFOs and nodes", action='store_true')
+    parser.add_argument("--source", help="Video source", choices=["debug","camera","file"], default="debug")
     args = parser.parse_args()
 
-    generate_camera_test(codeSizeOptimization=args.size)
+    generate_camera_test(codeSizeOptimization=args.size,source=args.source,unroll=args.unroll,staticAlloc=args.static)
     if args.size:
         print("KWS demo generated with code size optimization")
         print("You need to call the generate script to regenerate the common files")
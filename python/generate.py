@@ -8,6 +8,8 @@ from cmsis_stream.cg.scheduler.graphviz import Style
 import argparse 
 import json
 
+from .postprocess import fifo_overlay, generate_fifo_overlay, arena_allocation, unroll_schedule, static_allocation, sliding_fifo_buffers
+
 
 
 # Used to know the name of the json file containing template definitions required by an app
@@ -15,7 +17,13 @@ def template_json_file_name(app):
     return f"src/streamgraph/{app}/json/scheduler_{app}_template.json"
 
 # Used by network generation scripts to generate the scheduler and related files for an app
-def generate(app,the_graph,myStyle,codeSizeOptimization=False):
+# paramsType : name of the parameter struct when it is not derived from the app name
+# (partitions of a graph share the parameters of the graph)
+# unroll : the schedule is generated as a sequence of run() calls instead of
+# a loop over the schedule table (faster but bigger for long schedules)
+# staticAlloc : FIFOs and nodes are constructed in static storage instead of
+# the arena (no allocation at init)
+def generate(app,the_graph,myStyle,codeSizeOptimization=False,fifoOverlay=True,arena=True,paramsType=None,unroll=False,staticAlloc=False):
     conf = Configuration()
     conf.CMSISDSP = False
     conf.asynchronous = False
@@ -31,7 +39,9 @@ def generate(app,the_graph,myStyle,codeSizeOptimization=False):
     # This app config should be used only to inject code before schedule or node execution.
     # It should not customize node implementations.
     conf.appConfigCName = f"app_config.hpp"
-    conf.cOptionalInitArgs = [f"{app.capitalize()}Params *params"]
+    if paramsType is None:
+        paramsType = f"{app.capitalize()}Params"
+    conf.cOptionalInitArgs = [f"{paramsType} *params","struct stream_arena *arena"]
     conf.appNodesCName = f"AppNodes_{app}.hpp"
     ext_template_filename = f"src/streamgraph/{app}/{app}_extern_templates.hpp"
     # Post custom headers to include external template declarations
@@ -56,6 +66,20 @@ def generate(app,the_graph,myStyle,codeSizeOptimization=False):
     
     # Generate JSON files that may be used by other tools
     scheduling.ccode(f"src/streamgraph/{app}",conf)
+    # SlidingFIFO buffers are not shared with the other FIFOs
+    sliding_fifo_buffers(app)
+    # FIFO buffers are placed in a memory region shared by all graphs
+    # when CONFIG_STREAM_FIFO_OVERLAY is enabled
+    if fifoOverlay:
+        fifo_overlay(app)
+    # FIFOs and nodes are allocated from a per graph arena
+    # or from static storage
+    if staticAlloc:
+        static_allocation(app)
+    elif arena:
+        arena_allocation(app)
+    if unroll:
+        unroll_schedule(app)
     scheduling.genJsonIdentification(f"src/streamgraph/{app}/json",conf)
     scheduling.genJsonSelectorsInit(f"src/streamgraph/{app}/json",conf)
     
@@ -255,6 +279,9 @@ if __name__ == "__main__":
 
 
     args = parser.parse_args()
+    # The partitions of a graph (partition.py) are listed with their graph
+    from .partition import with_partitions
     print("Generate template definition files")
-    print(args.apps)
-    generate_common_files(args.apps)
\ No newline at end of file
+    print(with_partitions(args.apps))
+    generate_common_files(with_partitions(args.apps))
+    generate_fifo_overlay(args.apps)
\ No newline at end of file
@@ -6,7 +6,14 @@ from .appnodes import *
 
 from .generate import generate
 
-def generate_kws(codeSizeOptimization=False ):
+# denoise : noise suppression of the microphone signal before the MFCC
+# beamform : both microphones are combined by a beamformer instead of
+# discarding the right one. It is off by default and the committed appa
+# is generated without it: the KWS model was trained on single microphone
+# recordings and the accuracy with the beamformed signal has not been
+# measured on the boards yet.
+# agc : automatic gain control before the MFCC (settings in appaParams.agc)
+def generate_kws(codeSizeOptimization=False,unroll=False,staticAlloc=False,denoise=False,beamform=False,agc=False):
     the_graph = Graph()
     
     SAMPLING_FREQ_HZ = 16000
@@ -31,7 +38,6 @@ def generate_kws(codeSizeOptimization=False ):
     src = ZephyrAudioSource("audioSource",NB)
     gain = Gain("gain",Q15_STEREO,NB,10)
     
-    deinterleave = DeinterleaveStereo("deinterleave",Q15_STEREO,NB)
     to_f32 = Convert("to_f32",Q15_SCALAR,F32_SCALAR,NB)
     
     audioWin=SlidingBuffer("audioWin",CType(F32),NB_WINDOW_SAMPLES,NB_OVERLAP_SAMPLES)
@@ -46,19 +52,37 @@ def generate_kws(codeSizeOptimization=False ):
     
     classify = KWSClassify("classify")
     
-    nullRight = NullSink("nullRight",Q15_SCALAR,NB)
-    
-    
     #the_graph.connect(src.o,gain.i)
     #the_graph.connect(gain.o,deinterleave.i)
     
-    the_graph.connect(src.o,deinterleave.i)
-    the_graph.connect(deinterleave.l,to_f32.i)
-    the_graph.connect(to_f32.o,audioWin.i)
+    if beamform:
+        beamformer = Beamformer("beamformer",NB)
+        the_graph.connect(src.o,beamformer.i)
+        the_graph.connect(beamformer.o,to_f32.i)
+    else:
+        deinterleave = DeinterleaveStereo("deinterleave",Q15_STEREO,NB)
+        nullRight = NullSink("nullRight",Q15_SCALAR,NB)
+        the_graph.connect(src.o,deinterleave.i)
+        the_graph.connect(deinterleave.l,to_f32.i)
+        the_graph.connect(deinterleave.r,nullRight.i)
+    audio = to_f32.o
+    if agc:
+        agcNode = AGC("agc",F32_SCALAR,NB)
+        the_graph.connect(audio,agcNode.i)
+        audio = agcNode.o
+    if denoise:
+        # Analysis on 2 audio blocks with 50% overlap: 20 ms of latency
+        stft = STFT("stft",NB,2*NB,"SqrtHann")
+        noiseSuppress = NoiseSuppress("noiseSuppress",2*NB)
+        istft = ISTFT("istft",NB,2*NB,"SqrtHann")
+        the_graph.connect(audio,stft.i)
+        the_graph.connect(stft.o,noiseSuppress.i)
+        the_graph.connect(noiseSuppress.o,istft.i)
+        audio = istft.o
+    the_graph.connect(audio,audioWin.i)
     the_graph.connect(audioWin.o,mfcc.i)
     the_graph.connect(mfcc.o,mfccWin.i)
     the_graph.connect(mfccWin.o,send.i)
-    the_graph.connect(deinterleave.r,nullRight.i)
     
     the_graph.connect(send["oev0"],kws["iev0"])
     the_graph.connect(kws["oev0"],send["iev0"])
@@ -85,7 +109,7 @@ def generate_kws(codeSizeOptimization=False ):
     myStyle = MyStyle()
     
     
-    generate("appa",the_graph,myStyle,codeSizeOptimization=codeSizeOptimization)
+    generate("appa",the_graph,myStyle,codeSizeOptimization=codeSizeOptimization,unroll=unroll,staticAlloc=staticAlloc)
 
 if __name__ == "__main__":
     import argparse
@@ -93,9 +117,14 @@ if __name__ == "__main__":
                     prog='kws',
                     description='Regenerate kws demo')
     parser.add_argument("--size", help="Code size optimization enabled", action='store_true')
+    parser.add_argument("--unroll", help="Unroll the schedule (faster, bigger code)", action='store_true')
+    parser.add_argument("--static", help="Static allocation of the FIFOs and nodes", action='store_true')
+    parser.add_argument("--denoise", help="Noise suppression before the MFCC", action='store_true')
+    parser.add_argument("--beamform", help="Beamforming of the two microphones", action='store_true')
+    parser.add_argument("--agc", help="Automatic gain control before the MFCC", action='store_true')
     args = parser.parse_args()
 
-    generate_kws(codeSizeOptimization=args.size)
+    generate_kws(codeSizeOptimization=args.size,unroll=args.unroll,staticAlloc=args.static,denoise=args.denoise,beamform=args.beamform,agc=args.agc)
     if args.size:
         print("KWS demo generated with code size optimization")
         print("You need to call the generate script to regenerate the common files")
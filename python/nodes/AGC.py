@@ -0,0 +1,23 @@
+from cmsis_stream.cg.scheduler import GenericNode
+from .NodeTypes import *
+
+# Automatic gain control / compressor with a gain computed per block.
+# theType : Q15_SCALAR or F32_SCALAR
+# The settings are in the params->name structure (agcParams) and
+# can be changed while the graph is running.
+class AGC(GenericNode):
+    def __init__(self,name,theType,ioLength):
+        GenericNode.__init__(self,name,identified=False)
+        self.addInput("i",theType,ioLength)
+        self.addOutput("o",theType,ioLength)
+        self.addVariableArg(f"params->{name}")
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "AGC"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
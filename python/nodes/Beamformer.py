@@ -0,0 +1,31 @@
+from cmsis_stream.cg.scheduler import GenericNode
+from .NodeTypes import *
+
+# Delay and sum beamformer of the stereo microphones (Q15).
+# delay : delay of the right channel relative to the left one in samples
+# (fractional) when adaptive is False. Initial delay otherwise.
+# maxDelay : maximum delay (at most 4 samples). It is the mic spacing
+# divided by the speed of sound times the sampling frequency.
+# adaptive : the delay is estimated from the cross correlation of the
+# channels.
+# The output is delayed by 7.5 samples.
+# The node is identified so that resume() clears the FIR states and the
+# delay estimate after a pause.
+class Beamformer(GenericNode):
+    def __init__(self,name,ioLength,delay=0.0,maxDelay=2.0,adaptive=True):
+        GenericNode.__init__(self,name,identified=True)
+        self.addInput("i",Q15_STEREO,ioLength)
+        self.addOutput("o",Q15_SCALAR,ioLength)
+        self.addLiteralArg(float(delay))
+        self.addLiteralArg(float(maxDelay))
+        self.addLiteralArg(1 if adaptive else 0)
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "Beamformer"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
@@ -7,6 +7,9 @@ class CameraFrame(ZephyrLCD):
     def __init__(self,name):
         ZephyrLCD.__init__(self,name)
         self.addEventInput(1)
+        # Request for a new frame sent once the
+        # current frame has been rendered
+        self.addEventOutput(1)
 
 
     @property
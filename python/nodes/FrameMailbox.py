@@ -0,0 +1,23 @@
+from cmsis_stream.cg.scheduler import GenericSink
+
+# Latest frame wins mailbox between a video source and a slow consumer.
+# Event input 0 receives the frames.
+# Event input 1 receives the requests for a new frame from the consumer.
+# At most nbSlots frames are kept. Older frames are released and
+# counted as dropped.
+class FrameMailbox(GenericSink):
+    def __init__(self,name,nbSlots=1):
+        GenericSink.__init__(self,name,identified=True)
+        self.addEventInput(2)
+        self.addEventOutput(1)
+        self.addLiteralArg(nbSlots)
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "FrameMailbox"
@@ -6,11 +6,11 @@ def _is_power_of_two(n: int) -> bool:
     return n > 0 and (n & (n - 1)) == 0
 
 class Hanning(GenericNode):
-    def __init__(self,name,inLength,outLength):
+    def __init__(self,name,inLength,outLength,theType=F32_SCALAR):
         GenericNode.__init__(self,name,identified=False)
         assert _is_power_of_two(outLength), "Output length must be a power of two"
-        self.addInput("i",F32_SCALAR,inLength)
-        self.addOutput("o",F32_SCALAR,outLength)
+        self.addInput("i",theType,inLength)
+        self.addOutput("o",theType,outLength)
 
     @property
     def typeName(self):
@@ -0,0 +1,27 @@
+from cmsis_stream.cg.scheduler import GenericNode
+from .NodeTypes import *
+from .STFT import stft_fft_size
+
+# Inverse STFT with weighted overlap add.
+# The arguments must be the ones of the STFT node producing the spectrum.
+# The output is delayed by windowLength - hop samples.
+# The node is identified so that resume() clears the overlap add buffer
+# after a pause.
+class ISTFT(GenericNode):
+    def __init__(self,name,hop,windowLength,window="SqrtHann"):
+        GenericNode.__init__(self,name,identified=True)
+        fftSize = stft_fft_size(windowLength)
+        self.addInput("i",F32_COMPLEX,fftSize//2)
+        self.addOutput("o",F32_SCALAR,hop)
+        self.addLiteralArg(windowLength)
+        self.addVariableArg(f"STFTWindow::{window}")
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "ISTFT"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
@@ -0,0 +1,29 @@
+from cmsis_stream.cg.scheduler import GenericSink
+
+# Convert RGB565 camera frames into int8 tensors for a vision network:
+# crop, bilinear resize, color conversion and quantization in one pass.
+# The settings are in the params->name structure (imagePreprocessParams).
+# When flowControl is True, a second event input is created. A new
+# tensor is sent only after an event (like the ack from TFLite) has been
+# received on this input.
+class ImagePreprocess(GenericSink):
+    def __init__(self,name,flowControl=False):
+        GenericSink.__init__(self,name,identified=True)
+        if flowControl:
+            self.addEventInput(2)
+        else:
+            self.addEventInput(1)
+        self.addEventOutput(1)
+        self.addVariableArg(f"params->{name}")
+        if flowControl:
+            self.addLiteralArg(1)
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "ImagePreprocess"
@@ -1,9 +1,16 @@
-from cmsis_stream.cg.scheduler import CType, CStructType,F32,Q15
+from cmsis_stream.cg.scheduler import CType, CStructType,F32,F16,Q15,Q31
 
 F32_SCALAR = CType(F32)
 F32_COMPLEX = CStructType("cf32",8)
 F32_STEREO = CStructType("sf32",8)
 
+# Require CONFIG_CMSIS_DSP_FLOAT16
+F16_SCALAR = CType(F16)
+F16_COMPLEX = CStructType("cf16",4)
+
 Q15_SCALAR = CType(Q15)
 Q15_COMPLEX = CStructType("cq15",4)
-Q15_STEREO = CStructType("sq15",4)
\ No newline at end of file
+Q15_STEREO = CStructType("sq15",4)
+
+Q31_SCALAR = CType(Q31)
+Q31_COMPLEX = CStructType("cq31",8)
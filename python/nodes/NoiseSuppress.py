@@ -0,0 +1,25 @@
+from cmsis_stream.cg.scheduler import GenericNode
+from .NodeTypes import *
+from .STFT import stft_fft_size
+
+# Wiener noise suppression in the STFT domain. The node is a gain per
+# bin and must be connected between a STFT and an ISTFT node.
+# windowLength : window length of the STFT producing the spectrum
+# The node is identified so that resume() clears the gain history after
+# a pause.
+class NoiseSuppress(GenericNode):
+    def __init__(self,name,windowLength):
+        GenericNode.__init__(self,name,identified=True)
+        nbBins = stft_fft_size(windowLength)//2
+        self.addInput("i",F32_COMPLEX,nbBins)
+        self.addOutput("o",F32_COMPLEX,nbBins)
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "NoiseSuppress"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
@@ -1,4 +1,4 @@
-from cmsis_stream.cg.scheduler import GenericNode,F32,Q15
+from cmsis_stream.cg.scheduler import GenericNode,F32,F16,Q15,Q31
 from .NodeTypes import *
 
 
@@ -8,9 +8,15 @@ class RealToComplex(GenericNode):
         if theType == F32:
             inputType = F32_SCALAR
             outputType = F32_COMPLEX
+        elif theType == F16:
+            inputType = F16_SCALAR
+            outputType = F16_COMPLEX
         elif theType == Q15:
             inputType = Q15_SCALAR
             outputType = Q15_COMPLEX
+        elif theType == Q31:
+            inputType = Q31_SCALAR
+            outputType = Q31_COMPLEX
         else:
             raise ValueError("Unsupported type for RealToComplex: {}".format(theType))
         self.addInput("i",inputType,outLength)
@@ -0,0 +1,115 @@
+import math
+import os
+import glob
+
+from cmsis_stream.cg.scheduler import GenericNode
+from .NodeTypes import *
+
+# Folder containing the generated polyphase filters used by Resampler.hpp
+FILTER_FOLDER = "src/streamgraph/streamnodes/nodes/resampler_filters"
+
+def _bessel_i0(x):
+    s = 1.0
+    t = 1.0
+    k = 1
+    while t > 1e-12 * s:
+        t = t * (x / (2.0 * k)) ** 2
+        s = s + t
+        k = k + 1
+    return s
+
+# Low pass prototype filter for a L/M resampler (windowed sinc with a
+# Kaiser window). The prototype runs at L times the input rate.
+# The cutoff is just below the smallest of the input and output Nyquist
+# frequencies.
+def design_prototype(L,M,tapsPerPhase,beta=8.0,rolloff=0.9):
+    N = L * tapsPerPhase
+    fc = rolloff * 0.5 / max(L,M)
+    c = (N - 1) / 2.0
+    h = []
+    for n in range(N):
+        x = 2.0 * fc * (n - c)
+        sinc = 1.0 if x == 0 else math.sin(math.pi * x) / (math.pi * x)
+        r = 2.0 * (n - c) / (N - 1)
+        w = _bessel_i0(beta * math.sqrt(max(0.0,1.0 - r * r))) / _bessel_i0(beta)
+        h.append(2.0 * fc * sinc * w)
+    s = sum(h)
+    return [x / s for x in h]
+
+# Polyphase decomposition: coefs[p][j] is applied to the j-th sample of
+# the window ending with the most recent input sample. The gain L of the
+# interpolation is included.
+def polyphase_coefs(L,M,tapsPerPhase):
+    h = design_prototype(L,M,tapsPerPhase)
+    T = tapsPerPhase
+    return [[L * h[p + (T - 1 - j) * L] for j in range(T)] for p in range(L)]
+
+def _filter_file_name(L,M):
+    return f"{FILTER_FOLDER}/ResamplerFilter_{L}_{M}.hpp"
+
+# Generate the filter for a L/M ratio (if not already generated with the
+# same number of taps) and the header including all the filters.
+def generate_resampler_filter(L,M,tapsPerPhase):
+    os.makedirs(FILTER_FOLDER,exist_ok=True)
+    filename = _filter_file_name(L,M)
+    taps_line = f"    static constexpr int tapsPerPhase = {tapsPerPhase};"
+    if os.path.exists(filename):
+        with open(filename,"r") as f:
+            if taps_line in f.read():
+                return
+        print(f"Resampler filter {L}/{M} regenerated with {tapsPerPhase} taps per phase")
+
+    coefs = polyphase_coefs(L,M,tapsPerPhase)
+    with open(filename,"w") as f:
+        print(f'''// This file is automatically generated by python/nodes/Resampler.py. Do not edit.
+#pragma once
+
+// Polyphase filter for a {L}/{M} resampler
+template <>
+struct ResamplerFilter<{L}, {M}>
+{{
+{taps_line}
+    static constexpr float coefs[{L}][{tapsPerPhase}] = {{''',file=f)
+        for p in range(L):
+            values = ", ".join(f"{x:.9g}f" for x in coefs[p])
+            print(f"        {{{values}}},",file=f)
+        print("    };\n};",file=f)
+
+    # All the filters generated by all the graphs
+    with open(f"{FILTER_FOLDER}/resampler_filters.hpp","w") as f:
+        print("// This file is automatically generated by python/nodes/Resampler.py. Do not edit.",file=f)
+        print("#pragma once\n",file=f)
+        for h in sorted(glob.glob(f"{FILTER_FOLDER}/ResamplerFilter_*.hpp")):
+            print(f'#include "{os.path.basename(h)}"',file=f)
+
+# Rational resampler from inputFreq to outputFreq (in Hz or kHz).
+# The input length must be a multiple of M (output length is then
+# a multiple of L).
+# The polyphase filter is designed when the graph is generated.
+# By default, the number of taps per phase grows with the decimation
+# factor M/L to keep the same transition band.
+# The node is identified so that resume() clears the filter state after
+# a context switch.
+class Resampler(GenericNode):
+    def __init__(self,name,inLength,inputFreq=16000,outputFreq=48000,tapsPerPhase=None):
+        GenericNode.__init__(self,name,identified=True)
+        g = math.gcd(int(inputFreq),int(outputFreq))
+        L = int(outputFreq) // g
+        M = int(inputFreq) // g
+        if tapsPerPhase is None:
+            tapsPerPhase = 16 * ((M + L - 1) // L)
+        if inLength % M != 0:
+            raise Exception(f"Resampler {name} : input length {inLength} must be a multiple of {M}")
+        self.addInput("i",F32_SCALAR,inLength)
+        self.addOutput("o",F32_SCALAR,inLength * L // M)
+        generate_resampler_filter(L,M,tapsPerPhase)
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "Resampler"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
@@ -0,0 +1,24 @@
+from cmsis_stream.cg.scheduler import GenericSource
+
+# Consumer side of a link between two partitions of a graph.
+# Created by PartitionedGraph (partition.py) for each edge between
+# two partitions. graph is the name of the partitioned graph.
+# The capacity of the channel is in samples.
+class SPSCSource(GenericSource):
+    def __init__(self,name,theType,outLength,graph,channel,capacity):
+        GenericSource.__init__(self,name)
+        self.addOutput("o",theType,outLength)
+        # Channel numbers are only unique in a graph
+        self.addVariableArg(f'"{graph}"')
+        self.addLiteralArg(channel)
+        self.addLiteralArg(capacity)
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "SPSCSource"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
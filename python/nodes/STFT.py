@@ -0,0 +1,35 @@
+from cmsis_stream.cg.scheduler import GenericNode
+from .NodeTypes import *
+
+def stft_fft_size(windowLength):
+    l = 32
+    while l < windowLength:
+        l = l << 1
+    return l
+
+# Short time Fourier transform of the last windowLength samples.
+# Each run reads hop samples. The window is zero padded to the next
+# power of two.
+# The output is the packed CMSIS-DSP real FFT spectrum: fftSize/2 complex
+# values with the DC and Nyquist bins in the first one.
+# window : Hann, SqrtHann or Hamming
+# The node is identified so that resume() clears the previous samples
+# after a pause.
+class STFT(GenericNode):
+    def __init__(self,name,hop,windowLength,window="SqrtHann"):
+        GenericNode.__init__(self,name,identified=True)
+        fftSize = stft_fft_size(windowLength)
+        self.addInput("i",F32_SCALAR,hop)
+        self.addOutput("o",F32_COMPLEX,fftSize//2)
+        self.addLiteralArg(windowLength)
+        self.addVariableArg(f"STFTWindow::{window}")
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "STFT"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
@@ -0,0 +1,30 @@
+from cmsis_stream.cg.scheduler import GenericNode
+
+# Same behavior as the CMSIS Stream SlidingBuffer but the overlap is not
+# copied at each run. The output must be connected with
+# connect_sliding_window so that the FIFO is a SlidingFIFO.
+# The node is identified: the overlap is its state and it is saved and
+# restored during a context switch (WarmContextSwitch).
+class SlidingWindow(GenericNode):
+    def __init__(self,name,theType,windowSize,overlap):
+        GenericNode.__init__(self,name,identified=True)
+        if overlap >= windowSize:
+            raise Exception(f"SlidingWindow {name} : overlap {overlap} must be smaller than the window {windowSize}")
+        self.addInput("i",theType,windowSize-overlap)
+        self.addOutput("o",theType,windowSize)
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "SlidingWindow"
+
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
+
+# The consumer reads the windows in place from the SlidingFIFO
+def connect_sliding_window(graph,window,dst):
+    if not isinstance(window,SlidingWindow):
+        raise Exception(f"connect_sliding_window : {window.nodeName} is not a SlidingWindow")
+    graph.connect(window.o,dst,fifoClass="SlidingFIFO")
@@ -0,0 +1,22 @@
+from cmsis_stream.cg.scheduler import GenericSink
+
+from .NodeTypes import *
+
+# Playback on I2S TX (requires CONFIG_AUDIO_SINK)
+class ZephyrAudioSink(GenericSink):
+    def __init__(self,name,inLength):
+        GenericSink.__init__(self,name,identified=True)
+        # Stereo input
+        self.addInput("i",Q15_STEREO,inLength)
+        # hw_ is common to all node and does not name a specific node
+        self.addVariableArg(f"params->hw_")
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "ZephyrAudioSink"
+    
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
@@ -0,0 +1,23 @@
+from cmsis_stream.cg.scheduler import GenericSource
+
+from .NodeTypes import *
+
+# Read raw RGB565 frames from a file.
+# Used for testing on host when no camera is available.
+class ZephyrFileVideoSource(GenericSource):
+    def __init__(self,name,path,width,height):
+        GenericSource.__init__(self,name,identified=True)
+        self.addLiteralArg(path)
+        self.addLiteralArg(width)
+        self.addLiteralArg(height)
+        self.addEventOutput()
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "ZephyrFileVideoSource"
+    
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
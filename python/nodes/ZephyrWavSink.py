@@ -0,0 +1,22 @@
+from cmsis_stream.cg.scheduler import GenericSink
+
+from .NodeTypes import *
+
+# Write the stereo samples to a WAV file and log the timing of the graph.
+# Used for testing on host when no audio output is available.
+class ZephyrWavSink(GenericSink):
+    def __init__(self,name,inLength,path):
+        GenericSink.__init__(self,name,identified=True)
+        self.addInput("i",Q15_STEREO,inLength)
+        self.addLiteralArg(path)
+        self.addVariableArg(f"params->hw_")
+
+    @property
+    def typeName(self):
+        """The name of the C++ class implementing this node"""
+        return "ZephyrWavSink"
+    
+    @property
+    def folder(self):
+        """The folder containing the C++ class implementing this node"""
+        return "nodes"
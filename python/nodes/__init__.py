@@ -2,19 +2,31 @@ from .CFFT import *
 from .DeinterleaveStereo import *
 from .InterleaveStereo import *
 from .ZephyrAudioSource import *
+from .ZephyrAudioSink import *
+from .ZephyrWavSink import *
 from .ZephyrDebugAudioSource import *
 from .RealToComplex import *
 from .Convert import *
 from .Hanning import *
 from .NodeTypes import *
 from .NullSink import *
-from .SRC import *
+from .Resampler import *
 from .SendToNetwork import *
 from .TFLite import *
-from .SpeexPreprocess import *
+from .NoiseSuppress import *
 from .StereoToMono import *
 from .ZephyrLCD import *
 from .Gain import *
 from .ZephyrDebugVideoSource import *
 from .CameraFrame import *
 from .ZephyrVideoSource import *
+from .ZephyrFileVideoSource import *
+from .ImagePreprocess import *
+from .FrameMailbox import *
+from .SPSCSink import *
+from .SPSCSource import *
+from .SlidingWindow import *
+from .STFT import *
+from .ISTFT import *
+from .Beamformer import *
+from .AGC import *
@@ -0,0 +1,124 @@
+# Partitioning of a graph across several threads.
+#
+# Nodes are annotated with a partition number:
+#
+#    fft_right.partition = 1
+#
+# Nodes without annotation are in partition 0.
+# The graph is described with a PartitionedGraph instead of a Graph. It has
+# the same connect API. Each partition becomes a standalone graph with its own
+# static schedule. It can run on its own thread (stream_runner) or on another
+# core.
+#
+# Each dataflow edge between two partitions is replaced by a SPSCSink in the
+# producer partition and a SPSCSource in the consumer partition. They share a
+# lock-free single producer / single consumer channel (SPSCFifo.hpp).
+# Node code is not changed.
+#
+# Event edges cannot cross partitions: events are processed by the event
+# thread of a partition. The nodes connected by an event edge must be in the
+# same partition.
+import glob
+import os
+import shutil
+
+from cmsis_stream.cg.scheduler import Graph
+
+from .nodes import SPSCSink, SPSCSource
+from .generate import generate
+
+def partition_of(node):
+    return getattr(node,"partition",0)
+
+def _is_event_port(port):
+    return port.name.startswith("iev") or port.name.startswith("oev")
+
+def partition_app_name(app,k):
+    if k == 0:
+        return app
+    return f"{app}_p{k}"
+
+class PartitionedGraph:
+    def __init__(self,channelDepth=2):
+        self._edges = []
+        # Capacity of a channel in number of (producer + consumer) blocks
+        self._channelDepth = channelDepth
+
+    def connect(self,src,dst):
+        self._edges.append((src,dst))
+
+    def split(self,app):
+        """Return a dictionary partition -> Graph
+
+        app is the name of the graph. It identifies the channels
+        of this graph at runtime."""
+        graphs = {}
+        channel = 0
+
+        def graph(k):
+            if k not in graphs:
+                graphs[k] = Graph()
+            return graphs[k]
+
+        for (src,dst) in self._edges:
+            ps = partition_of(src.owner)
+            pd = partition_of(dst.owner)
+            if ps == pd:
+                graph(ps).connect(src,dst)
+                continue
+
+            if _is_event_port(src) or _is_event_port(dst):
+                raise ValueError(f"Event edge {src.owner.nodeName}.{src.name} -> {dst.owner.nodeName}.{dst.name} crosses partitions {ps} and {pd}")
+
+            # Capacity is at least the sum of the producer and consumer
+            # blocks to avoid a deadlock between the partitions
+            capacity = self._channelDepth * (src.nbSamples + dst.nbSamples)
+            sink = SPSCSink(f"spsc{channel}Out",src.theType,src.nbSamples,app,channel,capacity)
+            source = SPSCSource(f"spsc{channel}In",dst.theType,dst.nbSamples,app,channel,capacity)
+            graph(ps).connect(src,sink.i)
+            graph(pd).connect(source.o,dst)
+            channel = channel + 1
+
+        return graphs
+
+def partition_folders(app):
+    """Partitions k > 0 of app generated in src/streamgraph"""
+    return sorted(glob.glob(f"src/streamgraph/{app}_p[0-9]*"))
+
+# Remove the partitions of a previous generation. The build compiles
+# the partitions found in src/streamgraph (see CMakeLists.txt) so they
+# must not be kept when the graph is generated without partitions.
+def remove_partitions(app):
+    for folder in partition_folders(app):
+        print(f"Removing {folder}")
+        shutil.rmtree(folder)
+
+# The apps and their partitions (for the files common to all the graphs)
+def with_partitions(apps):
+    res = []
+    for app in apps:
+        res.append(app)
+        res += [os.path.basename(f) for f in partition_folders(app)]
+    return res
+
+# Generate one scheduler per partition.
+# Partition 0 keeps the name of the app. Partition k is generated
+# in src/streamgraph/<app>_p<k>. All partitions use the parameters of the app.
+# The FIFO overlay is disabled since the partitions run at the same time.
+# The partitions are run by their own stream_runner so the build
+# requires CONFIG_STREAM_CONCURRENT_GRAPHS.
+def generate_partitioned(app,pgraph,myStyle,codeSizeOptimization=False,arena=True,unroll=False,staticAlloc=False):
+    remove_partitions(app)
+    graphs = pgraph.split(app)
+    for k in sorted(graphs):
+        name = partition_app_name(app,k)
+        os.makedirs(f"src/streamgraph/{name}/json",exist_ok=True)
+        print(f"Partition {k} : {name}")
+        generate(name,graphs[k],myStyle,
+                 codeSizeOptimization=codeSizeOptimization,
+                 fifoOverlay=False,
+                 arena=arena,
+                 unroll=unroll,
+                 staticAlloc=staticAlloc,
+                 paramsType=f"{app.capitalize()}Params")
+    return [partition_app_name(app,k) for k in sorted(graphs)]
@@ -0,0 +1,365 @@
+# Post-processing of the C++ code generated by CMSIS-Stream
+# Those functions only work on the generated files and do not depend on
+# the cmsis_stream Python package. So they can be used to update already
+# generated schedulers.
+import json
+import re
+
+# Alignment of the FIFO buffers (the same as CG_BEFORE_BUFFER in app_config.hpp)
+FIFO_ALIGNMENT = 16
+
+def scheduler_file_name(app):
+    return f"src/streamgraph/{app}/scheduler_{app}.cpp"
+
+def overlay_json_file_name(app):
+    return f"src/streamgraph/{app}/json/scheduler_{app}_overlay.json"
+
+def _align(x,a=FIFO_ALIGNMENT):
+    return (x + a - 1) // a * a
+
+# Only one graph is running at a given time. So the FIFO buffers of
+# all the graphs can share the same memory region (stream_fifo_overlay).
+#
+# Each buffer definition:
+#
+#    CG_BEFORE_BUFFER
+#    uint8_t stream_appa_buf0[BUFFERSIZE0]={0};
+#
+# is replaced by a pointer into the overlay when CONFIG_STREAM_FIFO_OVERLAY is
+# enabled. The original definition is kept otherwise.
+# The memory required by the graph is written in a json file
+# used to generate the common overlay definition.
+def fifo_overlay(app):
+    filename = scheduler_file_name(app)
+    with open(filename,"r") as f:
+        code = f.read()
+
+    # Already processed
+    if "CONFIG_STREAM_FIFO_OVERLAY" in code:
+        raise ValueError(f"{filename} already uses the FIFO overlay")
+
+    sizes = {int(m.group(1)):int(m.group(2)) for m in re.finditer(r"#define BUFFERSIZE(\d+) (\d+)",code)}
+    pattern = re.compile(r"CG_BEFORE_BUFFER\n(uint8_t (\w+)\[BUFFERSIZE(\d+)\]=\{0\};)\n")
+
+    offsets = {}
+    offset = 0
+    for m in pattern.finditer(code):
+        nb = int(m.group(3))
+        offsets[nb] = offset
+        offset = offset + _align(sizes[nb])
+
+    def replace(m):
+        name = m.group(2)
+        nb = int(m.group(3))
+        return(f'''#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+static uint8_t * const {name} = stream_fifo_overlay + {offsets[nb]};
+#else
+CG_BEFORE_BUFFER
+{m.group(1)}
+#endif
+''')
+
+    code = pattern.sub(replace,code)
+    include = f'#include "scheduler_{app}.h"\n'
+    code = code.replace(include,include + '#include "stream_fifo_overlay.h"\n',1)
+
+    with open(filename,"w") as f:
+        f.write(code)
+
+    with open(overlay_json_file_name(app),"w") as f:
+        json.dump({"size":offset,"buffers":{f"{x}":{"size":sizes[x],"offset":offsets[x]} for x in offsets}},f,indent=4)
+
+    return offset
+
+# Generate the definition of the overlay shared by all the graphs.
+# Its size is the max of the memory used by each graph.
+def generate_fifo_overlay(all_apps=[]):
+    sizes = {}
+    for app in all_apps:
+        with open(overlay_json_file_name(app),"r") as f:
+            sizes[app] = json.load(f)["size"]
+
+    overlay_size = max(sizes.values()) if sizes else 0
+    total = sum(sizes.values())
+    print(f"FIFO overlay size {overlay_size} bytes instead of {total} bytes")
+
+    with open("src/streamgraph/common/stream_fifo_overlay.h","w") as f:
+        print(f'''#ifndef STREAM_FIFO_OVERLAY_H
+#define STREAM_FIFO_OVERLAY_H
+// This file is automatically generated. Do not edit.
+
+#include <stdint.h>
+
+#ifdef   __cplusplus
+extern "C"
+{{
+#endif
+
+// Memory used by each graph
+''',file=f,end="")
+        for app in sizes:
+            print(f"#define STREAM_{app.upper()}_FIFO_SIZE {sizes[app]}",file=f)
+        print(f'''
+// Graphs are never running at the same time and share
+// the same memory for their FIFOs
+#define STREAM_FIFO_OVERLAY_SIZE {max(overlay_size,FIFO_ALIGNMENT)}
+
+extern uint8_t stream_fifo_overlay[STREAM_FIFO_OVERLAY_SIZE];
+
+#ifdef   __cplusplus
+}}
+#endif
+
+#endif // STREAM_FIFO_OVERLAY_H''',file=f)
+
+    with open("src/streamgraph/common/stream_fifo_overlay.cpp","w") as f:
+        print(f'''// This file is automatically generated. Do not edit.
+
+#include <cstdint>
+#include "app_config.hpp"
+#include "stream_fifo_overlay.h"
+
+CG_FIFO_OVERLAY_BUFFER
+uint8_t stream_fifo_overlay[STREAM_FIFO_OVERLAY_SIZE]={{0}};''',file=f)
+
+# The buffer of a SlidingFIFO (python/nodes/SlidingWindow.py) keeps the
+# overlap between two windows. It cannot be one of the buffers of the
+# scheduler since they are shared between FIFOs. Each SlidingFIFO:
+#
+#    fifos.fifo4 = new (std::nothrow) SlidingFIFO<float,FIFOSIZE4,1,0>(stream_appa_buf1);
+#
+# gets its own buffer sized with the window and overlap of the
+# SlidingWindow node writing to it (sliding_fifo_size in SlidingFIFO.hpp):
+#
+#    CG_BEFORE_BUFFER
+#    static float stream_appa_sliding4[sliding_fifo_size(FIFOSIZE4,490,480)]={0};
+#
+# The scheduler buffer is removed when no other FIFO uses it so the
+# memory of the windows is not counted twice.
+# It must be done before the FIFO overlay.
+def sliding_fifo_buffers(app):
+    filename = scheduler_file_name(app)
+    with open(filename,"r") as f:
+        code = f.read()
+
+    if "sliding_fifo_size(" in code:
+        raise ValueError(f"{filename} already has the SlidingFIFO buffers")
+
+    # Window and overlap of the SlidingFIFO written by each SlidingWindow
+    windows = {}
+    for m in re.finditer(r"SlidingWindow<[\w:]+,(\d+),[\w:]+,(\d+)>\(\*\(fifos\.(fifo\d+)\),\*\(fifos\.(fifo\d+)\)\);",code):
+        hop = int(m.group(1))
+        window = int(m.group(2))
+        windows[m.group(4)] = (window, window - hop)
+
+    pattern = re.compile(r"fifos\.(fifo(\d+)) = new \(std::nothrow\) SlidingFIFO<([\w:]+),(FIFOSIZE\d+),(\d+),(\d+)>\((\w+)\);")
+    buffers = []
+    def replace(m):
+        fifo = m.group(1)
+        if fifo not in windows:
+            raise ValueError(f"{filename} : SlidingFIFO {fifo} is not written by a SlidingWindow")
+        window,overlap = windows[fifo]
+        name = f"stream_{app}_sliding{m.group(2)}"
+        buffers.append(f"CG_BEFORE_BUFFER\nstatic {m.group(3)} {name}[sliding_fifo_size({m.group(4)},{window},{overlap})]={{0}};\n")
+        return(f"fifos.{fifo} = new (std::nothrow) SlidingFIFO<{m.group(3)},{m.group(4)},{m.group(5)},{m.group(6)}>({name});")
+
+    code,nb = pattern.subn(replace,code)
+    if nb == 0:
+        return 0
+
+    # Scheduler buffers not used anymore
+    for m in list(re.finditer(r"#define BUFFERSIZE(\d+) \d+\nCG_BEFORE_BUFFER\nuint8_t (\w+)\[BUFFERSIZE\d+\]=\{0\};\n",code)):
+        name = m.group(2)
+        if re.search(rf"\({name}[,)]",code) is None:
+            code = code.replace(m.group(0),"",1)
+            code = re.sub(rf" *std::fill_n\({name}, BUFFERSIZE{m.group(1)}, \(uint8_t\)0\);\n","",code)
+            print(f"SlidingFIFO of {app} : scheduler buffer {name} removed")
+
+    # The buffers are defined after the FIFO sizes
+    anchor = "typedef struct {\n"
+    code = code.replace(anchor,"// Buffers of the SlidingFIFOs (not shared)\n" + "".join(buffers) + "\n" + anchor,1)
+
+    with open(filename,"w") as f:
+        f.write(code)
+
+    print(f"SlidingFIFO of {app} : {nb} buffers")
+    return nb
+
+# All FIFOs and nodes of a graph are allocated from the arena passed to
+# init_scheduler_* (struct stream_arena *arena) instead of the heap.
+# The arena is the current one while the graph is initialized so
+# that node constructors can also allocate their buffers from it
+# (see StreamArena.hpp). Objects are destroyed in free_scheduler_*
+# and the arena is released in one call.
+def arena_allocation(app):
+    filename = scheduler_file_name(app)
+    with open(filename,"r") as f:
+        code = f.read()
+
+    if "arena_new<" in code:
+        raise ValueError(f"{filename} already uses the arena allocation")
+
+    # new (std::nothrow) T(args); -> arena_new<T>(args);
+    code = re.sub(r"new \(std::nothrow\) ([^;(]+)\((.*)\);",r"arena_new<\1>(\2);",code)
+    # new (std::nothrow) T; -> arena_new<T>();
+    code = re.sub(r"new \(std::nothrow\) ([^;(]+);",r"arena_new<\1>();",code)
+    # delete x; -> arena_delete(graph_arena,x);
+    code = re.sub(r"delete ([\w.]+);",r"arena_delete(graph_arena,\1);",code)
+
+    include = f'#include "scheduler_{app}.h"\n'
+    code = code.replace(include,include + '#include "StreamArena.hpp"\n',1)
+
+    getter = f"CStreamNode* get_scheduler_{app}_node"
+    code = code.replace(getter,f'''// Arena used to allocate the FIFOs and nodes of the graph
+static struct stream_arena *graph_arena = nullptr;
+
+{getter}''',1)
+
+    queue = "    EventQueue *evtQueue = reinterpret_cast<EventQueue *>(evtQueue_);\n"
+    code = code.replace(queue,queue + '''    graph_arena = arena;
+    ArenaScope arenaScope(arena);
+''',1)
+
+    free_start = code.index(f"void free_scheduler_{app}()\n{{")
+    free_end = code.index("\n}\n",free_start)
+    code = code[:free_end] + '''
+    stream_arena_reset(graph_arena);''' + code[free_end:]
+
+    with open(filename,"w") as f:
+        f.write(code)
+
+# Default max length of a schedule that is unrolled
+UNROLL_MAX_LENGTH = 256
+
+# The schedule is run by a loop over the schedule[] array and a switch
+# selecting the node to run:
+#
+#    for(; id < 14; id++)
+#    {
+#        CG_BEFORE_NODE_EXECUTION(schedule[id]);
+#        switch(schedule[id])
+#        {
+#            case 0:
+#            ...
+#
+# It is replaced by the sequence of the node executions. The calls were
+# already direct (run() is final and called through the concrete type
+# of the node in the switch): only the loop, the schedule table and the
+# switch are removed.
+# The code size increases with the length of the schedule since there
+# is one call site (with CG_BEFORE_NODE_EXECUTION and CHECKERROR) per
+# schedule entry instead of one per node.
+# Schedules longer than maxLength are not unrolled.
+def unroll_schedule(app,maxLength=UNROLL_MAX_LENGTH):
+    filename = scheduler_file_name(app)
+    with open(filename,"r") as f:
+        code = f.read()
+
+    if "// Schedule unrolled" in code:
+        raise ValueError(f"{filename} already uses an unrolled schedule")
+
+    m = re.search(r"static uint8_t schedule\[(\d+)\]=\n\{ \n([\d,\n]*)\};\n",code)
+    # Graph with only event nodes
+    if m is None:
+        print(f"Schedule of {app} : no dataflow schedule")
+        return False
+    schedule = [int(x) for x in m.group(2).replace("\n","").split(",") if x]
+
+    loop = re.compile(r"        unsigned long id=0;\n        for\(; id < \d+; id\+\+\)\n        \{\n"
+                      r"            CG_BEFORE_NODE_EXECUTION\(schedule\[id\]\);\n"
+                      r"            switch\(schedule\[id\]\)\n            \{\n"
+                      r"(.*?)"
+                      r"                default:\n                break;\n            \}\n"
+                      r"            CG_AFTER_NODE_EXECUTION\(schedule\[id\]\);\n"
+                      r"\s*CHECKERROR;\n        \}\n",re.DOTALL)
+    l = loop.search(code)
+    if l is None:
+        raise ValueError(f"{filename} : schedule loop not recognized")
+
+    cases = {}
+    for c in re.finditer(r"                case (\d+):\n                \{\n(.*?)\n                \}\n                break;\n",l.group(1),re.DOTALL):
+        cases[int(c.group(1))] = [x.strip() for x in c.group(2).split("\n") if x.strip()]
+
+    nbNodes = len(cases)
+    print(f"Schedule of {app} : {len(schedule)} node executions, {nbNodes} nodes")
+    if len(schedule) > maxLength:
+        print(f"  Not unrolled (longer than {maxLength})")
+        return False
+
+    body = ""
+    for nodeId in schedule:
+        body += f"        CG_BEFORE_NODE_EXECUTION({nodeId});\n"
+        for s in cases[nodeId]:
+            body += f"        {s}\n"
+        body += f"        CG_AFTER_NODE_EXECUTION({nodeId});\n"
+        body += "        CHECKERROR;\n\n"
+
+    code = code[:l.start()] + body + code[l.end():]
+    code = code[:m.start()] + f"// Schedule unrolled in the scheduler function:\n// {','.join(str(x) for x in schedule)}\n" + code[m.end():]
+
+    # The code size tradeoff: one call site per schedule entry instead of
+    # one per node plus the schedule table
+    print(f"  Unrolled : {len(schedule)} call sites instead of {nbNodes} and a {len(schedule)} bytes table")
+    if len(schedule) > nbNodes:
+        print(f"  The scheduler code grows by about {len(schedule) - nbNodes} call sites (check with the rom_report target)")
+
+    with open(filename,"w") as f:
+        f.write(code)
+
+    return True
+
+# Static allocation mode. Each FIFO and node is constructed in its own
+# static storage emitted in the scheduler file instead of the heap or
+# the arena:
+#
+#    fifos.fifo0 = new (std::nothrow) FIFO<sq15,FIFOSIZE0,1,0>(stream_appa_buf1);
+#    if (fifos.fifo0==NULL)
+#    {
+#        return(CG_MEMORY_ALLOCATION_FAILURE);
+#    }
+#
+# becomes:
+#
+#    fifos.fifo0 = static_new(fifos_fifo0_storage,stream_appa_buf1);
+#
+# The allocation cannot fail so the error paths are removed.
+# The RAM used by the graph is known at link time (see StreamStatic.hpp).
+# It replaces the arena allocation.
+def static_allocation(app):
+    filename = scheduler_file_name(app)
+    with open(filename,"r") as f:
+        code = f.read()
+
+    if "static_new(" in code or "arena_new<" in code:
+        raise ValueError(f"{filename} already uses a custom allocation")
+
+    pattern = re.compile(r"    ([\w.]+) = new \(std::nothrow\) ([^;(]+?)(?:\((.*)\))?;\n"
+                         r"    if \(\1==NULL\)\n    \{\n        return\(CG_MEMORY_ALLOCATION_FAILURE\);\n    \}\n")
+
+    storages = []
+    def replace(m):
+        storage = m.group(1).replace(".","_") + "_storage"
+        storages.append(f"static StaticStorage<{m.group(2)}> {storage};")
+        args = m.group(3)
+        if args:
+            return(f"    {m.group(1)} = static_new({storage},{args});\n")
+        return(f"    {m.group(1)} = static_new({storage});\n")
+
+    code = pattern.sub(replace,code)
+    if "new (std::nothrow)" in code:
+        raise ValueError(f"{filename} : allocation not recognized")
+
+    # delete x; -> static_delete(x);
+    code = re.sub(r"delete ([\w.]+);",r"static_delete(\1);",code)
+
+    include = f'#include "scheduler_{app}.h"\n'
+    code = code.replace(include,include + '#include "StreamStatic.hpp"\n',1)
+
+    # Graphs with only event nodes have no FIFOs
+    anchor = "static fifos_t fifos={0};\n" if "static fifos_t fifos" in code else "static nodes_t nodes={0};\n"
+    code = code.replace(anchor,"// Storage of the FIFOs and nodes of the graph\n" + "\n".join(storages) + "\n\n" + anchor,1)
+
+    with open(filename,"w") as f:
+        f.write(code)
+
+    print(f"Static allocation of {app} : {len(storages)} objects")
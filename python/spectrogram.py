@@ -1,13 +1,36 @@
-from cmsis_stream.cg.scheduler import Graph,SlidingBuffer,CType,F32
+from cmsis_stream.cg.scheduler import Graph,SlidingBuffer,CType,F32,F16,Q15,Q31
 from cmsis_stream.cg.scheduler.graphviz import Style
 
 from .nodes import *
 from .appnodes import *
 
 from .generate import generate
+from .partition import PartitionedGraph, generate_partitioned, remove_partitions
 
-def generate_spectrogram(codeSizeOptimization=False):
-    the_graph = Graph()
+# Data types of the spectrogram chain (windowing, FFT and magnitude)
+SAMPLE_TYPES = {
+    "f32" : (F32,F32_SCALAR,F32_COMPLEX),
+    "f16" : (F16,F16_SCALAR,F16_COMPLEX),
+    "q15" : (Q15,Q15_SCALAR,Q15_COMPLEX),
+    "q31" : (Q31,Q31_SCALAR,Q31_COMPLEX),
+}
+
+# partition : the right channel is computed in a second graph running
+# on its own thread (requires CONFIG_STREAM_CONCURRENT_GRAPHS)
+# sampleType : "f32", "f16", "q15" or "q31". With the other types than
+# f32, the microphone samples are not converted to f32. With f16 and q15,
+# the FIFOs of the chain are half the size of the f32 ones (the 1024
+# points complex FIFOs are 4 kB instead of 8 kB).
+# f16 requires CONFIG_CMSIS_DSP_FLOAT16=y in prj.conf
+def generate_spectrogram(codeSizeOptimization=False,partition=False,unroll=False,staticAlloc=False,sampleType="f32"):
+    if sampleType not in SAMPLE_TYPES:
+        raise ValueError(f"Unsupported sample type for the spectrogram: {sampleType}")
+    baseType,scalarType,complexType = SAMPLE_TYPES[sampleType]
+
+    if partition:
+        the_graph = PartitionedGraph()
+    else:
+        the_graph = Graph()
     
     SAMPLING_FREQ_HZ = 16000
     AUDIO_PACKET_DURATION = 20 # ms (320 samples)
@@ -30,29 +53,47 @@ def generate_spectrogram(codeSizeOptimization=False):
     #src = ZephyrDebugAudioSource("debugSource",NB)
     src = ZephyrAudioSource("audio",NB)
     gain = Gain("gain",Q15_STEREO,NB,4)
-    to_f32 = Convert("to_f32",Q15_STEREO,F32_STEREO,NB)
-    deinterleave = DeinterleaveStereo("deinterleave",F32_STEREO,NB)
+    if sampleType == "f32":
+        to_f32 = Convert("to_f32",Q15_STEREO,F32_STEREO,NB)
+        deinterleave = DeinterleaveStereo("deinterleave",F32_STEREO,NB)
+    else:
+        deinterleave = DeinterleaveStereo("deinterleave",Q15_STEREO,NB)
     
+    # Q15 samples from the microphones are converted to Q31 or F16 after
+    # the deinterleave
+    convert = sampleType in ["q31","f16"]
+    if convert:
+        convert_left = Convert("convertLeft",Q15_SCALAR,scalarType,NB)
+        convert_right = Convert("convertRight",Q15_SCALAR,scalarType,NB)
+        convert_right.partition = 1
     
-    audioWinLeft=SlidingBuffer("audioWinLeft",CType(F32),NB_WINDOW_SAMPLES,NB_OVERLAP_SAMPLES)
-    audioWinRight=SlidingBuffer("audioWinRight",CType(F32),NB_WINDOW_SAMPLES,NB_OVERLAP_SAMPLES)
+    audioWinLeft=SlidingBuffer("audioWinLeft",CType(baseType),NB_WINDOW_SAMPLES,NB_OVERLAP_SAMPLES)
+    audioWinRight=SlidingBuffer("audioWinRight",CType(baseType),NB_WINDOW_SAMPLES,NB_OVERLAP_SAMPLES)
     
-    win_left = Hanning("winLeft",NB_WINDOW_SAMPLES,FFT_SIZE)
-    win_right= Hanning("winRight",NB_WINDOW_SAMPLES,FFT_SIZE)
+    win_left = Hanning("winLeft",NB_WINDOW_SAMPLES,FFT_SIZE,scalarType)
+    win_right= Hanning("winRight",NB_WINDOW_SAMPLES,FFT_SIZE,scalarType)
     
-    to_complex_left = RealToComplex("toComplexLeft",F32,FFT_SIZE)
-    to_complex_right= RealToComplex("toComplexRight",F32,FFT_SIZE)
-    fft_left = CFFT("fftLeft",F32_COMPLEX,FFT_SIZE)
-    fft_right = CFFT("fftRight",F32_COMPLEX,FFT_SIZE)
+    to_complex_left = RealToComplex("toComplexLeft",baseType,FFT_SIZE)
+    to_complex_right= RealToComplex("toComplexRight",baseType,FFT_SIZE)
+    fft_left = CFFT("fftLeft",complexType,FFT_SIZE)
+    fft_right = CFFT("fftRight",complexType,FFT_SIZE)
     
-    spectrogram_left = Spectrogram("spectrogramLeft",FFT_SIZE)
-    spectrogram_right= Spectrogram("spectrogramRight",FFT_SIZE)
+    spectrogram_left = Spectrogram("spectrogramLeft",FFT_SIZE,complexType)
+    spectrogram_right= Spectrogram("spectrogramRight",FFT_SIZE,complexType)
     
     DISABLE_LEFT = False
     DISABLE_RIGHT = False
     
-    nullSinkLeft = NullSink("nullSinkLeft",F32_COMPLEX,NB)
-    nullSinkRight = NullSink("nullSinkRight",F32_SCALAR,NB)
+    # The spectrogram node and the display stay in partition 0 since
+    # events cannot cross partitions
+    audioWinRight.partition = 1
+    win_right.partition = 1
+    to_complex_right.partition = 1
+    fft_right.partition = 1
+
+    channelType = F32_SCALAR if sampleType == "f32" else Q15_SCALAR
+    nullSinkLeft = NullSink("nullSinkLeft",channelType,NB)
+    nullSinkRight = NullSink("nullSinkRight",channelType,NB)
     nullAll = NullSink("nullAll",Q15_STEREO,NB)
     
     display = SpectrogramDisplay("display")
@@ -63,12 +104,19 @@ def generate_spectrogram(codeSizeOptimization=False):
         the_graph.connect(src.o,nullAll.i)
     else:
         the_graph.connect(src.o,gain.i)
-        the_graph.connect(gain.o,to_f32.i)
-        the_graph.connect(to_f32.o,deinterleave.i)
+        if sampleType == "f32":
+            the_graph.connect(gain.o,to_f32.i)
+            the_graph.connect(to_f32.o,deinterleave.i)
+        else:
+            the_graph.connect(gain.o,deinterleave.i)
         if DISABLE_LEFT:
             the_graph.connect(deinterleave.l,nullSinkLeft.i)
+        elif convert:
+            the_graph.connect(deinterleave.l,convert_left.i)
+            the_graph.connect(convert_left.o,audioWinLeft.i)
         else:
             the_graph.connect(deinterleave.l,audioWinLeft.i)
+        if not DISABLE_LEFT:
             the_graph.connect(audioWinLeft.o,win_left.i)
             the_graph.connect(win_left.o,to_complex_left.i)
             the_graph.connect(to_complex_left.o,fft_left.i)
@@ -77,8 +125,12 @@ def generate_spectrogram(codeSizeOptimization=False):
         
         if DISABLE_RIGHT:
             the_graph.connect(deinterleave.r,nullSinkRight.i)
+        elif convert:
+            the_graph.connect(deinterleave.r,convert_right.i)
+            the_graph.connect(convert_right.o,audioWinRight.i)
         else:
             the_graph.connect(deinterleave.r,audioWinRight.i)
+        if not DISABLE_RIGHT:
             the_graph.connect(audioWinRight.o,win_right.i)
             the_graph.connect(win_right.o,to_complex_right.i)
             the_graph.connect(to_complex_right.o,fft_right.i)
@@ -101,7 +153,11 @@ def generate_spectrogram(codeSizeOptimization=False):
                     return("orange")
                 return(super().edge_color(edge))
     
-    generate("appb",the_graph,Style(),codeSizeOptimization=codeSizeOptimization)
+    if partition:
+        generate_partitioned("appb",the_graph,Style(),codeSizeOptimization=codeSizeOptimization,unroll=unroll,staticAlloc=staticAlloc)
+    else:
+        remove_partitions("appb")
+        generate("appb",the_graph,Style(),codeSizeOptimization=codeSizeOptimization,unroll=unroll,staticAlloc=staticAlloc)
 
 if __name__ == "__main__":
     import argparse
@@ -109,9 +165,13 @@ if __name__ == "__main__":
                     prog='kws',
                     description='Regenerate kws demo')
     parser.add_argument("--size", help="Code size optimization enabled", action='store_true')
+    parser.add_argument("--unroll", help="Unroll the schedule (faster, bigger code)", action='store_true')
+    parser.add_argument("--static", help="Static allocation of the FIFOs and nodes", action='store_true')
+    parser.add_argument("--partition", help="Compute the right channel on a second thread", action='store_true')
+    parser.add_argument("--type", help="Data type of the spectrogram computation", choices=list(SAMPLE_TYPES), default="f32")
     args = parser.parse_args()
 
-    generate_spectrogram(codeSizeOptimization=args.size)
+    generate_spectrogram(codeSizeOptimization=args.size,unroll=args.unroll,staticAlloc=args.static,partition=args.partition,sampleType=args.type)
     if args.size:
         print("KWS demo generated with code size optimization")
         print("You need to call the generate script to regenerate the common files")
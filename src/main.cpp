@@ -24,6 +24,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include "cg_enums.h"
 #include <zephyr/kernel.h>
@@ -36,6 +37,7 @@
 LOG_MODULE_REGISTER(streamapps, CONFIG_STREAMAPPS_LOG_LEVEL);
 
 #include "cstream_node.h"
+#include "stream_arena.h"
 #include "appa_params.h"
 #include "appb_params.h"
 #include "appc_params.h"
@@ -43,11 +45,15 @@ LOG_MODULE_REGISTER(streamapps, CONFIG_STREAMAPPS_LOG_LEVEL);
 #include "scheduler_appa.h"
 #include "scheduler_appb.h"
 #include "scheduler_appc.h"
+#if defined(STREAM_APPB_PARTITIONED)
+#include "scheduler_appb_p1.h"
+#endif
 
 #include "EventQueue.hpp"
 #include "StreamNode.hpp"
 
 #include "stream_runtime_init.hpp"
+#include "stream_runner.hpp"
 
 #include "rtos_events.hpp"
 
@@ -90,12 +96,28 @@ using namespace arm_cmsis_stream;
 // 2 : To experiment with camera support
 static int currentNetwork = 2;
 
+/*
+ * Graphs run by the demo: the applications and the partitions of the
+ * applications (python/partition.py). A partition runs at the same time
+ * as its application on its own runner. It is never switched to.
+ * 3 : Right channel of the spectrogram (appb_p1)
+ */
+#if defined(STREAM_APPB_PARTITIONED)
+#if !defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+#error "appb is partitioned: CONFIG_STREAM_CONCURRENT_GRAPHS must be enabled"
+#endif
+#define NB_GRAPHS (NB_APPS + 1)
+#else
+#define NB_GRAPHS NB_APPS
+#endif
+
 #define SWITCH_EVENT (1 << 0)
 
 /**
- * @brief Array of stream execution contexts, one per network.
+ * @brief Array of stream execution contexts, one per graph.
+ * The contexts of the partitions are after the ones of the networks.
  */
-static stream_execution_context_t contexts[NB_APPS];
+static stream_execution_context_t contexts[NB_GRAPHS];
 
 /**
  * @brief Parameters for appa and appb networks.
@@ -104,6 +126,52 @@ static stream_execution_context_t contexts[NB_APPS];
  */
 static hardwareParams *params[NB_APPS];
 
+#if defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+/**
+ * @brief One runner per graph when all the networks are running
+ * at the same time. The switch only changes the network owning the
+ * display.
+ * KWS has the highest priority since it must not lose audio.
+ * Event threads have a lower priority than all the dataflow threads.
+ * A partition has the priorities of its network and the display is
+ * owned by the partition when its network is the foreground one.
+ */
+static struct stream_runner runners[NB_GRAPHS];
+#if defined(STREAM_APPB_PARTITIONED)
+static const int dataflow_priorities[NB_GRAPHS] = {2, 3, 4, 3};
+static const int event_priorities[NB_GRAPHS] = {5, 6, 7, 6};
+static const char *runner_names[NB_GRAPHS] = {"appa", "appb", "appc", "appb_p1"};
+static const int runner_networks[NB_GRAPHS] = {0, 1, 2, 1};
+#else
+static const int dataflow_priorities[NB_GRAPHS] = {2, 3, 4};
+static const int event_priorities[NB_GRAPHS] = {5, 6, 7};
+static const char *runner_names[NB_GRAPHS] = {"appa", "appb", "appc"};
+static const int runner_networks[NB_GRAPHS] = {0, 1, 2};
+#endif
+
+BUILD_ASSERT(NB_GRAPHS <= CONFIG_STREAM_RUNNER_MAX_GRAPHS,
+	     "CONFIG_STREAM_RUNNER_MAX_GRAPHS is smaller than the number of graphs");
+#endif
+
+/**
+ * @brief One arena per graph.
+ * FIFOs, nodes and node buffers of a graph are allocated
+ * from its arena when the graph is initialized.
+ */
+#if defined(CONFIG_STREAM_GRAPH_ARENA)
+static uint8_t arena_mem[NB_GRAPHS][CONFIG_STREAM_GRAPH_ARENA_SIZE] __aligned(16);
+static struct stream_arena arena_storage[NB_GRAPHS];
+#endif
+static struct stream_arena *arenas[NB_GRAPHS] = {NULL};
+
+static void log_arena_usage(int network)
+{
+#if defined(CONFIG_STREAM_GRAPH_ARENA)
+	LOG_INF("Network %d: %d bytes used in arena, %d bytes allocated on heap\n", network,
+		(int)stream_arena_used(arenas[network]), (int)arenas[network]->overflow);
+#endif
+}
+
 #if DT_NODE_HAS_STATUS_OKAY(SW_NODE)
 void button_pressed(const struct device *dev, struct gpio_callback *cb, uint32_t pins)
 {
@@ -154,6 +222,159 @@ static int cmd_switch(const struct shell *shell, size_t argc, char **argv)
 
 SHELL_CMD_REGISTER(switch, NULL, "Switch between networks", cmd_switch);
 
+// Settings of the AGC of the KWS graph (when generated with --agc).
+// They are taken into account by the node at the next block.
+static int cmd_agc(const struct shell *shell, size_t argc, char **argv)
+{
+	struct agcParams *agc = &appaParams.agc;
+
+	if (__atomic_load_n(&agc->nbNodes, __ATOMIC_RELAXED) == 0) {
+		shell_warn(shell, "No AGC node is active (KWS graph generated without --agc)");
+		if (argc > 1) {
+			return -ENOENT;
+		}
+	}
+
+	if (argc == 1) {
+		shell_print(shell, "target %d dBFS, ratio %d, gain [%d,%d] dB",
+			    (int)agc->targetLevel, (int)agc->ratio, (int)agc->minGain,
+			    (int)agc->maxGain);
+		return 0;
+	}
+
+	agc_params_begin_update(agc);
+	agc->targetLevel = strtof(argv[1], NULL);
+	if (argc > 2) {
+		agc->ratio = strtof(argv[2], NULL);
+	}
+	if (argc > 3) {
+		agc->maxGain = strtof(argv[3], NULL);
+	}
+	agc_params_end_update(agc);
+
+	return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(agc, NULL, "AGC settings: agc [<target dBFS> [<ratio> [<max gain dB>]]]",
+		       cmd_agc, 1, 3);
+
+/*
+
+Timing of the context switch.
+All durations are in microseconds and are for the last switch.
+
+*/
+struct switch_timing {
+	// Pause of the nodes of the old graph (includes save_state)
+	uint32_t pause_nodes;
+	// Reset of the FIFOs of the new graph
+	uint32_t reset_fifos;
+	// Resume of the nodes of the new graph
+	uint32_t resume_nodes;
+	// Save and restore of the node states (warm switch)
+	uint32_t save_state;
+	uint32_t restore_state;
+	// stream_pause_current_scheduler (includes pause_nodes)
+	uint32_t pause;
+	// stream_resume_scheduler (includes reset_fifos and resume_nodes)
+	uint32_t resume;
+	uint32_t total;
+	// Slowest node during pause or resume
+	int32_t slowest_node;
+	uint32_t slowest_node_time;
+};
+
+static struct switch_timing last_switch;
+
+static inline uint32_t elapsed_us(uint32_t start)
+{
+	return k_cyc_to_us_floor32(k_cycle_get_32() - start);
+}
+
+static void record_node_time(int32_t nodeid, uint32_t t)
+{
+	if (t > last_switch.slowest_node_time) {
+		last_switch.slowest_node_time = t;
+		last_switch.slowest_node = nodeid;
+	}
+}
+
+// Signaled by the interrupt thread when a switch requested by the benchmark is done
+static K_SEM_DEFINE(switch_done, 0, 1);
+static volatile bool bench_running = false;
+
+#define SWITCH_BENCH_MAX_SAMPLES 256
+// Time during which each graph runs before the next switch
+#define SWITCH_BENCH_RUN_MS      100
+
+static uint32_t bench_samples[SWITCH_BENCH_MAX_SAMPLES];
+
+static int compare_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+	return (x > y) - (x < y);
+}
+
+// Cycle N times through all the graphs and report the switch latency
+static int cmd_switch_bench(const struct shell *shell, size_t argc, char **argv)
+{
+	if (NB_APPS == 1) {
+		shell_print(shell, "Only one network. Nothing to switch");
+		return 0;
+	}
+
+	int cycles = (argc > 1) ? atoi(argv[1]) : 10;
+	if (cycles <= 0) {
+		shell_error(shell, "Number of cycles must be positive");
+		return -EINVAL;
+	}
+	int nb = cycles * NB_APPS;
+	if (nb > SWITCH_BENCH_MAX_SAMPLES) {
+		nb = SWITCH_BENCH_MAX_SAMPLES - (SWITCH_BENCH_MAX_SAMPLES % NB_APPS);
+	}
+
+	uint64_t pause_nodes = 0, reset_fifos = 0, resume_nodes = 0;
+	uint64_t pause = 0, resume = 0;
+
+	bench_running = true;
+	for (int i = 0; i < nb; i++) {
+		k_msleep(SWITCH_BENCH_RUN_MS);
+		k_sem_reset(&switch_done);
+		k_event_post(&cg_interruptEvent, SWITCH_EVENT);
+		if (k_sem_take(&switch_done, K_SECONDS(5)) != 0) {
+			bench_running = false;
+			shell_error(shell, "Switch %d timed out", i);
+			return -ETIMEDOUT;
+		}
+		bench_samples[i] = last_switch.total;
+		pause_nodes += last_switch.pause_nodes;
+		reset_fifos += last_switch.reset_fifos;
+		resume_nodes += last_switch.resume_nodes;
+		pause += last_switch.pause;
+		resume += last_switch.resume;
+	}
+	bench_running = false;
+
+	qsort(bench_samples, nb, sizeof(uint32_t), compare_u32);
+	int p99 = (nb * 99) / 100;
+	if (p99 >= nb) {
+		p99 = nb - 1;
+	}
+
+	shell_print(shell, "%d switches", nb);
+	shell_print(shell, "Latency us: p50 %u, p99 %u, max %u", bench_samples[nb / 2],
+		    bench_samples[p99], bench_samples[nb - 1]);
+	shell_print(shell, "Mean us: pause %u (nodes %u), resume %u (fifos %u, nodes %u)",
+		    (uint32_t)(pause / nb), (uint32_t)(pause_nodes / nb),
+		    (uint32_t)(resume / nb), (uint32_t)(reset_fifos / nb),
+		    (uint32_t)(resume_nodes / nb));
+	return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(switch_bench, NULL, "Benchmark switch latency: switch_bench <cycles>",
+		       cmd_switch_bench, 1, 1);
+
 // Translate interrupt events into CMSIS Stream events
 void interrupt_thread_function(void *, void *, void *)
 {
@@ -166,14 +387,131 @@ void interrupt_thread_function(void *, void *, void *)
 			LOG_DBG("Received Switching network event\n");
 			currentNetwork = (currentNetwork + 1) % NB_APPS;
 			LOG_DBG("Switching to network %d\n", currentNetwork);
+			memset(&last_switch, 0, sizeof(last_switch));
+			last_switch.slowest_node = -1;
+
+			uint32_t start = k_cycle_get_32();
+#if defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+			// All networks are running. The new one only gets the display.
+			stream_resource_lock(STREAM_RESOURCE_DISPLAY);
+			stream_runner_set_foreground(currentNetwork);
+#if defined(CONFIG_DISPLAY)
+			blank_display();
+#endif
+			stream_resource_unlock(STREAM_RESOURCE_DISPLAY);
+#else
 			stream_pause_current_scheduler();
+			last_switch.pause = elapsed_us(start);
+
+			uint32_t resume_start = k_cycle_get_32();
 			stream_resume_scheduler(&contexts[currentNetwork]);
-			LOG_DBG("Context switch done\n");
+			last_switch.resume = elapsed_us(resume_start);
+#endif
+			last_switch.total = elapsed_us(start);
+
+			LOG_DBG("Context switch done in %u us: pause %u (nodes %u), resume %u "
+				"(fifos %u, nodes %u), slowest node %d (%u us)\n",
+				last_switch.total, last_switch.pause, last_switch.pause_nodes,
+				last_switch.resume, last_switch.reset_fifos,
+				last_switch.resume_nodes, last_switch.slowest_node,
+				last_switch.slowest_node_time);
+			if (bench_running) {
+				k_sem_give(&switch_done);
+			}
 		}
 	}
 	LOG_INF("Interrupt thread ended\n");
 }
 
+#if defined(CONFIG_STREAM_WARM_SWITCH)
+/**
+ * @brief Saved state of the nodes of a paused network.
+ * The blobs are allocated from the arena of the network the
+ * first time it is paused and are reused for the next switches.
+ */
+struct warm_state {
+	// One blob per identified node (NULL if the node has no state)
+	void **blobs;
+	int64_t saved_ms;
+	bool valid;
+};
+
+static struct warm_state warm_states[NB_GRAPHS];
+
+static void save_node_states(int network, const stream_execution_context_t *context)
+{
+	struct warm_state *state = &warm_states[network];
+	state->valid = false;
+
+	if (state->blobs == NULL) {
+		state->blobs = static_cast<void **>(stream_arena_alloc(
+			arenas[network], context->nb_identified_nodes * sizeof(void *),
+			alignof(void *)));
+		if (state->blobs == NULL) {
+			LOG_WRN("Network %d: no memory in arena for warm switch\n", network);
+			return;
+		}
+		for (int32_t nodeid = 0; nodeid < (int32_t)context->nb_identified_nodes;
+		     nodeid++) {
+			CStreamNode *cnode =
+				static_cast<CStreamNode *>(context->get_node_by_id(nodeid));
+			state->blobs[nodeid] = NULL;
+			if ((cnode == nullptr) || (cnode->obj == nullptr) ||
+			    (cnode->context_switch_intf == nullptr) ||
+			    (cnode->context_switch_intf->save_state == nullptr)) {
+				continue;
+			}
+			size_t size = cnode->context_switch_intf->state_size(cnode->obj);
+			state->blobs[nodeid] = stream_arena_alloc(arenas[network], size, 16);
+			if (state->blobs[nodeid] == NULL) {
+				LOG_WRN("Network %d: no memory in arena to save node %d\n",
+					network, nodeid);
+			}
+		}
+	}
+
+	for (int32_t nodeid = 0; nodeid < (int32_t)context->nb_identified_nodes; nodeid++) {
+		if (state->blobs[nodeid] == NULL) {
+			continue;
+		}
+		CStreamNode *cnode = static_cast<CStreamNode *>(context->get_node_by_id(nodeid));
+		size_t size = cnode->context_switch_intf->state_size(cnode->obj);
+		if (cnode->context_switch_intf->save_state(cnode->obj, state->blobs[nodeid],
+							   size) != 0) {
+			LOG_WRN("Network %d: can't save state of node %d\n", network, nodeid);
+			return;
+		}
+	}
+
+	state->saved_ms = k_uptime_get();
+	state->valid = true;
+}
+
+static void restore_node_states(int network, const stream_execution_context_t *context)
+{
+	struct warm_state *state = &warm_states[network];
+
+	// The state is too old to be relevant. The graph restarts cold.
+	if (!state->valid ||
+	    (k_uptime_get() - state->saved_ms > CONFIG_STREAM_WARM_SWITCH_MAX_AGE_MS)) {
+		return;
+	}
+
+	for (int32_t nodeid = 0; nodeid < (int32_t)context->nb_identified_nodes; nodeid++) {
+		if (state->blobs[nodeid] == NULL) {
+			continue;
+		}
+		CStreamNode *cnode = static_cast<CStreamNode *>(context->get_node_by_id(nodeid));
+		size_t size = cnode->context_switch_intf->state_size(cnode->obj);
+		if (cnode->context_switch_intf->restore_state(cnode->obj, state->blobs[nodeid],
+							      size) != 0) {
+			LOG_WRN("Network %d: can't restore state of node %d\n", network, nodeid);
+		}
+	}
+	state->valid = false;
+}
+#endif
+
 /*
 
  Pause and resume all nodes in a given graph.
@@ -191,29 +529,58 @@ void interrupt_thread_function(void *, void *, void *)
 */
 static void pause_scheduler_app(const stream_execution_context_t *context)
 {
+	uint32_t start = k_cycle_get_32();
+#if defined(CONFIG_STREAM_WARM_SWITCH)
+	// Pause may clear the memory of the nodes so the state is saved before
+	uint32_t save_start = k_cycle_get_32();
+	save_node_states(context - contexts, context);
+	last_switch.save_state = elapsed_us(save_start);
+#endif
 	for (int32_t nodeid = 0; nodeid < (int32_t)context->nb_identified_nodes; nodeid++) {
 		CStreamNode *cnode = static_cast<CStreamNode *>(context->get_node_by_id(nodeid));
 		if (cnode != nullptr) {
 			// If the node implements the context switch interface, pause it
 			if ((cnode->obj != nullptr) && (cnode->context_switch_intf != nullptr)) {
+				uint32_t node_start = k_cycle_get_32();
 				cnode->context_switch_intf->pause(cnode->obj);
+				record_node_time(nodeid, elapsed_us(node_start));
 			}
 		}
 	}
+	last_switch.pause_nodes = elapsed_us(start);
 }
 
 static void resume_scheduler_app(const stream_execution_context_t *context)
 {
+	// Nodes needing the queue of their graph after resume get it
+	// from cg_eventQueue while they are resumed
+	EventQueue::cg_eventQueue = static_cast<EventQueue *>(context->evtQueue);
+#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+	// FIFO memory is shared with the other graphs and may have been
+	// overwritten while this graph was paused.
+	uint32_t fifo_start = k_cycle_get_32();
+	context->reset_fifos(1);
+	last_switch.reset_fifos = elapsed_us(fifo_start);
+#endif
+	uint32_t start = k_cycle_get_32();
 	for (int32_t nodeid = 0; nodeid < (int32_t)context->nb_identified_nodes; nodeid++) {
 		CStreamNode *cnode = static_cast<CStreamNode *>(context->get_node_by_id(nodeid));
 
 		if (cnode != nullptr) {
 			// If the node implements the context switching interface, resume it
 			if ((cnode->obj != nullptr) && (cnode->context_switch_intf != nullptr)) {
+				uint32_t node_start = k_cycle_get_32();
 				cnode->context_switch_intf->resume(cnode->obj);
+				record_node_time(nodeid, elapsed_us(node_start));
 			}
 		}
 	}
+	last_switch.resume_nodes = elapsed_us(start);
+#if defined(CONFIG_STREAM_WARM_SWITCH)
+	uint32_t restore_start = k_cycle_get_32();
+	restore_node_states(context - contexts, context);
+	last_switch.restore_state = elapsed_us(restore_start);
+#endif
 }
 
 /*
@@ -239,6 +606,13 @@ static void *get_appc_node(int32_t nodeID)
 	return static_cast<void *>(get_scheduler_appc_node(nodeID));
 }
 
+#if defined(STREAM_APPB_PARTITIONED)
+static void *get_appb_p1_node(int32_t nodeID)
+{
+	return static_cast<void *>(get_scheduler_appb_p1_node(nodeID));
+}
+#endif
+
 #if DT_NODE_HAS_STATUS_OKAY(SW_NODE)
 static int config_button()
 {
@@ -283,7 +657,7 @@ static int config_touch()
 int main(void)
 {
 	int err;
-	EventQueue *queue_app[NB_APPS];
+	EventQueue *queue_app[NB_GRAPHS];
 
 	LOG_DBG("Starting main\n");
 
@@ -300,6 +674,10 @@ int main(void)
 
 	*/
 
+	// Audio playback is optional
+	k_mem_slab *spk_slab = nullptr;
+	const struct device *i2s_spk = nullptr;
+
 #if defined(CONFIG_I2S)
 	k_mem_slab *mem_slab = nullptr;
 	const struct device *i2s_mic = init_audio_source(&mem_slab);
@@ -313,6 +691,15 @@ int main(void)
 	const struct device *i2s_mic = nullptr;
 #endif
 
+#if defined(CONFIG_AUDIO_SINK)
+	i2s_spk = init_audio_sink(&spk_slab);
+
+	if (i2s_spk == nullptr) {
+		LOG_ERR("Error initializing audio sink\n");
+		goto error;
+	}
+#endif
+
 #if DT_NODE_HAS_STATUS_OKAY(SW_NODE)
 	err = config_button();
 	if (err != 0) {
@@ -405,11 +792,13 @@ int main(void)
 
 	/**
 	 * @brief Populate hardwareParams for each network
-	 * by setting the i2s_mic and mem_slab members.
+	 * by setting the i2s_mic, mem_slab, i2s_spk and spk_slab members.
 	 */
 	for (int network = 0; network < NB_APPS; network++) {
 		params[network]->i2s_mic = i2s_mic;
 		params[network]->mem_slab = mem_slab;
+		params[network]->i2s_spk = i2s_spk;
+		params[network]->spk_slab = spk_slab;
 	}
 
 	err = stream_init_memory();
@@ -418,8 +807,16 @@ int main(void)
 		goto error;
 	}
 
+#if defined(CONFIG_STREAM_GRAPH_ARENA)
+	for (int network = 0; network < NB_GRAPHS; network++) {
+		stream_arena_init(&arena_storage[network], arena_mem[network],
+				  CONFIG_STREAM_GRAPH_ARENA_SIZE);
+		arenas[network] = &arena_storage[network];
+	}
+#endif
+
 	/* Event queue init */
-	for (int network = 0; network < NB_APPS; network++) {
+	for (int network = 0; network < NB_GRAPHS; network++) {
 		queue_app[network] = stream_new_event_queue();
 
 		if (queue_app[network] == nullptr) {
@@ -430,31 +827,45 @@ int main(void)
 
 	// Init nodes
 #if 1
-	err = init_scheduler_appa(queue_app[0],&appaParams);
+	err = init_scheduler_appa(queue_app[0],&appaParams,arenas[0]);
 	if (err != CG_SUCCESS) {
 		LOG_ERR("Error: Failure during scheduler initialization for appa.\n");
 		goto error;
 	}
 
-	err = init_scheduler_appb(queue_app[1],&appbParams);
+	err = init_scheduler_appb(queue_app[1],&appbParams,arenas[1]);
 	if (err != CG_SUCCESS) {
 		LOG_ERR("Error: Failure during scheduler initialization for appb.\n");
 		goto error;
 	}
 
-	err = init_scheduler_appc(queue_app[2],&appcParams);
+	err = init_scheduler_appc(queue_app[2],&appcParams,arenas[2]);
 	if (err != CG_SUCCESS) {
 		LOG_ERR("Error: Failure during scheduler initialization for appc.\n");
 		goto error;
 	}
+
+#if defined(STREAM_APPB_PARTITIONED)
+	// The SPSC channels between appb and its partition are created
+	// by the first of the two graphs to be initialized
+	err = init_scheduler_appb_p1(queue_app[3],&appbParams,arenas[3]);
+	if (err != CG_SUCCESS) {
+		LOG_ERR("Error: Failure during scheduler initialization for appb_p1.\n");
+		goto error;
+	}
+#endif
 #else
-	err = init_scheduler_appc(queue_app[0], &appcParams);
+	err = init_scheduler_appc(queue_app[0], &appcParams, arenas[0]);
 	if (err != CG_SUCCESS) {
 		LOG_ERR("Error: Failure during scheduler initialization for appc.\n");
 		goto error;
 	}
 #endif
 
+	for (int network = 0; network < NB_GRAPHS; network++) {
+		log_arena_usage(network);
+	}
+
 	k_event_init(&cg_interruptEvent);
 
 	/* Thread inits */
@@ -502,6 +913,19 @@ int main(void)
 		.scheduler_length = STREAM_APPC_SCHED_LEN
 	};
 
+#if defined(STREAM_APPB_PARTITIONED)
+	contexts[3] = {
+		.dataflow_scheduler = scheduler_appb_p1,
+		.reset_fifos = reset_fifos_scheduler_appb_p1,
+		.pause_all_nodes = pause_scheduler_app,
+		.resume_all_nodes = resume_scheduler_app,
+		.get_node_by_id = get_appb_p1_node,
+		.evtQueue = queue_app[3],
+		.nb_identified_nodes = STREAM_APPB_P1_NB_IDENTIFIED_NODES,
+		.scheduler_length = STREAM_APPB_P1_SCHED_LEN
+	};
+#endif
+
 #else
 
 	contexts[0] = {.dataflow_scheduler = scheduler_appc,
@@ -529,16 +953,38 @@ int main(void)
 	it has to be done in each node with a state variable.
 
 	*/
+#if defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+	stream_runner_set_foreground(currentNetwork);
+	for (int network = 0; network < NB_GRAPHS; network++) {
+		resume_scheduler_app(&contexts[network]);
+		runners[network].context = &contexts[network];
+		runners[network].name = runner_names[network];
+		runners[network].graph = runner_networks[network];
+		runners[network].dataflow_priority = dataflow_priorities[network];
+		runners[network].event_priority = event_priorities[network];
+		if (stream_runner_start(&runners[network]) != 0) {
+			goto error;
+		}
+	}
+
+	for (int network = 0; network < NB_GRAPHS; network++) {
+		stream_runner_join(&runners[network]);
+	}
+#else
 	resume_scheduler_app(&contexts[currentNetwork]);
 	stream_start_threads(&contexts[currentNetwork]);
 
 	stream_wait_for_threads_end();
+#endif
 
 	free_scheduler_appa();
 	free_scheduler_appb();
 	free_scheduler_appc();
+#if defined(STREAM_APPB_PARTITIONED)
+	free_scheduler_appb_p1();
+#endif
 
-	for (int network = 0; network < NB_APPS; network++) {
+	for (int network = 0; network < NB_GRAPHS; network++) {
 		delete queue_app[network];
 	}
 
@@ -8,7 +8,9 @@ struct AppaParams appaParams = {
     // hw is common to all node and does not name a specific node
     .hw_ = {
         .i2s_mic = NULL, // To be set to the I2S device
-        .mem_slab = NULL // To be set to the memory slab
+        .mem_slab = NULL, // To be set to the memory slab
+        .i2s_spk = NULL, // To be set to the I2S playback device
+        .spk_slab = NULL // To be set to the playback memory slab
     },
     .classify = {
         .historyLength = 10, // Example value
@@ -16,5 +18,16 @@ struct AppaParams appaParams = {
     .kws = {
         .modelAddr = NULL, // To be set to the model address
         .modelSize = 0       // To be set to the model size
+    },
+    .agc = {
+        .version = 0,
+        .sampleRate = 16000.0f,
+        .targetLevel = -20.0f,
+        .ratio = 10.0f,
+        .minGain = -10.0f,
+        .maxGain = 30.0f,
+        .gateLevel = -60.0f,
+        .attackTime = 10.0f,
+        .releaseTime = 300.0f
     }
 };  
\ No newline at end of file
@@ -16,6 +16,8 @@ struct AppaParams
     struct hardwareParams hw_;
     struct classifyParams classify;
     struct tfliteNodeParams kws;
+    // Used when the graph is generated with the --agc option
+    struct agcParams agc;
 };
 
 extern struct AppaParams appaParams;
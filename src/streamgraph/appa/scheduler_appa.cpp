@@ -19,6 +19,8 @@ The support classes and code are covered by CMSIS-Stream license.
 #include "GenericNodes.hpp"
 #include "AppNodes_appa.hpp"
 #include "scheduler_appa.h"
+#include "StreamArena.hpp"
+#include "stream_fifo_overlay.h"
 #include "appa_extern_templates.hpp"
 
 #if !defined(CHECKERROR)
@@ -138,16 +140,28 @@ FIFO buffers
 #define FIFOSIZE6 320
 
 #define BUFFERSIZE0 2560
+#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+static uint8_t * const stream_appa_buf0 = stream_fifo_overlay + 0;
+#else
 CG_BEFORE_BUFFER
 uint8_t stream_appa_buf0[BUFFERSIZE0]={0};
+#endif
 
 #define BUFFERSIZE1 1280
+#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+static uint8_t * const stream_appa_buf1 = stream_fifo_overlay + 2560;
+#else
 CG_BEFORE_BUFFER
 uint8_t stream_appa_buf1[BUFFERSIZE1]={0};
+#endif
 
 #define BUFFERSIZE2 640
+#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+static uint8_t * const stream_appa_buf2 = stream_fifo_overlay + 3840;
+#else
 CG_BEFORE_BUFFER
 uint8_t stream_appa_buf2[BUFFERSIZE2]={0};
+#endif
 
 
 typedef struct {
@@ -179,6 +193,9 @@ static fifos_t fifos={0};
 
 static nodes_t nodes={0};
 
+// Arena used to allocate the FIFOs and nodes of the graph
+static struct stream_arena *graph_arena = nullptr;
+
 CStreamNode* get_scheduler_appa_node(int32_t nodeID)
 {
     if (nodeID >= STREAM_APPA_NB_IDENTIFIED_NODES)
@@ -192,42 +209,44 @@ CStreamNode* get_scheduler_appa_node(int32_t nodeID)
     return(&identifiedNodes[nodeID]);
 }
 
-int init_scheduler_appa(void *evtQueue_,AppaParams *params)
+int init_scheduler_appa(void *evtQueue_,AppaParams *params,struct stream_arena *arena)
 {
     EventQueue *evtQueue = reinterpret_cast<EventQueue *>(evtQueue_);
+    graph_arena = arena;
+    ArenaScope arenaScope(arena);
 
     CG_BEFORE_FIFO_INIT;
-    fifos.fifo0 = new (std::nothrow) FIFO<sq15,FIFOSIZE0,1,0>(stream_appa_buf1);
+    fifos.fifo0 = arena_new<FIFO<sq15,FIFOSIZE0,1,0>>(stream_appa_buf1);
     if (fifos.fifo0==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo1 = new (std::nothrow) FIFO<q15_t,FIFOSIZE1,1,0>(stream_appa_buf0);
+    fifos.fifo1 = arena_new<FIFO<q15_t,FIFOSIZE1,1,0>>(stream_appa_buf0);
     if (fifos.fifo1==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo2 = new (std::nothrow) FIFO<float,FIFOSIZE2,1,0>(stream_appa_buf1);
+    fifos.fifo2 = arena_new<FIFO<float,FIFOSIZE2,1,0>>(stream_appa_buf1);
     if (fifos.fifo2==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo3 = new (std::nothrow) FIFO<float,FIFOSIZE3,1,0>(stream_appa_buf0);
+    fifos.fifo3 = arena_new<FIFO<float,FIFOSIZE3,1,0>>(stream_appa_buf0);
     if (fifos.fifo3==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo4 = new (std::nothrow) FIFO<float,FIFOSIZE4,1,0>(stream_appa_buf1);
+    fifos.fifo4 = arena_new<FIFO<float,FIFOSIZE4,1,0>>(stream_appa_buf1);
     if (fifos.fifo4==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo5 = new (std::nothrow) FIFO<float,FIFOSIZE5,1,0>(stream_appa_buf0);
+    fifos.fifo5 = arena_new<FIFO<float,FIFOSIZE5,1,0>>(stream_appa_buf0);
     if (fifos.fifo5==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo6 = new (std::nothrow) FIFO<q15_t,FIFOSIZE6,1,0>(stream_appa_buf2);
+    fifos.fifo6 = arena_new<FIFO<q15_t,FIFOSIZE6,1,0>>(stream_appa_buf2);
     if (fifos.fifo6==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -236,7 +255,7 @@ int init_scheduler_appa(void *evtQueue_,AppaParams *params)
     CG_BEFORE_NODE_INIT;
     cg_status initError;
 
-    nodes.audioSource = new (std::nothrow) ZephyrAudioSource<sq15,320>(*(fifos.fifo0),params->hw_);
+    nodes.audioSource = arena_new<ZephyrAudioSource<sq15,320>>(*(fifos.fifo0),params->hw_);
     if (nodes.audioSource==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -244,7 +263,7 @@ int init_scheduler_appa(void *evtQueue_,AppaParams *params)
     identifiedNodes[STREAM_APPA_AUDIOSOURCE_ID]=createStreamNode(*nodes.audioSource);
     nodes.audioSource->setID(STREAM_APPA_AUDIOSOURCE_ID);
 
-    nodes.audioWin = new (std::nothrow) SlidingBuffer<float,640,320>(*(fifos.fifo2),*(fifos.fifo3));
+    nodes.audioWin = arena_new<SlidingBuffer<float,640,320>>(*(fifos.fifo2),*(fifos.fifo3));
     if (nodes.audioWin==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -252,19 +271,19 @@ int init_scheduler_appa(void *evtQueue_,AppaParams *params)
     identifiedNodes[STREAM_APPA_AUDIOWIN_ID]=createStreamNode(*nodes.audioWin);
     nodes.audioWin->setID(STREAM_APPA_AUDIOWIN_ID);
 
-    nodes.deinterleave = new (std::nothrow) DeinterleaveStereo<sq15,320,q15_t,320,q15_t,320>(*(fifos.fifo0),*(fifos.fifo1),*(fifos.fifo6));
+    nodes.deinterleave = arena_new<DeinterleaveStereo<sq15,320,q15_t,320,q15_t,320>>(*(fifos.fifo0),*(fifos.fifo1),*(fifos.fifo6));
     if (nodes.deinterleave==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.mfcc = new (std::nothrow) MFCC<float,640,float,10>(*(fifos.fifo3),*(fifos.fifo4));
+    nodes.mfcc = arena_new<MFCC<float,640,float,10>>(*(fifos.fifo3),*(fifos.fifo4));
     if (nodes.mfcc==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.mfccWin = new (std::nothrow) SlidingBuffer<float,490,480>(*(fifos.fifo4),*(fifos.fifo5));
+    nodes.mfccWin = arena_new<SlidingBuffer<float,490,480>>(*(fifos.fifo4),*(fifos.fifo5));
     if (nodes.mfccWin==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -272,13 +291,13 @@ int init_scheduler_appa(void *evtQueue_,AppaParams *params)
     identifiedNodes[STREAM_APPA_MFCCWIN_ID]=createStreamNode(*nodes.mfccWin);
     nodes.mfccWin->setID(STREAM_APPA_MFCCWIN_ID);
 
-    nodes.nullRight = new (std::nothrow) NullSink<q15_t,320>(*(fifos.fifo6),evtQueue);
+    nodes.nullRight = arena_new<NullSink<q15_t,320>>(*(fifos.fifo6),evtQueue);
     if (nodes.nullRight==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.send = new (std::nothrow) SendToNetwork<float,490>(*(fifos.fifo5),evtQueue);
+    nodes.send = arena_new<SendToNetwork<float,490>>(*(fifos.fifo5),evtQueue);
     if (nodes.send==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -286,13 +305,13 @@ int init_scheduler_appa(void *evtQueue_,AppaParams *params)
     identifiedNodes[STREAM_APPA_SEND_ID]=createStreamNode(*nodes.send);
     nodes.send->setID(STREAM_APPA_SEND_ID);
 
-    nodes.to_f32 = new (std::nothrow) Convert<q15_t,320,float,320>(*(fifos.fifo1),*(fifos.fifo2));
+    nodes.to_f32 = arena_new<Convert<q15_t,320,float,320>>(*(fifos.fifo1),*(fifos.fifo2));
     if (nodes.to_f32==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.classify = new (std::nothrow) KWSClassify(evtQueue,params->classify);
+    nodes.classify = arena_new<KWSClassify>(evtQueue,params->classify);
     if (nodes.classify==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -300,7 +319,7 @@ int init_scheduler_appa(void *evtQueue_,AppaParams *params)
     identifiedNodes[STREAM_APPA_CLASSIFY_ID]=createStreamNode(*nodes.classify);
     nodes.classify->setID(STREAM_APPA_CLASSIFY_ID);
 
-    nodes.display = new (std::nothrow) KWSDisplay(evtQueue);
+    nodes.display = arena_new<KWSDisplay>(evtQueue);
     if (nodes.display==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -308,7 +327,7 @@ int init_scheduler_appa(void *evtQueue_,AppaParams *params)
     identifiedNodes[STREAM_APPA_DISPLAY_ID]=createStreamNode(*nodes.display);
     nodes.display->setID(STREAM_APPA_DISPLAY_ID);
 
-    nodes.kws = new (std::nothrow) KWS(evtQueue,params->kws);
+    nodes.kws = arena_new<KWS>(evtQueue,params->kws);
     if (nodes.kws==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -377,77 +396,78 @@ void free_scheduler_appa()
 {
     if (fifos.fifo0!=NULL)
     {
-       delete fifos.fifo0;
+       arena_delete(graph_arena,fifos.fifo0);
     }
     if (fifos.fifo1!=NULL)
     {
-       delete fifos.fifo1;
+       arena_delete(graph_arena,fifos.fifo1);
     }
     if (fifos.fifo2!=NULL)
     {
-       delete fifos.fifo2;
+       arena_delete(graph_arena,fifos.fifo2);
     }
     if (fifos.fifo3!=NULL)
     {
-       delete fifos.fifo3;
+       arena_delete(graph_arena,fifos.fifo3);
     }
     if (fifos.fifo4!=NULL)
     {
-       delete fifos.fifo4;
+       arena_delete(graph_arena,fifos.fifo4);
     }
     if (fifos.fifo5!=NULL)
     {
-       delete fifos.fifo5;
+       arena_delete(graph_arena,fifos.fifo5);
     }
     if (fifos.fifo6!=NULL)
     {
-       delete fifos.fifo6;
+       arena_delete(graph_arena,fifos.fifo6);
     }
 
     if (nodes.audioSource!=NULL)
     {
-        delete nodes.audioSource;
+        arena_delete(graph_arena,nodes.audioSource);
     }
     if (nodes.audioWin!=NULL)
     {
-        delete nodes.audioWin;
+        arena_delete(graph_arena,nodes.audioWin);
     }
     if (nodes.deinterleave!=NULL)
     {
-        delete nodes.deinterleave;
+        arena_delete(graph_arena,nodes.deinterleave);
     }
     if (nodes.mfcc!=NULL)
     {
-        delete nodes.mfcc;
+        arena_delete(graph_arena,nodes.mfcc);
     }
     if (nodes.mfccWin!=NULL)
     {
-        delete nodes.mfccWin;
+        arena_delete(graph_arena,nodes.mfccWin);
     }
     if (nodes.nullRight!=NULL)
     {
-        delete nodes.nullRight;
+        arena_delete(graph_arena,nodes.nullRight);
     }
     if (nodes.send!=NULL)
     {
-        delete nodes.send;
+        arena_delete(graph_arena,nodes.send);
     }
     if (nodes.to_f32!=NULL)
     {
-        delete nodes.to_f32;
+        arena_delete(graph_arena,nodes.to_f32);
     }
     if (nodes.classify!=NULL)
     {
-        delete nodes.classify;
+        arena_delete(graph_arena,nodes.classify);
     }
     if (nodes.display!=NULL)
     {
-        delete nodes.display;
+        arena_delete(graph_arena,nodes.display);
     }
     if (nodes.kws!=NULL)
     {
-        delete nodes.kws;
+        arena_delete(graph_arena,nodes.kws);
     }
+    stream_arena_reset(graph_arena);
 }
 
 void reset_fifos_scheduler_appa(int all)
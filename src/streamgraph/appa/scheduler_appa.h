@@ -35,7 +35,7 @@ extern "C"
 
 extern CStreamNode* get_scheduler_appa_node(int32_t nodeID);
 
-extern int init_scheduler_appa(void *evtQueue_,AppaParams *params);
+extern int init_scheduler_appa(void *evtQueue_,AppaParams *params,struct stream_arena *arena);
 extern void free_scheduler_appa();
 extern uint32_t scheduler_appa(int *error);
 extern void reset_fifos_scheduler_appa(int all);
@@ -19,6 +19,8 @@ The support classes and code are covered by CMSIS-Stream license.
 #include "GenericNodes.hpp"
 #include "AppNodes_appb.hpp"
 #include "scheduler_appb.h"
+#include "StreamArena.hpp"
+#include "stream_fifo_overlay.h"
 #include "appb_extern_templates.hpp"
 
 #if !defined(CHECKERROR)
@@ -148,16 +150,28 @@ FIFO buffers
 #define FIFOSIZE12 1024
 
 #define BUFFERSIZE0 8192
+#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+static uint8_t * const stream_appb_buf0 = stream_fifo_overlay + 0;
+#else
 CG_BEFORE_BUFFER
 uint8_t stream_appb_buf0[BUFFERSIZE0]={0};
+#endif
 
 #define BUFFERSIZE1 8192
+#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+static uint8_t * const stream_appb_buf1 = stream_fifo_overlay + 8192;
+#else
 CG_BEFORE_BUFFER
 uint8_t stream_appb_buf1[BUFFERSIZE1]={0};
+#endif
 
 #define BUFFERSIZE2 8192
+#if defined(CONFIG_STREAM_FIFO_OVERLAY)
+static uint8_t * const stream_appb_buf2 = stream_fifo_overlay + 16384;
+#else
 CG_BEFORE_BUFFER
 uint8_t stream_appb_buf2[BUFFERSIZE2]={0};
+#endif
 
 
 typedef struct {
@@ -199,6 +213,9 @@ static fifos_t fifos={0};
 
 static nodes_t nodes={0};
 
+// Arena used to allocate the FIFOs and nodes of the graph
+static struct stream_arena *graph_arena = nullptr;
+
 CStreamNode* get_scheduler_appb_node(int32_t nodeID)
 {
     if (nodeID >= STREAM_APPB_NB_IDENTIFIED_NODES)
@@ -212,72 +229,74 @@ CStreamNode* get_scheduler_appb_node(int32_t nodeID)
     return(&identifiedNodes[nodeID]);
 }
 
-int init_scheduler_appb(void *evtQueue_,AppbParams *params)
+int init_scheduler_appb(void *evtQueue_,AppbParams *params,struct stream_arena *arena)
 {
     EventQueue *evtQueue = reinterpret_cast<EventQueue *>(evtQueue_);
+    graph_arena = arena;
+    ArenaScope arenaScope(arena);
 
     CG_BEFORE_FIFO_INIT;
-    fifos.fifo0 = new (std::nothrow) FIFO<sq15,FIFOSIZE0,1,0>(stream_appb_buf1);
+    fifos.fifo0 = arena_new<FIFO<sq15,FIFOSIZE0,1,0>>(stream_appb_buf1);
     if (fifos.fifo0==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo1 = new (std::nothrow) FIFO<sq15,FIFOSIZE1,1,0>(stream_appb_buf0);
+    fifos.fifo1 = arena_new<FIFO<sq15,FIFOSIZE1,1,0>>(stream_appb_buf0);
     if (fifos.fifo1==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo2 = new (std::nothrow) FIFO<sf32,FIFOSIZE2,1,0>(stream_appb_buf1);
+    fifos.fifo2 = arena_new<FIFO<sf32,FIFOSIZE2,1,0>>(stream_appb_buf1);
     if (fifos.fifo2==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo3 = new (std::nothrow) FIFO<float,FIFOSIZE3,1,0>(stream_appb_buf2);
+    fifos.fifo3 = arena_new<FIFO<float,FIFOSIZE3,1,0>>(stream_appb_buf2);
     if (fifos.fifo3==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo4 = new (std::nothrow) FIFO<float,FIFOSIZE4,1,0>(stream_appb_buf1);
+    fifos.fifo4 = arena_new<FIFO<float,FIFOSIZE4,1,0>>(stream_appb_buf1);
     if (fifos.fifo4==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo5 = new (std::nothrow) FIFO<float,FIFOSIZE5,1,0>(stream_appb_buf2);
+    fifos.fifo5 = arena_new<FIFO<float,FIFOSIZE5,1,0>>(stream_appb_buf2);
     if (fifos.fifo5==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo6 = new (std::nothrow) FIFO<cf32,FIFOSIZE6,1,0>(stream_appb_buf1);
+    fifos.fifo6 = arena_new<FIFO<cf32,FIFOSIZE6,1,0>>(stream_appb_buf1);
     if (fifos.fifo6==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo7 = new (std::nothrow) FIFO<cf32,FIFOSIZE7,1,0>(stream_appb_buf2);
+    fifos.fifo7 = arena_new<FIFO<cf32,FIFOSIZE7,1,0>>(stream_appb_buf2);
     if (fifos.fifo7==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo8 = new (std::nothrow) FIFO<float,FIFOSIZE8,1,0>(stream_appb_buf0);
+    fifos.fifo8 = arena_new<FIFO<float,FIFOSIZE8,1,0>>(stream_appb_buf0);
     if (fifos.fifo8==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo9 = new (std::nothrow) FIFO<float,FIFOSIZE9,1,0>(stream_appb_buf1);
+    fifos.fifo9 = arena_new<FIFO<float,FIFOSIZE9,1,0>>(stream_appb_buf1);
     if (fifos.fifo9==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo10 = new (std::nothrow) FIFO<float,FIFOSIZE10,1,0>(stream_appb_buf0);
+    fifos.fifo10 = arena_new<FIFO<float,FIFOSIZE10,1,0>>(stream_appb_buf0);
     if (fifos.fifo10==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo11 = new (std::nothrow) FIFO<cf32,FIFOSIZE11,1,0>(stream_appb_buf1);
+    fifos.fifo11 = arena_new<FIFO<cf32,FIFOSIZE11,1,0>>(stream_appb_buf1);
     if (fifos.fifo11==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
-    fifos.fifo12 = new (std::nothrow) FIFO<cf32,FIFOSIZE12,1,0>(stream_appb_buf0);
+    fifos.fifo12 = arena_new<FIFO<cf32,FIFOSIZE12,1,0>>(stream_appb_buf0);
     if (fifos.fifo12==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -286,7 +305,7 @@ int init_scheduler_appb(void *evtQueue_,AppbParams *params)
     CG_BEFORE_NODE_INIT;
     cg_status initError;
 
-    nodes.audio = new (std::nothrow) ZephyrAudioSource<sq15,320>(*(fifos.fifo0),params->hw_);
+    nodes.audio = arena_new<ZephyrAudioSource<sq15,320>>(*(fifos.fifo0),params->hw_);
     if (nodes.audio==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -294,7 +313,7 @@ int init_scheduler_appb(void *evtQueue_,AppbParams *params)
     identifiedNodes[STREAM_APPB_AUDIO_ID]=createStreamNode(*nodes.audio);
     nodes.audio->setID(STREAM_APPB_AUDIO_ID);
 
-    nodes.audioWinLeft = new (std::nothrow) SlidingBuffer<float,640,320>(*(fifos.fifo3),*(fifos.fifo4));
+    nodes.audioWinLeft = arena_new<SlidingBuffer<float,640,320>>(*(fifos.fifo3),*(fifos.fifo4));
     if (nodes.audioWinLeft==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -302,7 +321,7 @@ int init_scheduler_appb(void *evtQueue_,AppbParams *params)
     identifiedNodes[STREAM_APPB_AUDIOWINLEFT_ID]=createStreamNode(*nodes.audioWinLeft);
     nodes.audioWinLeft->setID(STREAM_APPB_AUDIOWINLEFT_ID);
 
-    nodes.audioWinRight = new (std::nothrow) SlidingBuffer<float,640,320>(*(fifos.fifo8),*(fifos.fifo9));
+    nodes.audioWinRight = arena_new<SlidingBuffer<float,640,320>>(*(fifos.fifo8),*(fifos.fifo9));
     if (nodes.audioWinRight==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -310,73 +329,73 @@ int init_scheduler_appb(void *evtQueue_,AppbParams *params)
     identifiedNodes[STREAM_APPB_AUDIOWINRIGHT_ID]=createStreamNode(*nodes.audioWinRight);
     nodes.audioWinRight->setID(STREAM_APPB_AUDIOWINRIGHT_ID);
 
-    nodes.deinterleave = new (std::nothrow) DeinterleaveStereo<sf32,320,float,320,float,320>(*(fifos.fifo2),*(fifos.fifo3),*(fifos.fifo8));
+    nodes.deinterleave = arena_new<DeinterleaveStereo<sf32,320,float,320,float,320>>(*(fifos.fifo2),*(fifos.fifo3),*(fifos.fifo8));
     if (nodes.deinterleave==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.fftLeft = new (std::nothrow) CFFT<cf32,1024,cf32,1024>(*(fifos.fifo6),*(fifos.fifo7));
+    nodes.fftLeft = arena_new<CFFT<cf32,1024,cf32,1024>>(*(fifos.fifo6),*(fifos.fifo7));
     if (nodes.fftLeft==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.fftRight = new (std::nothrow) CFFT<cf32,1024,cf32,1024>(*(fifos.fifo11),*(fifos.fifo12));
+    nodes.fftRight = arena_new<CFFT<cf32,1024,cf32,1024>>(*(fifos.fifo11),*(fifos.fifo12));
     if (nodes.fftRight==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.gain = new (std::nothrow) Gain<sq15,320,sq15,320>(*(fifos.fifo0),*(fifos.fifo1),4);
+    nodes.gain = arena_new<Gain<sq15,320,sq15,320>>(*(fifos.fifo0),*(fifos.fifo1),4);
     if (nodes.gain==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.spectrogramLeft = new (std::nothrow) Spectrogram<cf32,1024>(*(fifos.fifo7),evtQueue);
+    nodes.spectrogramLeft = arena_new<Spectrogram<cf32,1024>>(*(fifos.fifo7),evtQueue);
     if (nodes.spectrogramLeft==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.spectrogramRight = new (std::nothrow) Spectrogram<cf32,1024>(*(fifos.fifo12),evtQueue);
+    nodes.spectrogramRight = arena_new<Spectrogram<cf32,1024>>(*(fifos.fifo12),evtQueue);
     if (nodes.spectrogramRight==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.toComplexLeft = new (std::nothrow) RealToComplex<float,1024,cf32,1024>(*(fifos.fifo5),*(fifos.fifo6));
+    nodes.toComplexLeft = arena_new<RealToComplex<float,1024,cf32,1024>>(*(fifos.fifo5),*(fifos.fifo6));
     if (nodes.toComplexLeft==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.toComplexRight = new (std::nothrow) RealToComplex<float,1024,cf32,1024>(*(fifos.fifo10),*(fifos.fifo11));
+    nodes.toComplexRight = arena_new<RealToComplex<float,1024,cf32,1024>>(*(fifos.fifo10),*(fifos.fifo11));
     if (nodes.toComplexRight==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.to_f32 = new (std::nothrow) Convert<sq15,320,sf32,320>(*(fifos.fifo1),*(fifos.fifo2));
+    nodes.to_f32 = arena_new<Convert<sq15,320,sf32,320>>(*(fifos.fifo1),*(fifos.fifo2));
     if (nodes.to_f32==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.winLeft = new (std::nothrow) Hanning<float,640,float,1024>(*(fifos.fifo4),*(fifos.fifo5));
+    nodes.winLeft = arena_new<Hanning<float,640,float,1024>>(*(fifos.fifo4),*(fifos.fifo5));
     if (nodes.winLeft==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.winRight = new (std::nothrow) Hanning<float,640,float,1024>(*(fifos.fifo9),*(fifos.fifo10));
+    nodes.winRight = arena_new<Hanning<float,640,float,1024>>(*(fifos.fifo9),*(fifos.fifo10));
     if (nodes.winRight==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
     }
 
-    nodes.display = new (std::nothrow) SpectrogramDisplay;
+    nodes.display = arena_new<SpectrogramDisplay>();
     if (nodes.display==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -461,117 +480,118 @@ void free_scheduler_appb()
 {
     if (fifos.fifo0!=NULL)
     {
-       delete fifos.fifo0;
+       arena_delete(graph_arena,fifos.fifo0);
     }
     if (fifos.fifo1!=NULL)
     {
-       delete fifos.fifo1;
+       arena_delete(graph_arena,fifos.fifo1);
     }
     if (fifos.fifo2!=NULL)
     {
-       delete fifos.fifo2;
+       arena_delete(graph_arena,fifos.fifo2);
     }
     if (fifos.fifo3!=NULL)
     {
-       delete fifos.fifo3;
+       arena_delete(graph_arena,fifos.fifo3);
     }
     if (fifos.fifo4!=NULL)
     {
-       delete fifos.fifo4;
+       arena_delete(graph_arena,fifos.fifo4);
     }
     if (fifos.fifo5!=NULL)
     {
-       delete fifos.fifo5;
+       arena_delete(graph_arena,fifos.fifo5);
     }
     if (fifos.fifo6!=NULL)
     {
-       delete fifos.fifo6;
+       arena_delete(graph_arena,fifos.fifo6);
     }
     if (fifos.fifo7!=NULL)
     {
-       delete fifos.fifo7;
+       arena_delete(graph_arena,fifos.fifo7);
     }
     if (fifos.fifo8!=NULL)
     {
-       delete fifos.fifo8;
+       arena_delete(graph_arena,fifos.fifo8);
     }
     if (fifos.fifo9!=NULL)
     {
-       delete fifos.fifo9;
+       arena_delete(graph_arena,fifos.fifo9);
     }
     if (fifos.fifo10!=NULL)
     {
-       delete fifos.fifo10;
+       arena_delete(graph_arena,fifos.fifo10);
     }
     if (fifos.fifo11!=NULL)
     {
-       delete fifos.fifo11;
+       arena_delete(graph_arena,fifos.fifo11);
     }
     if (fifos.fifo12!=NULL)
     {
-       delete fifos.fifo12;
+       arena_delete(graph_arena,fifos.fifo12);
     }
 
     if (nodes.audio!=NULL)
     {
-        delete nodes.audio;
+        arena_delete(graph_arena,nodes.audio);
     }
     if (nodes.audioWinLeft!=NULL)
     {
-        delete nodes.audioWinLeft;
+        arena_delete(graph_arena,nodes.audioWinLeft);
     }
     if (nodes.audioWinRight!=NULL)
     {
-        delete nodes.audioWinRight;
+        arena_delete(graph_arena,nodes.audioWinRight);
     }
     if (nodes.deinterleave!=NULL)
     {
-        delete nodes.deinterleave;
+        arena_delete(graph_arena,nodes.deinterleave);
     }
     if (nodes.fftLeft!=NULL)
     {
-        delete nodes.fftLeft;
+        arena_delete(graph_arena,nodes.fftLeft);
     }
     if (nodes.fftRight!=NULL)
     {
-        delete nodes.fftRight;
+        arena_delete(graph_arena,nodes.fftRight);
     }
     if (nodes.gain!=NULL)
     {
-        delete nodes.gain;
+        arena_delete(graph_arena,nodes.gain);
     }
     if (nodes.spectrogramLeft!=NULL)
     {
-        delete nodes.spectrogramLeft;
+        arena_delete(graph_arena,nodes.spectrogramLeft);
     }
     if (nodes.spectrogramRight!=NULL)
     {
-        delete nodes.spectrogramRight;
+        arena_delete(graph_arena,nodes.spectrogramRight);
     }
     if (nodes.toComplexLeft!=NULL)
     {
-        delete nodes.toComplexLeft;
+        arena_delete(graph_arena,nodes.toComplexLeft);
     }
     if (nodes.toComplexRight!=NULL)
     {
-        delete nodes.toComplexRight;
+        arena_delete(graph_arena,nodes.toComplexRight);
     }
     if (nodes.to_f32!=NULL)
     {
-        delete nodes.to_f32;
+        arena_delete(graph_arena,nodes.to_f32);
     }
     if (nodes.winLeft!=NULL)
     {
-        delete nodes.winLeft;
+        arena_delete(graph_arena,nodes.winLeft);
     }
     if (nodes.winRight!=NULL)
     {
-        delete nodes.winRight;
+        arena_delete(graph_arena,nodes.winRight);
     }
     if (nodes.display!=NULL)
     {
-        delete nodes.display;
+        arena_delete(graph_arena,nodes.display);
     }
+    stream_arena_reset(graph_arena);
 }
 
 void reset_fifos_scheduler_appb(int all)
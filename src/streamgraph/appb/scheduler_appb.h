@@ -33,7 +33,7 @@ extern "C"
 
 extern CStreamNode* get_scheduler_appb_node(int32_t nodeID);
 
-extern int init_scheduler_appb(void *evtQueue_,AppbParams *params);
+extern int init_scheduler_appb(void *evtQueue_,AppbParams *params,struct stream_arena *arena);
 extern void free_scheduler_appb();
 extern uint32_t scheduler_appb(int *error);
 extern void reset_fifos_scheduler_appb(int all);
@@ -1,2 +1,3 @@
 #include "appnodes/CameraFrame.hpp"
+#include "nodes/FrameMailbox.hpp"
 #include "nodes/ZephyrDebugVideoSource.hpp"
@@ -5,6 +5,8 @@
 struct AppcParams appcParams = {
     .hw_ = {
         .i2s_mic = NULL, // To be set to the I2S device
-        .mem_slab = NULL // To be set to the memory slab
+        .mem_slab = NULL, // To be set to the memory slab
+        .i2s_spk = NULL, // To be set to the I2S playback device
+        .spk_slab = NULL // To be set to the playback memory slab
     }
 }; 
\ No newline at end of file
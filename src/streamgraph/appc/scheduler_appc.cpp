@@ -19,6 +19,8 @@ The support classes and code are covered by CMSIS-Stream license.
 #include "GenericNodes.hpp"
 #include "AppNodes_appc.hpp"
 #include "scheduler_appc.h"
+#include "StreamArena.hpp"
+#include "stream_fifo_overlay.h"
 #include "appc_extern_templates.hpp"
 
 #if !defined(CHECKERROR)
@@ -99,7 +101,8 @@ Internal ID identification for the nodes
 
 */
 #define LCD_INTERNAL_ID 0
-#define VIDEO_INTERNAL_ID 1
+#define MAILBOX_INTERNAL_ID 1
+#define VIDEO_INTERNAL_ID 2
 
 
 
@@ -121,6 +124,7 @@ FIFO buffers
 
 typedef struct {
     CameraFrame *lcd;
+    FrameMailbox *mailbox;
     ZephyrDebugVideoSource *video;
 } nodes_t;
 
@@ -128,6 +132,9 @@ typedef struct {
 
 static nodes_t nodes={0};
 
+// Arena used to allocate the FIFOs and nodes of the graph
+static struct stream_arena *graph_arena = nullptr;
+
 CStreamNode* get_scheduler_appc_node(int32_t nodeID)
 {
     if (nodeID >= STREAM_APPC_NB_IDENTIFIED_NODES)
@@ -141,16 +148,18 @@ CStreamNode* get_scheduler_appc_node(int32_t nodeID)
     return(&identifiedNodes[nodeID]);
 }
 
-int init_scheduler_appc(void *evtQueue_,AppcParams *params)
+int init_scheduler_appc(void *evtQueue_,AppcParams *params,struct stream_arena *arena)
 {
     EventQueue *evtQueue = reinterpret_cast<EventQueue *>(evtQueue_);
+    graph_arena = arena;
+    ArenaScope arenaScope(arena);
 
     CG_BEFORE_FIFO_INIT;
 
     CG_BEFORE_NODE_INIT;
     cg_status initError;
 
-    nodes.lcd = new (std::nothrow) CameraFrame;
+    nodes.lcd = arena_new<CameraFrame>(evtQueue);
     if (nodes.lcd==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -158,7 +167,15 @@ int init_scheduler_appc(void *evtQueue_,AppcParams *params)
     identifiedNodes[STREAM_APPC_LCD_ID]=createStreamNode(*nodes.lcd);
     nodes.lcd->setID(STREAM_APPC_LCD_ID);
 
-    nodes.video = new (std::nothrow) ZephyrDebugVideoSource(evtQueue);
+    nodes.mailbox = arena_new<FrameMailbox>(evtQueue,1);
+    if (nodes.mailbox==NULL)
+    {
+        return(CG_MEMORY_ALLOCATION_FAILURE);
+    }
+    identifiedNodes[STREAM_APPC_MAILBOX_ID]=createStreamNode(*nodes.mailbox);
+    nodes.mailbox->setID(STREAM_APPC_MAILBOX_ID);
+
+    nodes.video = arena_new<ZephyrDebugVideoSource>(evtQueue);
     if (nodes.video==NULL)
     {
         return(CG_MEMORY_ALLOCATION_FAILURE);
@@ -168,13 +185,19 @@ int init_scheduler_appc(void *evtQueue_,AppcParams *params)
 
 
 /* Subscribe nodes for the event system*/
-    nodes.video->subscribe(0,*nodes.lcd,0);
+    nodes.lcd->subscribe(0,*nodes.mailbox,1);
+    nodes.mailbox->subscribe(0,*nodes.lcd,0);
+    nodes.video->subscribe(0,*nodes.mailbox,0);
 
     initError = CG_SUCCESS;
     initError = nodes.lcd->init();
     if (initError != CG_SUCCESS)
         return(initError);
     
+    initError = nodes.mailbox->init();
+    if (initError != CG_SUCCESS)
+        return(initError);
+    
     initError = nodes.video->init();
     if (initError != CG_SUCCESS)
         return(initError);
@@ -191,12 +214,17 @@ void free_scheduler_appc()
 
     if (nodes.lcd!=NULL)
     {
-        delete nodes.lcd;
+        arena_delete(graph_arena,nodes.lcd);
+    }
+    if (nodes.mailbox!=NULL)
+    {
+        arena_delete(graph_arena,nodes.mailbox);
     }
     if (nodes.video!=NULL)
     {
-        delete nodes.video;
+        arena_delete(graph_arena,nodes.video);
     }
+    stream_arena_reset(graph_arena);
 }
 
 void reset_fifos_scheduler_appc(int all)
@@ -22,16 +22,17 @@ extern "C"
 
 
 /* Node identifiers */
-#define STREAM_APPC_NB_IDENTIFIED_NODES 2
+#define STREAM_APPC_NB_IDENTIFIED_NODES 3
 #define STREAM_APPC_LCD_ID 0
-#define STREAM_APPC_VIDEO_ID 1
+#define STREAM_APPC_MAILBOX_ID 1
+#define STREAM_APPC_VIDEO_ID 2
 
 #define STREAM_APPC_SCHED_LEN 0
 
 
 extern CStreamNode* get_scheduler_appc_node(int32_t nodeID);
 
-extern int init_scheduler_appc(void *evtQueue_,AppcParams *params);
+extern int init_scheduler_appc(void *evtQueue_,AppcParams *params,struct stream_arena *arena);
 extern void free_scheduler_appc();
 extern uint32_t scheduler_appc(int *error);
 extern void reset_fifos_scheduler_appc(int all);
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "EventQueue.hpp"
+#include "StreamNode.hpp"
+
+/**
+ * @brief Table based dispatch of the events received by a node
+ *
+ * The processEvent of a node was a chain of evt.wellFormed<T>() checks.
+ * When several checks can match the same event, the event is processed
+ * several times. With EventDispatch, the handlers of a node are described
+ * by a table checked at compile time:
+ *
+ *     void processEvent(int dstPort, Event &&evt) final override
+ *     {
+ *         using Dispatch = EventDispatch<
+ *             EventHandler<0, kValue, TensorPtr<float>, &MyNode::processTensor>,
+ *             EventHandler<kAnyPort, kDo, void, &MyNode::redraw>,
+ *             EventHandler<1, kAnyEvent, void, &MyNode::ack>>;
+ *         Dispatch::dispatch(*this, dstPort, std::move(evt));
+ *     }
+ *
+ * The table is declared in processEvent where the node class is complete
+ * so that the handlers can be declared anywhere in the class.
+ *
+ * - The port and the event id are compared first. The payload type is
+ *   only checked for the entries matching both
+ * - The first matching entry is the only one called: an event is never
+ *   processed twice
+ * - Two entries with the same port, event id and payload are a compile
+ *   time error
+ *
+ * A handler has one of the signatures:
+ *
+ *     void f(T value)   or   void f(int dstPort, T value)
+ *
+ * where T can also be T&& or const T&. With a void payload, the handler
+ * has no value argument (the payload of the event is ignored).
+ */
+
+constexpr int kAnyPort = -1;
+constexpr int kAnyEvent = -1;
+
+template <int Port, int EventId, typename T, auto Handler>
+struct EventHandler
+{
+    static constexpr int port = Port;
+    static constexpr int eventId = EventId;
+    using payload = T;
+
+    template <typename Node>
+    static bool tryDispatch(Node &node, int dstPort, arm_cmsis_stream::Event &evt)
+    {
+        if constexpr (Port != kAnyPort)
+        {
+            if (dstPort != Port)
+            {
+                return false;
+            }
+        }
+        if constexpr (EventId != kAnyEvent)
+        {
+            if (evt.event_id != EventId)
+            {
+                return false;
+            }
+        }
+
+        if constexpr (std::is_void_v<T>)
+        {
+            if constexpr (std::is_invocable_v<decltype(Handler), Node &, int>)
+            {
+                (node.*Handler)(dstPort);
+            }
+            else
+            {
+                (node.*Handler)();
+            }
+        }
+        else
+        {
+            if (!evt.wellFormed<T>())
+            {
+                return false;
+            }
+            if constexpr (std::is_invocable_v<decltype(Handler), Node &, int, T &&>)
+            {
+                (node.*Handler)(dstPort, std::move(evt.get<T>()));
+            }
+            else
+            {
+                (node.*Handler)(std::move(evt.get<T>()));
+            }
+        }
+        return true;
+    }
+};
+
+namespace event_dispatch_detail
+{
+template <typename A, typename B>
+constexpr bool same_entry()
+{
+    return (A::port == B::port) && (A::eventId == B::eventId) &&
+           std::is_same_v<typename A::payload, typename B::payload>;
+}
+
+template <typename... Handlers>
+struct unique_entries : std::true_type
+{
+};
+
+template <typename First, typename... Others>
+struct unique_entries<First, Others...>
+    : std::bool_constant<!(same_entry<First, Others>() || ...) &&
+                         unique_entries<Others...>::value>
+{
+};
+} // namespace event_dispatch_detail
+
+template <typename... Handlers>
+struct EventDispatch
+{
+    static_assert(event_dispatch_detail::unique_entries<Handlers...>::value,
+                  "The same event is handled twice");
+
+    // Return false if the event was not handled
+    template <typename Node>
+    static bool dispatch(Node &node, int dstPort, arm_cmsis_stream::Event &&evt)
+    {
+        return (Handlers::tryDispatch(node, dstPort, evt) || ...);
+    }
+};
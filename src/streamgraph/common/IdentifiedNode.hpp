@@ -34,6 +34,7 @@ extern "C" {
 /**
  * @brief Template function to create a CStreamNode from a C++ object
  * This function checks at compile time if the object implements the StreamNode and/or ContextSwitch interfaces
+ * (and the optional state save / restore of WarmContextSwitch)
  * and fills the corresponding interface pointers in the CStreamNode structure.
  * If the object does not implement a given interface, the corresponding pointer is set to NULL.
  */
@@ -64,7 +65,7 @@ CStreamNode createStreamNode(T &obj)
         stream_intf_current = &stream_intf;
     }
 
-    if constexpr (std::is_base_of<ContextSwitch, T>::value)
+    if constexpr (std::is_base_of<WarmContextSwitch, T>::value)
     {
         static const ContextSwitchInterface context_switch_intf = {
             [](void *self) -> int {
@@ -72,10 +73,34 @@ CStreamNode createStreamNode(T &obj)
             },
             [](void *self) -> int {
                 return(static_cast<T *>(self)->resume());
+            },
+            [](const void *self) -> size_t {
+                return(static_cast<const T *>(self)->stateSize());
+            },
+            [](const void *self, void *blob, size_t size) -> int {
+                return(static_cast<const T *>(self)->saveState(blob, size));
+            },
+            [](void *self, const void *blob, size_t size) -> int {
+                return(static_cast<T *>(self)->restoreState(blob, size));
             }
         };
         context_switch_intf_current = &context_switch_intf;
     }
+    else if constexpr (std::is_base_of<ContextSwitch, T>::value)
+    {
+        static const ContextSwitchInterface context_switch_intf = {
+            [](void *self) -> int {
+                return(static_cast<T *>(self)->pause());
+            },
+            [](void *self) -> int {
+                return(static_cast<T *>(self)->resume());
+            },
+            nullptr,
+            nullptr,
+            nullptr
+        };
+        context_switch_intf_current = &context_switch_intf;
+    }
 
     return CStreamNode {&obj,stream_intf_current,context_switch_intf_current};
     
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+extern "C" {
+   #include "stream_arena.h"
+}
+
+#include <new>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief C++ helpers to allocate graph objects from a stream_arena
+ *
+ * The generated init_scheduler_* functions create an ArenaScope at the
+ * beginning. All FIFOs and nodes created during the initialization of the
+ * graph are then allocated from the arena of the graph. Node constructors
+ * can also allocate their buffers from the same arena with ArenaBuffer.
+ *
+ * If there is no current arena or if the arena is full, the memory is
+ * allocated from the heap so a graph can still be used without an arena.
+ *
+ * Graphs can be initialized from several threads (one per runner): a
+ * scope holds stream_arena_scope_lock until it is destroyed, and the
+ * arena is only current for the thread that created the scope.
+ */
+extern struct k_mutex stream_arena_scope_lock;
+
+class ArenaScope
+{
+  public:
+    explicit ArenaScope(struct stream_arena *arena)
+    {
+        // Recursive for the nested scopes of a thread
+        k_mutex_lock(&stream_arena_scope_lock, K_FOREVER);
+        previous_ = current_;
+        previousOwner_ = owner_;
+        current_ = arena;
+        owner_ = k_current_get();
+    }
+
+    ~ArenaScope()
+    {
+        current_ = previous_;
+        owner_ = previousOwner_;
+        k_mutex_unlock(&stream_arena_scope_lock);
+    }
+
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+
+    // nullptr (heap) for the threads outside of a scope
+    static struct stream_arena *current()
+    {
+        return (owner_ == k_current_get()) ? current_ : nullptr;
+    }
+
+  private:
+    struct stream_arena *previous_;
+    k_tid_t previousOwner_;
+    static inline struct stream_arena *current_ = nullptr;
+    static inline k_tid_t owner_ = nullptr;
+};
+
+/**
+ * @brief Create an object in the current arena (or heap)
+ * Replaces new (std::nothrow) in the generated schedulers.
+ */
+template <typename T, typename... Args>
+T *arena_new(Args &&...args)
+{
+    void *mem = stream_arena_alloc(ArenaScope::current(), sizeof(T), alignof(T));
+    if (mem == nullptr)
+    {
+        return new (std::nothrow) T(std::forward<Args>(args)...);
+    }
+    return new (mem) T(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Destroy an object created with arena_new
+ * The memory is given back to the arena only when the arena is reset.
+ */
+template <typename T>
+void arena_delete(struct stream_arena *arena, T *obj)
+{
+    if (obj == nullptr)
+    {
+        return;
+    }
+    if (stream_arena_contains(arena, obj))
+    {
+        obj->~T();
+    }
+    else
+    {
+        delete obj;
+    }
+}
+
+/**
+ * @brief Buffer owned by a node and allocated from the current arena
+ * when the node is created.
+ * It falls back to the heap if there is no arena. When the heap is also
+ * full, the buffer is empty: the node must check allocated() in init()
+ * and return CG_MEMORY_ALLOCATION_FAILURE.
+ * Only trivially destructible types are supported.
+ */
+template <typename T>
+class ArenaBuffer
+{
+  public:
+    ArenaBuffer() = default;
+
+    explicit ArenaBuffer(size_t nb)
+    {
+        allocate(nb);
+    }
+
+    ~ArenaBuffer()
+    {
+        release();
+    }
+
+    ArenaBuffer(const ArenaBuffer &) = delete;
+    ArenaBuffer &operator=(const ArenaBuffer &) = delete;
+
+    bool allocate(size_t nb)
+    {
+        release();
+        data_ = static_cast<T *>(stream_arena_alloc(ArenaScope::current(), nb * sizeof(T), alignof(T) < 16 ? 16 : alignof(T)));
+        if (data_ == nullptr)
+        {
+            data_ = new (std::nothrow) T[nb];
+            fromHeap_ = true;
+        }
+        nb_ = (data_ != nullptr) ? nb : 0;
+        return (data_ != nullptr);
+    }
+
+    bool allocated() const
+    {
+        return (data_ != nullptr);
+    }
+
+    T *data()
+    {
+        return data_;
+    }
+
+    const T *data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return nb_;
+    }
+
+    T &operator[](size_t i)
+    {
+        return data_[i];
+    }
+
+    const T &operator[](size_t i) const
+    {
+        return data_[i];
+    }
+
+  protected:
+    void release()
+    {
+        if (fromHeap_)
+        {
+            delete[] data_;
+        }
+        data_ = nullptr;
+        nb_ = 0;
+        fromHeap_ = false;
+    }
+
+    T *data_{nullptr};
+    size_t nb_{0};
+    bool fromHeap_{false};
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Static storage for the FIFOs and nodes of a graph
+ *
+ * Used by the schedulers generated with the static allocation mode
+ * (static_allocation in python/postprocess.py). Each FIFO and node has
+ * its own storage reserved at link time in the scheduler file.
+ * The objects are constructed in place in init_scheduler_* and
+ * destroyed in free_scheduler_*. There is no allocation failure and the
+ * RAM used by a graph is visible in the map file.
+ */
+template <typename T>
+struct StaticStorage
+{
+    alignas(T) uint8_t mem[sizeof(T)];
+};
+
+/**
+ * @brief Construct an object in its static storage
+ * Replaces new (std::nothrow) in the generated schedulers.
+ */
+template <typename T, typename... Args>
+T *static_new(StaticStorage<T> &storage, Args &&...args)
+{
+    return new (storage.mem) T(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Destroy an object created with static_new
+ */
+template <typename T>
+void static_delete(T *obj)
+{
+    if (obj != nullptr)
+    {
+        obj->~T();
+    }
+}
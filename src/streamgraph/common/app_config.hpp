@@ -29,25 +29,38 @@ extern struct k_event cg_streamEvent;
 
 // Because memory optimization is enabled in Python scripts, the alignment is NEEDED
 //
-// To use a memory overlay for the graph FIFOs, the section must be different for each graph
-// Python scripts can be customized so that each generated scheduler includes a different
-// configuration file where the macro could have different definitions
+// When CONFIG_STREAM_FIFO_OVERLAY is enabled, the FIFO buffers of the graphs
+// are not defined with CG_BEFORE_BUFFER. They are pointers into the
+// stream_fifo_overlay region shared by all the graphs (see stream_fifo_overlay.h).
+// Only one graph is running at a given time so the memory used is the max
+// of the graphs instead of the sum.
 #define CG_BEFORE_BUFFER __aligned(16)__attribute__((section(".alif_sram0.stream_fifo"))) 
 
+#define CG_FIFO_OVERLAY_BUFFER __aligned(16)__attribute__((section(".alif_sram0.stream_fifo")))
+
+// When the graphs are run concurrently, each dataflow thread has its
+// own control event (see stream_runner.hpp)
+#if defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+#include "stream_runner.hpp"
+#define STREAM_CONTROL_EVENT stream_runner_control_event()
+#else
+#define STREAM_CONTROL_EVENT (&cg_streamEvent)
+#endif
+
 #define CG_BEFORE_NODE_EXECUTION(id)                                              \
     {                                                                             \
         uint32_t res =                                                            \
-            k_event_wait(&cg_streamEvent, STREAM_PAUSE_EVENT | STREAM_DONE_EVENT, \
+            k_event_wait(STREAM_CONTROL_EVENT, STREAM_PAUSE_EVENT | STREAM_DONE_EVENT,  \
                      false, K_NO_WAIT);                                           \
         if ((res & STREAM_DONE_EVENT) != 0)                                       \
         {                                                                         \
-            k_event_clear(&cg_streamEvent, STREAM_DONE_EVENT);                    \
+            k_event_clear(STREAM_CONTROL_EVENT, STREAM_DONE_EVENT);               \
             cgStaticError = CG_STOP_SCHEDULER;                                    \
             goto errorHandling;                                                   \
         }                                                                         \
         if ((res & STREAM_PAUSE_EVENT) != 0)                                      \
         {                                                                         \
-            k_event_clear(&cg_streamEvent, STREAM_PAUSE_EVENT);                   \
+            k_event_clear(STREAM_CONTROL_EVENT, STREAM_PAUSE_EVENT);              \
             cgStaticError = CG_PAUSED_SCHEDULER;                                  \
             goto errorHandling;                                                   \
         }                                                                         \
@@ -77,3 +90,35 @@ class ContextSwitch
     */
     virtual int resume() = 0;
 };
+
+/*
+
+Optional extension of ContextSwitch for nodes having a memory.
+When CONFIG_STREAM_WARM_SWITCH is enabled, the state of the node is
+saved in a blob before pause and restored after resume. So the graph
+produces valid results as soon as it is resumed instead of having to
+fill its history again.
+
+The blob is owned by the application. saveState and restoreState
+are called with a blob of stateSize() bytes.
+
+*/
+class WarmContextSwitch : public ContextSwitch
+{
+      public:
+    virtual size_t stateSize() const = 0;
+
+    /*
+
+    Run from the same thread as pause and before pause.
+
+    */
+    virtual int saveState(void *blob, size_t size) const = 0;
+
+    /*
+
+    Run from the same thread as resume and after resume.
+
+    */
+    virtual int restoreState(const void *blob, size_t size) = 0;
+};
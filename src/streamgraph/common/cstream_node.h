@@ -26,6 +26,7 @@
 #ifndef C_STREAM_NODE_H
 #define C_STREAM_NODE_H
 
+#include <stddef.h>
 #include "cg_enums.h"
 
 #ifdef   __cplusplus
@@ -58,6 +59,11 @@ struct ContextSwitchInterface
 {
     int (*pause)(void *self);
     int (*resume)(void *self);
+    /* Optional state save / restore for warm context switch.
+       NULL if the node has no state to save. */
+    size_t (*state_size)(const void *self);
+    int (*save_state)(const void *self,void *blob,size_t size);
+    int (*restore_state)(void *self,const void *blob,size_t size);
 };
 /**
  * @brief C structure to hold a pointer to a C++ object and its interfaces
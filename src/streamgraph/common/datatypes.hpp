@@ -22,3 +22,14 @@ struct sq15 {
     int16_t right;
 };
 
+struct cq31 {
+    int32_t real;
+    int32_t imag;
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+struct cf16 {
+    float16_t real;
+    float16_t imag;
+};
+#endif
@@ -21,6 +21,70 @@ struct tfliteNodeParams
    size_t modelSize;
 };
 
+/**
+ * @brief Settings of the image preprocessing for a vision network
+ * The region of interest (roi) is cropped from the camera frame and
+ * resized to the network input size.
+ * Each channel is normalized with (v/255 - mean) / std and then quantized
+ * with the network input quantization parameters (scale, zero_point).
+ * A roi with a zero width or height means the full frame.
+ */
+struct imagePreprocessParams
+{
+   int frameWidth;
+   int frameHeight;
+   int roiX;
+   int roiY;
+   int roiWidth;
+   int roiHeight;
+   int outWidth;
+   int outHeight;
+   int grayscale;
+   float mean[3];
+   float std[3];
+   float scale;
+   int zero_point;
+};
+
+/**
+ * @brief Settings of the automatic gain control / compressor
+ * The RMS level of each block is smoothed in dB with the attack time
+ * (level rising) or release time (level falling). The gain in dB is
+ * (targetLevel - level) * (1 - 1/ratio) limited to [minGain,maxGain].
+ * A ratio of 1 disables the compression and a big ratio is an AGC.
+ * Below gateLevel, the gain is held to not amplify the background noise.
+ *
+ * The settings can be changed while the graph is running. The node
+ * reads them at the beginning of a block when version has changed. The
+ * writer must use agc_params_begin_update and agc_params_end_update
+ * around the modifications (version is odd during an update).
+ */
+struct agcParams
+{
+   uint32_t version;
+   float sampleRate;  // Hz
+   float targetLevel; // dBFS
+   float ratio;
+   float minGain;     // dB
+   float maxGain;     // dB
+   float gateLevel;   // dBFS
+   float attackTime;  // ms
+   float releaseTime; // ms
+   // Number of AGC nodes using these settings (maintained by the nodes)
+   uint32_t nbNodes;
+};
+
+static inline void agc_params_begin_update(struct agcParams *p)
+{
+   __atomic_fetch_add(&p->version, 1, __ATOMIC_RELAXED);
+   __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void agc_params_end_update(struct agcParams *p)
+{
+   __atomic_fetch_add(&p->version, 1, __ATOMIC_RELEASE);
+}
+
 /**
  * @brief Structure to hold hardware connection parameters
  * for nodes that interact with hardware components.
@@ -31,6 +95,13 @@ struct hardwareParams
 {
    const struct device *i2s_mic;
    struct k_mem_slab *mem_slab;
+   // Audio playback (NULL when CONFIG_AUDIO_SINK is not enabled)
+   const struct device *i2s_spk;
+   struct k_mem_slab *spk_slab;
+   // Capture time (cycles) of the last microphone block read by the
+   // ZephyrAudioSource of the graph. Used by the audio sinks of the
+   // same graph to measure the latency.
+   uint32_t capture_timestamp;
 };
 
 #ifdef   __cplusplus
@@ -0,0 +1,6 @@
+#include <zephyr/kernel.h>
+
+#include "StreamArena.hpp"
+
+// Serializes the ArenaScope of the graphs initialized from different threads
+K_MUTEX_DEFINE(stream_arena_scope_lock);
@@ -0,0 +1,90 @@
+#ifndef STREAM_ARENA_H
+#define STREAM_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Bump allocator used to allocate the FIFOs, nodes and
+ * node buffers of a graph.
+ * Memory is allocated in init_scheduler_* and released in one
+ * call with stream_arena_reset when the graph is freed.
+ * Individual allocations are never freed.
+ */
+struct stream_arena
+{
+    uint8_t *base;
+    size_t size;
+    size_t used;
+    /* Number of bytes requested that did not fit in the arena */
+    size_t overflow;
+};
+
+static inline void stream_arena_init(struct stream_arena *arena, void *mem, size_t size)
+{
+    arena->base = (uint8_t *)mem;
+    arena->size = size;
+    arena->used = 0;
+    arena->overflow = 0;
+}
+
+/**
+ * @brief Allocate aligned storage from the arena
+ * Alignment must be a power of 2.
+ * Return NULL if there is not enough memory in the arena.
+ */
+static inline void *stream_arena_alloc(struct stream_arena *arena, size_t size, size_t align)
+{
+    if (arena == NULL)
+    {
+        return NULL;
+    }
+    uintptr_t start = (uintptr_t)(arena->base + arena->used);
+    uintptr_t aligned = (start + (align - 1)) & ~(uintptr_t)(align - 1);
+    size_t newUsed = (size_t)(aligned - (uintptr_t)arena->base) + size;
+    if (newUsed > arena->size)
+    {
+        arena->overflow += size;
+        return NULL;
+    }
+    arena->used = newUsed;
+    return (void *)aligned;
+}
+
+static inline int stream_arena_contains(const struct stream_arena *arena, const void *p)
+{
+    if (arena == NULL)
+    {
+        return 0;
+    }
+    const uint8_t *b = (const uint8_t *)p;
+    return ((b >= arena->base) && (b < arena->base + arena->size));
+}
+
+/**
+ * @brief Release all the allocations in one call
+ */
+static inline void stream_arena_reset(struct stream_arena *arena)
+{
+    if (arena != NULL)
+    {
+        arena->used = 0;
+        arena->overflow = 0;
+    }
+}
+
+static inline size_t stream_arena_used(const struct stream_arena *arena)
+{
+    return (arena != NULL) ? arena->used : 0;
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,8 @@
+// This file is automatically generated. Do not edit.
+
+#include <cstdint>
+#include "app_config.hpp"
+#include "stream_fifo_overlay.h"
+
+CG_FIFO_OVERLAY_BUFFER
+uint8_t stream_fifo_overlay[STREAM_FIFO_OVERLAY_SIZE]={0};
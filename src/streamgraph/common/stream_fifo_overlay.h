@@ -0,0 +1,27 @@
+#ifndef STREAM_FIFO_OVERLAY_H
+#define STREAM_FIFO_OVERLAY_H
+// This file is automatically generated. Do not edit.
+
+#include <stdint.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+// Memory used by each graph
+#define STREAM_APPA_FIFO_SIZE 4480
+#define STREAM_APPB_FIFO_SIZE 24576
+#define STREAM_APPC_FIFO_SIZE 0
+
+// Graphs are never running at the same time and share
+// the same memory for their FIFOs
+#define STREAM_FIFO_OVERLAY_SIZE 24576
+
+extern uint8_t stream_fifo_overlay[STREAM_FIFO_OVERLAY_SIZE];
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif // STREAM_FIFO_OVERLAY_H
@@ -0,0 +1,169 @@
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(streamapps,CONFIG_STREAMAPPS_LOG_LEVEL);
+
+#include "cg_enums.h"
+#include "EventQueue.hpp"
+#include "rtos_events.hpp"
+
+#include "stream_runner.hpp"
+
+using namespace arm_cmsis_stream;
+
+extern struct k_event cg_streamEvent;
+
+static K_MUTEX_DEFINE(display_lock);
+static K_MUTEX_DEFINE(npu_lock);
+
+static struct k_mutex *const resource_locks[STREAM_NB_RESOURCES] = {&display_lock, &npu_lock};
+
+static atomic_t foreground = ATOMIC_INIT(0);
+
+/*
+
+The runner of a thread is stored in the custom data of the thread.
+It is used by the dataflow scheduler to find its control event and
+by the nodes to know if they belong to the foreground graph.
+
+*/
+static struct stream_runner *current_runner(void)
+{
+#if defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+	return static_cast<struct stream_runner *>(k_thread_custom_data_get());
+#else
+	return nullptr;
+#endif
+}
+
+#if defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+K_THREAD_STACK_ARRAY_DEFINE(runner_dataflow_stacks, CONFIG_STREAM_RUNNER_MAX_GRAPHS,
+			    CONFIG_STREAM_RUNNER_STACK_SIZE);
+K_THREAD_STACK_ARRAY_DEFINE(runner_event_stacks, CONFIG_STREAM_RUNNER_MAX_GRAPHS,
+			    CONFIG_STREAM_RUNNER_STACK_SIZE);
+
+static int nb_runners = 0;
+
+static void dataflow_thread_function(void *p1, void *, void *)
+{
+	struct stream_runner *runner = static_cast<struct stream_runner *>(p1);
+	k_thread_custom_data_set(runner);
+
+	LOG_INF("Started dataflow thread of %s\n", runner->name);
+
+	for (;;) {
+		int error = CG_SUCCESS;
+		uint32_t nb = runner->context->dataflow_scheduler(&error);
+		// A pause is not used with concurrent graphs. The scheduler is
+		// just restarted.
+		if (error == CG_PAUSED_SCHEDULER) {
+			continue;
+		}
+		if (error != CG_STOP_SCHEDULER) {
+			LOG_ERR("%s stopped with error %d after %u iterations\n", runner->name,
+				error, nb);
+		}
+		break;
+	}
+
+	// The event thread of the graph is not needed anymore
+	static_cast<EventQueue *>(runner->context->evtQueue)->end();
+	LOG_INF("Dataflow thread of %s ended\n", runner->name);
+}
+
+static void event_thread_function(void *p1, void *, void *)
+{
+	struct stream_runner *runner = static_cast<struct stream_runner *>(p1);
+	k_thread_custom_data_set(runner);
+
+	LOG_INF("Started event thread of %s\n", runner->name);
+
+	// Process the events of the graph until end() is called
+	static_cast<EventQueue *>(runner->context->evtQueue)->execute();
+
+	LOG_INF("Event thread of %s ended\n", runner->name);
+}
+
+int stream_runner_start(struct stream_runner *runner)
+{
+	if (nb_runners >= CONFIG_STREAM_RUNNER_MAX_GRAPHS) {
+		LOG_ERR("Too many concurrent graphs\n");
+		return -ENOMEM;
+	}
+	int i = nb_runners++;
+
+	k_event_init(&runner->control);
+
+	runner->event_tid = k_thread_create(
+		&runner->event_thread, runner_event_stacks[i],
+		K_THREAD_STACK_SIZEOF(runner_event_stacks[i]), event_thread_function, runner, NULL,
+		NULL, runner->event_priority, K_FP_REGS, K_NO_WAIT);
+	k_thread_name_set(&runner->event_thread, runner->name);
+
+	runner->dataflow_tid = k_thread_create(
+		&runner->dataflow_thread, runner_dataflow_stacks[i],
+		K_THREAD_STACK_SIZEOF(runner_dataflow_stacks[i]), dataflow_thread_function, runner,
+		NULL, NULL, runner->dataflow_priority, K_FP_REGS, K_NO_WAIT);
+	k_thread_name_set(&runner->dataflow_thread, runner->name);
+
+	return 0;
+}
+
+void stream_runner_stop(struct stream_runner *runner)
+{
+	k_event_post(&runner->control, STREAM_DONE_EVENT);
+}
+
+void stream_runner_join(struct stream_runner *runner)
+{
+	k_thread_join(&runner->dataflow_thread, K_FOREVER);
+	k_thread_join(&runner->event_thread, K_FOREVER);
+}
+#endif
+
+struct k_event *stream_runner_control_event(void)
+{
+	struct stream_runner *runner = current_runner();
+	if (runner == nullptr) {
+		return &cg_streamEvent;
+	}
+	return &runner->control;
+}
+
+int stream_runner_current_graph(void)
+{
+	struct stream_runner *runner = current_runner();
+	if (runner == nullptr) {
+		return -1;
+	}
+	return runner->graph;
+}
+
+void stream_resource_lock(enum stream_resource resource)
+{
+	k_mutex_lock(resource_locks[resource], K_FOREVER);
+}
+
+void stream_resource_unlock(enum stream_resource resource)
+{
+	k_mutex_unlock(resource_locks[resource]);
+}
+
+void stream_runner_set_foreground(int graph)
+{
+	atomic_set(&foreground, graph);
+}
+
+int stream_runner_foreground(void)
+{
+	return (int)atomic_get(&foreground);
+}
+
+bool stream_runner_owns_display(void)
+{
+	int graph = stream_runner_current_graph();
+	// Not a runner thread: only one graph is running
+	if (graph < 0) {
+		return true;
+	}
+	return graph == stream_runner_foreground();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include "stream_runtime_init.hpp"
+
+/*
+
+Concurrent execution of several graphs.
+
+The CMSIS Stream Zephyr module runs one execution context at a time
+with one dataflow thread and one event thread that are reused for all
+the graphs (see doc/tech_details.md).
+
+When CONFIG_STREAM_CONCURRENT_GRAPHS is enabled, each graph is run by
+its own stream_runner: a dataflow thread and an event thread with their
+own priorities. The graphs are not paused when switching between them.
+The switch only changes the foreground graph that owns the display.
+
+The dataflow scheduler of a graph is stopped with the control event of
+its runner (STREAM_DONE_EVENT) instead of the global cg_streamEvent.
+See CG_BEFORE_NODE_EXECUTION in app_config.hpp.
+
+*/
+struct stream_runner {
+	const stream_execution_context_t *context;
+	const char *name;
+	// Index of the graph (used for the foreground selection)
+	int graph;
+	int dataflow_priority;
+	// Should be lower than the dataflow priority
+	int event_priority;
+
+	struct k_event control;
+	struct k_thread dataflow_thread;
+	struct k_thread event_thread;
+	k_tid_t dataflow_tid;
+	k_tid_t event_tid;
+};
+
+#if defined(CONFIG_STREAM_CONCURRENT_GRAPHS)
+extern int stream_runner_start(struct stream_runner *runner);
+// Request the end of the graph. The runner threads end at the next
+// node boundary.
+extern void stream_runner_stop(struct stream_runner *runner);
+extern void stream_runner_join(struct stream_runner *runner);
+#endif
+
+// Control event of the graph running in the current thread.
+// It is cg_streamEvent if the thread is not a runner thread.
+extern struct k_event *stream_runner_control_event(void);
+
+// Graph running in the current thread or -1
+extern int stream_runner_current_graph(void);
+
+/*
+
+Arbitration of the resources shared by the graphs.
+
+The display is owned by the foreground graph. The display nodes of the
+background graphs keep their state up to date but do not render.
+The NPU is used by one inference at a time.
+The microphones are shared through the audio broker (audio_broker.hpp).
+
+*/
+enum stream_resource {
+	STREAM_RESOURCE_DISPLAY = 0,
+	STREAM_RESOURCE_NPU = 1,
+	STREAM_NB_RESOURCES
+};
+
+extern void stream_resource_lock(enum stream_resource resource);
+extern void stream_resource_unlock(enum stream_resource resource);
+
+extern void stream_runner_set_foreground(int graph);
+extern int stream_runner_foreground(void);
+
+// True if the current thread can render on the display.
+// Always true when the graphs are not run concurrently.
+extern bool stream_runner_owns_display(void);
@@ -31,6 +31,7 @@
 #include "nodes/Hanning.hpp"
 #include "appnodes/SpectrogramDisplay.hpp"
 #include "appnodes/CameraFrame.hpp"
+#include "nodes/FrameMailbox.hpp"
 #include "nodes/ZephyrDebugVideoSource.hpp"
 
 template class ZephyrAudioSource<sq15,320>;
@@ -56,6 +57,7 @@ template class Convert<sq15,320,sf32,320>;
 template class Hanning<float,640,float,1024>;
 template CStreamNode createStreamNode(SpectrogramDisplay &obj) ;
 template CStreamNode createStreamNode(CameraFrame &obj) ;
+template CStreamNode createStreamNode(FrameMailbox &obj) ;
 template CStreamNode createStreamNode(ZephyrDebugVideoSource &obj) ;
 
 // Selector initializations
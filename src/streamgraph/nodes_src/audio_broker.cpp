@@ -0,0 +1,299 @@
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(streamapps,CONFIG_STREAMAPPS_LOG_LEVEL);
+
+#include "audio_broker.hpp"
+
+#if defined(CONFIG_I2S)
+
+#define BROKER_RING_DEPTH    CONFIG_AUDIO_BROKER_RING_DEPTH
+#define BROKER_MAX_CONSUMERS CONFIG_AUDIO_BROKER_MAX_CONSUMERS
+
+// The driver must always have a free block while the slowest
+// consumer holds a full ring and is reading one more block.
+BUILD_ASSERT(CONFIG_I2S_NUM_BUFFERS >= BROKER_RING_DEPTH + 2,
+	     "CONFIG_I2S_NUM_BUFFERS is too small for CONFIG_AUDIO_BROKER_RING_DEPTH");
+
+struct audio_broker_consumer {
+	struct audio_broker_block *ring[BROKER_RING_DEPTH];
+	uint32_t head;
+	uint32_t nb;
+	// Number of blocks in the ring
+	struct k_sem available;
+	uint32_t overruns;
+	bool subscribed;
+};
+
+/*
+
+The spinlock protects the rings and the reference counts.
+The mutex protects the state of the I2S stream.
+
+*/
+static struct k_spinlock broker_spin;
+static K_MUTEX_DEFINE(broker_lock);
+static K_SEM_DEFINE(broker_start, 0, 1);
+
+static struct audio_broker_consumer consumers[BROKER_MAX_CONSUMERS];
+static int nb_consumers = 0;
+
+// At most one descriptor per slab block
+static struct audio_broker_block blocks[CONFIG_I2S_NUM_BUFFERS];
+
+static const struct device *broker_i2s = nullptr;
+static struct k_mem_slab *broker_slab = nullptr;
+static bool broker_running = false;
+static bool broker_initialized = false;
+
+// Must be called with broker_spin locked
+static void release_locked(struct audio_broker_block *block)
+{
+	block->refs--;
+	if (block->refs == 0) {
+		k_mem_slab_free(broker_slab, block->data);
+		block->data = nullptr;
+	}
+}
+
+static void publish(void *data, size_t size)
+{
+	bool wakeup[BROKER_MAX_CONSUMERS] = {false};
+	k_spinlock_key_t key = k_spin_lock(&broker_spin);
+
+	if (nb_consumers == 0) {
+		// The stream is waiting to be stopped
+		k_mem_slab_free(broker_slab, data);
+		k_spin_unlock(&broker_spin, key);
+		return;
+	}
+
+	struct audio_broker_block *block = nullptr;
+	for (int i = 0; i < CONFIG_I2S_NUM_BUFFERS; i++) {
+		if (blocks[i].data == nullptr) {
+			block = &blocks[i];
+			break;
+		}
+	}
+	// Cannot happen since there is one descriptor per slab block
+	__ASSERT_NO_MSG(block != nullptr);
+
+	block->data = data;
+	block->size = size;
+	block->timestamp = k_cycle_get_32();
+	block->refs = nb_consumers;
+
+	for (int i = 0; i < BROKER_MAX_CONSUMERS; i++) {
+		struct audio_broker_consumer *c = &consumers[i];
+		if (!c->subscribed) {
+			continue;
+		}
+		if (c->nb == BROKER_RING_DEPTH) {
+			// Consumer too slow: the oldest block is dropped
+			release_locked(c->ring[c->head]);
+			c->head = (c->head + 1) % BROKER_RING_DEPTH;
+			c->nb--;
+			c->overruns++;
+			c->ring[(c->head + c->nb) % BROKER_RING_DEPTH] = block;
+			c->nb++;
+		} else {
+			c->ring[(c->head + c->nb) % BROKER_RING_DEPTH] = block;
+			c->nb++;
+			wakeup[i] = true;
+		}
+	}
+
+	k_spin_unlock(&broker_spin, key);
+
+	for (int i = 0; i < BROKER_MAX_CONSUMERS; i++) {
+		if (wakeup[i]) {
+			k_sem_give(&consumers[i].available);
+		}
+	}
+}
+
+static void capture_thread_function(void *, void *, void *)
+{
+	for (;;) {
+		k_mutex_lock(&broker_lock, K_FOREVER);
+		bool running = broker_running;
+		k_mutex_unlock(&broker_lock);
+
+		if (!running) {
+			k_sem_take(&broker_start, K_FOREVER);
+			continue;
+		}
+
+		void *data = nullptr;
+		size_t size;
+		int err = i2s_read(broker_i2s, &data, &size);
+		if (err == 0) {
+			publish(data, size);
+			continue;
+		}
+
+		k_mutex_lock(&broker_lock, K_FOREVER);
+		if (broker_running) {
+			// Overrun in the driver. The stream must be restarted.
+			LOG_ERR("i2s_read failed: %d", err);
+			i2s_trigger(broker_i2s, I2S_DIR_RX, I2S_TRIGGER_PREPARE);
+			err = i2s_trigger(broker_i2s, I2S_DIR_RX, I2S_TRIGGER_START);
+			if (err < 0) {
+				LOG_ERR("i2s_trigger start failed: %i", err);
+				broker_running = false;
+			}
+		}
+		k_mutex_unlock(&broker_lock);
+	}
+}
+
+K_THREAD_DEFINE(audio_broker_thread, CONFIG_AUDIO_BROKER_STACK_SIZE, capture_thread_function,
+		NULL, NULL, NULL, CONFIG_AUDIO_BROKER_THREAD_PRIORITY, 0, 0);
+
+static void stop_work_handler(struct k_work *work)
+{
+	k_mutex_lock(&broker_lock, K_FOREVER);
+	if (broker_running && (nb_consumers == 0)) {
+		LOG_DBG("Stopping RX");
+		int rc = i2s_trigger(broker_i2s, I2S_DIR_RX, I2S_TRIGGER_DROP);
+		if (rc < 0) {
+			LOG_ERR("I2S_TRIGGER_DROP failed: %i", rc);
+		}
+		broker_running = false;
+	}
+	k_mutex_unlock(&broker_lock);
+}
+
+static K_WORK_DELAYABLE_DEFINE(broker_stop_work, stop_work_handler);
+
+struct audio_broker_consumer *audio_broker_subscribe(const struct device *i2s,
+						     struct k_mem_slab *mem_slab)
+{
+	struct audio_broker_consumer *consumer = nullptr;
+	struct k_work_sync sync;
+
+	// A graph is using the stream again. Cancel the pending stop
+	k_work_cancel_delayable_sync(&broker_stop_work, &sync);
+
+	k_mutex_lock(&broker_lock, K_FOREVER);
+
+	if (!broker_initialized) {
+		for (int i = 0; i < BROKER_MAX_CONSUMERS; i++) {
+			k_sem_init(&consumers[i].available, 0, BROKER_RING_DEPTH);
+		}
+		broker_initialized = true;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&broker_spin);
+	for (int i = 0; i < BROKER_MAX_CONSUMERS; i++) {
+		if (!consumers[i].subscribed) {
+			consumer = &consumers[i];
+			consumer->head = 0;
+			consumer->nb = 0;
+			consumer->overruns = 0;
+			// A publish racing with the previous unsubscribe may have
+			// given the semaphore after it was reset. The count is
+			// cleared while the ring is locked so that it matches nb.
+			k_sem_reset(&consumer->available);
+			consumer->subscribed = true;
+			nb_consumers++;
+			break;
+		}
+	}
+	k_spin_unlock(&broker_spin, key);
+
+	if (consumer == nullptr) {
+		LOG_ERR("Too many audio consumers");
+		k_mutex_unlock(&broker_lock);
+		return nullptr;
+	}
+
+	if (!broker_running) {
+		LOG_DBG("Starting RX");
+		broker_i2s = i2s;
+		broker_slab = mem_slab;
+		int rc = i2s_trigger(i2s, I2S_DIR_RX, I2S_TRIGGER_START);
+		if (rc < 0) {
+			LOG_ERR("i2s_trigger start failed: %i", rc);
+			k_mutex_unlock(&broker_lock);
+			audio_broker_unsubscribe(consumer);
+			return nullptr;
+		}
+		broker_running = true;
+		k_sem_give(&broker_start);
+	}
+
+	k_mutex_unlock(&broker_lock);
+	return consumer;
+}
+
+void audio_broker_unsubscribe(struct audio_broker_consumer *consumer)
+{
+	if (consumer == nullptr) {
+		return;
+	}
+
+	k_mutex_lock(&broker_lock, K_FOREVER);
+
+	k_spinlock_key_t key = k_spin_lock(&broker_spin);
+	// Give back the blocks not read by this consumer
+	while (consumer->nb > 0) {
+		release_locked(consumer->ring[consumer->head]);
+		consumer->head = (consumer->head + 1) % BROKER_RING_DEPTH;
+		consumer->nb--;
+	}
+	consumer->subscribed = false;
+	nb_consumers--;
+	int remaining = nb_consumers;
+	k_spin_unlock(&broker_spin, key);
+
+	k_sem_reset(&consumer->available);
+
+	// The stream is stopped later if no other graph is using it
+	if (remaining == 0) {
+		k_work_schedule(&broker_stop_work, K_MSEC(CONFIG_I2S_STOP_DELAY_MS));
+	}
+
+	k_mutex_unlock(&broker_lock);
+}
+
+int audio_broker_read(struct audio_broker_consumer *consumer,
+		      struct audio_broker_block **block, k_timeout_t timeout)
+{
+	int err = k_sem_take(&consumer->available, timeout);
+	if (err != 0) {
+		return err;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&broker_spin);
+	// The semaphore is given after the ring is unlocked by publish: the
+	// consumer may have been unsubscribed and its ring emptied since
+	if (!consumer->subscribed || (consumer->nb == 0)) {
+		k_spin_unlock(&broker_spin, key);
+		return -EAGAIN;
+	}
+	*block = consumer->ring[consumer->head];
+	consumer->head = (consumer->head + 1) % BROKER_RING_DEPTH;
+	consumer->nb--;
+	k_spin_unlock(&broker_spin, key);
+
+	return 0;
+}
+
+void audio_broker_release(struct audio_broker_block *block)
+{
+	k_spinlock_key_t key = k_spin_lock(&broker_spin);
+	release_locked(block);
+	k_spin_unlock(&broker_spin, key);
+}
+
+uint32_t audio_broker_overruns(const struct audio_broker_consumer *consumer)
+{
+	if (consumer == nullptr) {
+		return 0;
+	}
+	return consumer->overruns;
+}
+
+#endif
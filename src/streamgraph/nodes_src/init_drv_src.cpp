@@ -62,6 +62,47 @@ const struct device *init_audio_source(k_mem_slab **mem_slab_out)
 
 #endif
 
+#if defined(CONFIG_AUDIO_SINK)
+
+K_MEM_SLAB_DEFINE_STATIC(spk_slab, I2S_BUFFER_SIZE, CONFIG_AUDIO_SINK_NUM_BUFFERS, 4);
+
+static const struct device *i2s_spk = DEVICE_DT_GET(DT_ALIAS(i2s_spk));
+
+const struct device *init_audio_sink(k_mem_slab **mem_slab_out)
+{
+	*mem_slab_out = &spk_slab;
+	if (!device_is_ready(i2s_spk)) {
+		LOG_ERR("i2s_spk is not ready");
+		return nullptr;
+	}
+
+	const struct i2s_config config = {
+		.word_size = I2S_WORD_SIZE,
+		.channels = I2S_CHANNELS,
+		.format = I2S_FMT_DATA_FORMAT_I2S,
+		.options = I2S_OPT_FRAME_CLK_MASTER | I2S_OPT_BIT_CLK_MASTER,
+		.frame_clk_freq = static_cast<uint32_t>(CONFIG_SAMPLE_RATE),
+		.mem_slab = &spk_slab,
+		.block_size = I2S_BUFFER_SIZE,
+		.timeout = SYS_FOREVER_MS,
+	};
+
+	int rc = i2s_configure(i2s_spk, I2S_DIR_TX, &config);
+
+	if (rc < 0) {
+		LOG_ERR("i2s_configure TX failed: %i", rc);
+		return nullptr;
+	}
+
+	return (i2s_spk);
+}
+
+#endif
+
+#if defined(CONFIG_FILE_VIDEO_SOURCE)
+K_MEM_SLAB_DEFINE(file_video_slab, FILE_VIDEO_FRAME_SIZE, FILE_VIDEO_NB_FRAMES, 4);
+#endif
+
 #if defined(CONFIG_DISPLAY)
 int init_display()
 {
@@ -82,6 +123,17 @@ int init_display()
 	
 }
 
+void blank_display()
+{
+	// The active buffer is shown until the next frame. Display nodes
+	// redraw the full frame so only the buffer that becomes visible
+	// has to be cleared.
+	void *buf = display_inactive_buffer();
+	memset(buf, 0, DISPLAY_IMAGE_SIZE);
+
+	display_next_frame();
+}
+
 void clear_display()
 {
 	void *buf = display_active_buffer();
@@ -2,6 +2,7 @@
 
 #include "nodes/ZephyrLCD.hpp"
 #include "appnodes/ImgUtils.hpp"
+#include "EventDispatch.hpp"
 
 using namespace arm_cmsis_stream;
 
@@ -11,7 +12,7 @@ class CameraFrame : public ZephyrLCD
 
    
       public:
-	CameraFrame() : ZephyrLCD()
+	CameraFrame(EventQueue *queue) : ZephyrLCD(), ev(queue)
 	{
 	}
 
@@ -64,25 +65,33 @@ class CameraFrame : public ZephyrLCD
 
     void processEvent(int dstPort, Event &&evt) final override
     {
-        if (evt.event_id == kValue)
+        using Dispatch = EventDispatch<
+            EventHandler<0, kValue, TensorPtr<const uint16_t>, &CameraFrame::processImage>>;
+
+        Dispatch::dispatch(*this, dstPort, std::move(evt));
+    }
+
+    void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
+    {
+        if (outputPort == 0)
         {
-            if (dstPort == 0)
-            {
-                if (evt.wellFormed<TensorPtr<const uint16_t>>())
-                {
-                    evt.apply<TensorPtr<const uint16_t>>(&CameraFrame::processImage, *this);
-                    genNewFrame();
-                }
-            }
+            ev.subscribe(dst, dstPort);
         }
-
-        
     }
 protected:
 void processImage(TensorPtr<const uint16_t> &&frame)
     {
         image = std::move(frame);
+        genNewFrame();
+        // The frame is released as soon as it has been rendered
+        // so that the video source can reuse the buffer.
+        image = TensorPtr<const uint16_t>();
+        // Ask for a new frame.
+        // Asynchronous to avoid a recursion if a new frame is already
+        // available
+        ev.sendAsync(kNormalPriority, kDo);
     }
 
    TensorPtr<const uint16_t> image;
+   EventOutput ev;
 };
@@ -1,8 +1,10 @@
 #pragma once
 #include "EventQueue.hpp"
 #include "StreamNode.hpp"
+#include "EventDispatch.hpp"
 #include "dsp/basic_math_functions.h"
 
+#include <array>
 #include <string>
 
 extern "C" {
@@ -14,10 +16,12 @@ extern "C" {
 
 using namespace arm_cmsis_stream;
 
-class KWSClassify: public StreamNode, public ContextSwitch
+class KWSClassify: public StreamNode, public WarmContextSwitch
 {
 	static constexpr size_t nbLabels = 12;
 	static constexpr size_t historySizeDefault = 4;
+	// The history is part of the node object
+	static constexpr size_t historySizeMax = 16;
 	static constexpr const char *labelsVec[nbLabels] = {
 		"down",  "go",   "left", "no",  "off",       "on",
 		"right", "stop", "up",   "yes", "_silence_", "_unknown_",
@@ -27,12 +31,20 @@ class KWSClassify: public StreamNode, public ContextSwitch
 	KWSClassify(EventQueue *queue, const struct classifyParams &params)
 		: StreamNode(), ev0(queue), historySize_(params.historyLength)
 	{
-		history.resize(params.historyLength + 1);
-		for (auto &v : history) {
-			v.resize(nbLabels, 0.0f);
-		}
+		// Row 0 is the most recent result
+		history.fill(0.0f);
 	};
 
+	cg_status init() final override
+	{
+		if (historySize_ > historySizeMax) {
+			LOG_ERR("KWS Classify: history length %d is bigger than %d\n",
+				(int)historySize_, (int)historySizeMax);
+			return CG_INIT_FAILURE;
+		}
+		return CG_SUCCESS;
+	}
+
 	int pause() final override
 	{
 		return 0;
@@ -40,13 +52,39 @@ class KWSClassify: public StreamNode, public ContextSwitch
 
 	int resume() final override
 	{
-		for (auto &v : history) {
-			std::fill(v.begin(), v.end(), 0.0f);
-		}
+		history.fill(0.0f);
 		lastRec = 11;
 		return 0;
 	}
 
+	// History of the softmax results followed by the last recognized label
+	size_t stateSize() const final override
+	{
+		return historyElements() * sizeof(float) + sizeof(lastRec);
+	}
+
+	int saveState(void *blob, size_t size) const final override
+	{
+		if (size != stateSize()) {
+			return -1;
+		}
+		uint8_t *p = static_cast<uint8_t *>(blob);
+		memcpy(p, history.data(), historyElements() * sizeof(float));
+		memcpy(p + historyElements() * sizeof(float), &lastRec, sizeof(lastRec));
+		return 0;
+	}
+
+	int restoreState(const void *blob, size_t size) final override
+	{
+		if (size != stateSize()) {
+			return -1;
+		}
+		const uint8_t *p = static_cast<const uint8_t *>(blob);
+		memcpy(history.data(), p, historyElements() * sizeof(float));
+		memcpy(&lastRec, p + historyElements() * sizeof(float), sizeof(lastRec));
+		return 0;
+	}
+
 	static void softmax(float *in, size_t blockSize)
 	{
 		float32_t maxVal;
@@ -121,14 +159,15 @@ class KWSClassify: public StreamNode, public ContextSwitch
 		// softmax
 		softmax(buf, nbLabels);
 		// add array to history
-		for (int i = historySize_ - 1; i > 0; i--) {
-			history[i] = std::move(history[i - 1]);
+		if (historySize_ > 1) {
+			memmove(&history[nbLabels], &history[0],
+				(historySize_ - 1) * nbLabels * sizeof(float));
 		}
-		history[0] = std::vector<float>(buf, buf + nbLabels);
+		memcpy(&history[0], buf, nbLabels * sizeof(float));
 
 		memset(buf, 0, nbLabels * sizeof(float));
-		for (const auto &v : history) {
-			arm_add_f32(v.data(), buf, buf, nbLabels);
+		for (size_t i = 0; i < historyElements(); i += nbLabels) {
+			arm_add_f32(&history[i], buf, buf, nbLabels);
 		}
 
 		// find max
@@ -162,15 +201,12 @@ class KWSClassify: public StreamNode, public ContextSwitch
 
 	void processEvent(int dstPort, Event &&evt) final override
 	{
-		if (evt.event_id == kValue) {
-			if (evt.wellFormed<TensorPtr<float>>()) {
-				evt.apply<TensorPtr<float>>(&KWSClassify::processKWS, *this);
-			}
-			if (evt.wellFormed<TensorPtr<const float>>()) {
-				evt.apply<TensorPtr<const float>>(&KWSClassify::processConstantKWS,
-								  *this);
-			}
-		}
+		using Dispatch = EventDispatch<
+			EventHandler<kAnyPort, kValue, TensorPtr<float>, &KWSClassify::processKWS>,
+			EventHandler<kAnyPort, kValue, TensorPtr<const float>,
+				     &KWSClassify::processConstantKWS>>;
+
+		Dispatch::dispatch(*this, dstPort, std::move(evt));
 	}
 
 	void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
@@ -179,9 +215,14 @@ class KWSClassify: public StreamNode, public ContextSwitch
 	}
 
       protected:
+	size_t historyElements() const
+	{
+		return (historySize_ + 1) * nbLabels;
+	}
+
 	uint32_t lastRec{11};
 	float buf[nbLabels];
-	std::vector<std::vector<float>> history;
+	std::array<float, (historySizeMax + 1) * nbLabels> history;
 	EventOutput ev0;
 	size_t historySize_;
 };
\ No newline at end of file
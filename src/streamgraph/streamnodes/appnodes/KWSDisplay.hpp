@@ -1,6 +1,7 @@
 #pragma once
 
 #include "nodes/ZephyrLCD.hpp"
+#include "EventDispatch.hpp"
 
 extern "C"
 {
@@ -153,19 +154,12 @@ class KWSDisplay : public ZephyrLCD
 
     void processEvent(int dstPort, Event &&evt) final override
     {
-        if (evt.event_id == kDo)
-        {
-            genNewFrame();
-        }
+        // New frame requested or new recognized label
+        using Dispatch = EventDispatch<
+            EventHandler<kAnyPort, kDo, void, &KWSDisplay::genNewFrame>,
+            EventHandler<kAnyPort, kValue, uint32_t, &KWSDisplay::newValue>>;
 
-        // New camera frame or spectrogram
-        if (evt.event_id == kValue)
-        {
-            if (evt.wellFormed<uint32_t>())
-            {
-                evt.apply<uint32_t>(&KWSDisplay::newValue, *this);
-            }
-        }
+        Dispatch::dispatch(*this, dstPort, std::move(evt));
     }
 
   protected:
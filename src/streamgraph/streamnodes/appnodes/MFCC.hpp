@@ -27,7 +27,7 @@
 
 #include "GenericNodes.hpp"
 #include "dsp/transform_functions.h"
-#include <vector>
+#include <array>
 
 extern "C"
 {
@@ -69,13 +69,6 @@ class MFCC<float32_t, 640, float32_t, 10> : public GenericNode<float32_t, 640, f
         {
             LOG_ERR("MFCC init error\n");
         }
-#if defined(ARM_MFCC_CFFT_BASED)
-        memory.resize(2 * 1024);
-        paddedInput.resize(2 * 1024);
-#else
-        memory.resize(1024 + 2);
-        paddedInput.resize(1024 + 2);
-#endif
     };
 
 
@@ -91,7 +84,13 @@ class MFCC<float32_t, 640, float32_t, 10> : public GenericNode<float32_t, 640, f
         return (CG_SUCCESS);
     };
 
+#if defined(ARM_MFCC_CFFT_BASED)
+    static constexpr size_t bufferSize = 2 * 1024;
+#else
+    static constexpr size_t bufferSize = 1024 + 2;
+#endif
+
     arm_mfcc_instance_f32 mfccConfig;
-    std::vector<float32_t> memory;
-    std::vector<float32_t> paddedInput;
+    std::array<float32_t, bufferSize> memory;
+    std::array<float32_t, bufferSize> paddedInput;
 };
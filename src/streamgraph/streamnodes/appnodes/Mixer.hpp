@@ -3,6 +3,12 @@
 #include "cg_enums.h"
 #include "StreamNode.hpp"
 #include "GenericNodes.hpp"
+#include "arm_math_types.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/support_functions.h"
+
+#include <array>
+#include <cmath>
 
 using namespace arm_cmsis_stream;
 
@@ -69,6 +75,69 @@ template <typename IN1, int inputSize1,
           typename OUT2, int output2Size>
 class Mixer;
 
+/*
+
+Gain ramp of the crossfade : alpha = (1 + sin(phase)) / 2 with a 2 Hz
+oscillation.
+
+The sine is computed with a recursive oscillator (rotation of the
+vector (cos, sin) by the phase increment). The oscillator is restarted
+from sinf / cosf of the phase at the beginning of each block so the
+error does not accumulate: there are 2 trigonometric calls per block
+instead of one per sample.
+
+*/
+class CrossfadeRamp
+{
+    static constexpr float32_t twoPi = 2.0f * PI;
+
+  public:
+    CrossfadeRamp()
+    {
+        delta = twoPi / CONFIG_SAMPLE_RATE * 2.0f;
+        cosDelta = cosf(delta);
+        sinDelta = sinf(delta);
+        phase = 0.0f;
+    }
+
+    // Gains for nb samples. Each gain is repeated for the channels of
+    // a sample.
+    void fill(float32_t *alpha, int nb, int channels = 1)
+    {
+        float32_t s = sinf(phase);
+        float32_t c = cosf(phase);
+        for (int i = 0; i < nb; i++)
+        {
+            float32_t a = 0.5f * (s + 1.0f);
+            for (int k = 0; k < channels; k++)
+            {
+                *alpha++ = a;
+            }
+            float32_t ns = s * cosDelta + c * sinDelta;
+            c = c * cosDelta - s * sinDelta;
+            s = ns;
+        }
+
+        phase += nb * delta;
+        while (phase > twoPi)
+        {
+            phase -= twoPi;
+        }
+    }
+
+  protected:
+    float32_t phase;
+    float32_t delta;
+    float32_t cosDelta;
+    float32_t sinDelta;
+};
+
+/*
+
+outl = alpha * inl + (1 - alpha) * inr
+outr = (1 - alpha) * inl + alpha * inr
+
+*/
 template <int inputSamples>
 class Mixer<float, inputSamples, float, inputSamples, float, inputSamples, float, inputSamples> : public GenericNode22<float, inputSamples, float, inputSamples, float, inputSamples, float, inputSamples>
 {
@@ -78,8 +147,6 @@ class Mixer<float, inputSamples, float, inputSamples, float, inputSamples, float
                    FIFOBase<float> &dst1,
                    FIFOBase<float> &dst2)
         : GenericNode22<float, inputSamples, float, inputSamples, float, inputSamples, float, inputSamples>(src1, src2, dst1, dst2){
-            delta = 2.0f * 3.14159265359f / SAMPLE_RATE * 2.0f;
-            phase = 0.0f;
         };
 
 
@@ -91,23 +158,108 @@ class Mixer<float, inputSamples, float, inputSamples, float, inputSamples, float
         float *outl = this->getWriteBuffer1();
         float *outr = this->getWriteBuffer2();
 
-        for (int i = 0; i < inputSamples; i++)
-        {
-            float alpha = (sinf(phase) + 1.0f) / 2.0f;
-            outl[i] = alpha*inl[i] + (1-alpha)*inr[i];
-            outr[i] = (1-alpha)*inl[i] + inr[i];
+        ramp.fill(alpha.data(), inputSamples);
 
-           phase += delta;
-           if (phase > 2.0f * 3.14159265359f)
-               phase -= 2.0f * 3.14159265359f;
-        }
+        // tmp = alpha * (inl - inr)
+        arm_sub_f32(inl, inr, tmp.data(), inputSamples);
+        arm_mult_f32(alpha.data(), tmp.data(), tmp.data(), inputSamples);
+
+        arm_add_f32(inr, tmp.data(), outl, inputSamples);
+        arm_sub_f32(inl, tmp.data(), outr, inputSamples);
 
         return(CG_SUCCESS);
        
     };
 
 protected:
-    float phase;
-    float delta;
+    CrossfadeRamp ramp;
+    std::array<float32_t, inputSamples> alpha;
+    std::array<float32_t, inputSamples> tmp;
 };
 
+// Same crossfade on the left and right channels of two stereo streams
+template <int inputSamples>
+class Mixer<sf32, inputSamples, sf32, inputSamples, sf32, inputSamples, sf32, inputSamples> : public GenericNode22<sf32, inputSamples, sf32, inputSamples, sf32, inputSamples, sf32, inputSamples>
+{
+  public:
+    explicit Mixer(FIFOBase<sf32> &src1,
+                   FIFOBase<sf32> &src2,
+                   FIFOBase<sf32> &dst1,
+                   FIFOBase<sf32> &dst2)
+        : GenericNode22<sf32, inputSamples, sf32, inputSamples, sf32, inputSamples, sf32, inputSamples>(src1, src2, dst1, dst2){
+        };
+
+
+     int run() final
+    {
+        constexpr int nb = 2 * inputSamples;
+        float32_t *inl = (float32_t *)this->getReadBuffer1();
+        float32_t *inr = (float32_t *)this->getReadBuffer2();
+        float32_t *outl = (float32_t *)this->getWriteBuffer1();
+        float32_t *outr = (float32_t *)this->getWriteBuffer2();
+
+        ramp.fill(alpha.data(), inputSamples, 2);
+
+        arm_sub_f32(inl, inr, tmp.data(), nb);
+        arm_mult_f32(alpha.data(), tmp.data(), tmp.data(), nb);
+
+        arm_add_f32(inr, tmp.data(), outl, nb);
+        arm_sub_f32(inl, tmp.data(), outr, nb);
+
+        return(CG_SUCCESS);
+       
+    };
+
+protected:
+    CrossfadeRamp ramp;
+    std::array<float32_t, 2 * inputSamples> alpha;
+    std::array<float32_t, 2 * inputSamples> tmp;
+};
+
+// The difference of two Q15 inputs may saturate so the Q15 version uses
+// the gains alpha and 1 - alpha
+template <int inputSamples>
+class Mixer<q15_t, inputSamples, q15_t, inputSamples, q15_t, inputSamples, q15_t, inputSamples> : public GenericNode22<q15_t, inputSamples, q15_t, inputSamples, q15_t, inputSamples, q15_t, inputSamples>
+{
+  public:
+    explicit Mixer(FIFOBase<q15_t> &src1,
+                   FIFOBase<q15_t> &src2,
+                   FIFOBase<q15_t> &dst1,
+                   FIFOBase<q15_t> &dst2)
+        : GenericNode22<q15_t, inputSamples, q15_t, inputSamples, q15_t, inputSamples, q15_t, inputSamples>(src1, src2, dst1, dst2){
+        };
+
+
+     int run() final
+    {
+        q15_t *inl = this->getReadBuffer1();
+        q15_t *inr = this->getReadBuffer2();
+        q15_t *outl = this->getWriteBuffer1();
+        q15_t *outr = this->getWriteBuffer2();
+
+        ramp.fill(alphaF32.data(), inputSamples);
+        arm_float_to_q15(alphaF32.data(), alpha.data(), inputSamples);
+        // 1 - alpha (0x7FFF is the biggest Q15 value)
+        arm_negate_q15(alpha.data(), beta.data(), inputSamples);
+        arm_offset_q15(beta.data(), 0x7FFF, beta.data(), inputSamples);
+
+        arm_mult_q15(alpha.data(), inl, tmp1.data(), inputSamples);
+        arm_mult_q15(beta.data(), inr, tmp2.data(), inputSamples);
+        arm_add_q15(tmp1.data(), tmp2.data(), outl, inputSamples);
+
+        arm_mult_q15(beta.data(), inl, tmp1.data(), inputSamples);
+        arm_mult_q15(alpha.data(), inr, tmp2.data(), inputSamples);
+        arm_add_q15(tmp1.data(), tmp2.data(), outr, inputSamples);
+
+        return(CG_SUCCESS);
+       
+    };
+
+protected:
+    CrossfadeRamp ramp;
+    std::array<float32_t, inputSamples> alphaF32;
+    std::array<q15_t, inputSamples> alpha;
+    std::array<q15_t, inputSamples> beta;
+    std::array<q15_t, inputSamples> tmp1;
+    std::array<q15_t, inputSamples> tmp2;
+};
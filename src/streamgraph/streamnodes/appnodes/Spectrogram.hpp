@@ -8,29 +8,76 @@
 #include "arm_math_types.h"
 #include "dsp/basic_math_functions.h"
 #include "dsp/complex_math_functions.h"
+#if defined(ARM_FLOAT16_SUPPORTED)
+#include "dsp/complex_math_functions_f16.h"
+#endif
+#include <array>
 #include <cstring>
 
 using namespace arm_cmsis_stream;
 
+/*
+
+Bins of the spectrogram sent to the display.
+The bins are the sums of the magnitudes of the FFT (FFT not normalized)
+and are clamped to [0,1].
+
+*/
+class SpectrogramBins
+{
+  public:
+    SpectrogramBins(EventQueue *queue) : ev0(queue)
+    {
+    };
+
+  protected:
+    void clampAndSendBins()
+    {
+        for (int i = 0; i < CONFIG_NB_BINS; i++)
+        {
+            //   bins[i] *= scale;
+            if (bins[i] > 1.0f)
+                bins[i] = 1.0f;
+            if (bins[i] < 0.0f)
+                bins[i] = 0.0f;
+        }
+
+        UniquePtr<float> tensorData(CONFIG_NB_BINS);
+        memcpy(tensorData.get(), bins, sizeof(bins));
+
+        // Spectrogram frames have lower priority than video frames and may be delayed
+        // by video frame processing.
+        // To avoid an overflow of the event queue, spectrogram events are set to
+        // live for 40 ms only (refresh rate is 32 ms per audio packet).
+        // So old spectrogram events are discarded by the event queue and not sent to the display
+        // node.
+        TensorPtr<float> t = TensorPtr<float>::create_with(CONFIG_NB_BINS,std::move(tensorData));
+        
+        bool status = ev0.sendAsyncWithTTL(kNormalPriority, kValue, 40, std::move(t)); // Send the event to the subscribed nodes
+
+        if (!status)
+        {
+            LOG_ERR("Failed to send spectrogram event\n");
+        }
+    }
+
+    float32_t bins[CONFIG_NB_BINS];
+    EventOutput ev0;
+};
+
 template <typename IN, int inputSize>
 class Spectrogram;
 
 template <int inputSamples>
 class Spectrogram<cf32, inputSamples>
-    : public GenericSink<cf32, inputSamples>
+    : public GenericSink<cf32, inputSamples>, public SpectrogramBins
 {
   public:
     Spectrogram(FIFOBase<cf32> &src,EventQueue *queue)
-        : GenericSink<cf32, inputSamples>(src),ev0(queue)
+        : GenericSink<cf32, inputSamples>(src),SpectrogramBins(queue)
     {
-        mag = new float32_t[inputSamples >> 1];
     };
 
-    ~Spectrogram()
-    {
-        delete[] mag;
-    }
-
 
     int run() final
     {
@@ -40,7 +87,7 @@ class Spectrogram<cf32, inputSamples>
         //arm_scale_f32((float32_t*)in, 4.0f, (float32_t*)in, inputSamples);
 
         // We keep half of the complex FFT spectrum
-        arm_cmplx_mag_f32((float32_t *)in, mag, magSamples);
+        arm_cmplx_mag_f32((float32_t *)in, mag.data(), magSamples);
 
 
         float di = 1.0f * CONFIG_NB_BINS / ((float)magSamples);
@@ -55,48 +102,174 @@ class Spectrogram<cf32, inputSamples>
             k += di;
         }
 
+        clampAndSendBins();
+
+        return (CG_SUCCESS);
+    };
+
+    void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
+    {
+        ev0.subscribe(dst, dstPort);
+    }
+
+  protected:
+    std::array<float32_t, (inputSamples >> 1)> mag;
+};
+
+/*
+
+Fixed point spectrograms.
+The bins are accumulated in fixed point and converted to float once.
+The fixed point FFT is scaled down by inputSamples and the magnitude
+is in 2.14 (Q15) or 2.30 (Q31) format: the scale gives the same bins
+as the float spectrogram.
+
+*/
+template <int inputSamples>
+class Spectrogram<cq15, inputSamples>
+    : public GenericSink<cq15, inputSamples>, public SpectrogramBins
+{
+  public:
+    Spectrogram(FIFOBase<cq15> &src,EventQueue *queue)
+        : GenericSink<cq15, inputSamples>(src),SpectrogramBins(queue)
+    {
+    };
+
+
+    int run() final
+    {
+        const int magSamples = inputSamples >> 1;
+        constexpr float32_t scale = (float32_t)inputSamples / 16384.0f;
+        cq15 *in = this->getReadBuffer();
+
+        // We keep half of the complex FFT spectrum
+        arm_cmplx_mag_q15((q15_t *)in, mag.data(), magSamples);
+
+        float di = 1.0f * CONFIG_NB_BINS / ((float)magSamples);
+        float k = 0;
+        memset(acc, 0, sizeof(acc));
+
+        for (int i = 0; i < magSamples; i++)
+        {
+            if (k < CONFIG_NB_BINS)
+                acc[(int)k] += mag[i];
+            k += di;
+        }
+
         for (int i = 0; i < CONFIG_NB_BINS; i++)
         {
-            //   bins[i] *= scale;
-            if (bins[i] > 1.0f)
-                bins[i] = 1.0f;
-            if (bins[i] < 0.0f)
-                bins[i] = 0.0f;
+            bins[i] = scale * acc[i];
         }
 
-        
+        clampAndSendBins();
 
-        UniquePtr<float> tensorData(CONFIG_NB_BINS);
-        memcpy(tensorData.get(), bins, sizeof(bins));
+        return (CG_SUCCESS);
+    };
 
-        // Spectrogram frames have lower priority than video frames and may be delayed
-        // by video frame processing.
-        // To avoid an overflow of the event queue, spectrogram events are set to
-        // live for 40 ms only (refresh rate is 32 ms per audio packet).
-        // So old spectrogram events are discarded by the event queue and not sent to the display
-        // node.
-        TensorPtr<float> t = TensorPtr<float>::create_with(CONFIG_NB_BINS,std::move(tensorData));
-        
-        bool status = ev0.sendAsyncWithTTL(kNormalPriority, kValue, 40, std::move(t)); // Send the event to the subscribed nodes
+    void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
+    {
+        ev0.subscribe(dst, dstPort);
+    }
 
-        if (!status)
+  protected:
+    std::array<q15_t, (inputSamples >> 1)> mag;
+    int32_t acc[CONFIG_NB_BINS];
+};
+
+template <int inputSamples>
+class Spectrogram<cq31, inputSamples>
+    : public GenericSink<cq31, inputSamples>, public SpectrogramBins
+{
+  public:
+    Spectrogram(FIFOBase<cq31> &src,EventQueue *queue)
+        : GenericSink<cq31, inputSamples>(src),SpectrogramBins(queue)
+    {
+    };
+
+
+    int run() final
+    {
+        const int magSamples = inputSamples >> 1;
+        constexpr float32_t scale = (float32_t)inputSamples / 1073741824.0f;
+        cq31 *in = this->getReadBuffer();
+
+        // We keep half of the complex FFT spectrum
+        arm_cmplx_mag_q31((q31_t *)in, mag.data(), magSamples);
+
+        float di = 1.0f * CONFIG_NB_BINS / ((float)magSamples);
+        float k = 0;
+        memset(acc, 0, sizeof(acc));
+
+        for (int i = 0; i < magSamples; i++)
         {
-            LOG_ERR("Failed to send spectrogram event\n");
+            if (k < CONFIG_NB_BINS)
+                acc[(int)k] += mag[i];
+            k += di;
         }
-        
 
+        for (int i = 0; i < CONFIG_NB_BINS; i++)
+        {
+            bins[i] = scale * (float32_t)acc[i];
+        }
 
+        clampAndSendBins();
 
         return (CG_SUCCESS);
     };
 
-    void subscribe(int outputPort, StreamNode &dst, int dstPort)
+    void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
     {
         ev0.subscribe(dst, dstPort);
     }
 
   protected:
-    float32_t *mag;
-    float32_t bins[CONFIG_NB_BINS];
-    EventOutput ev0;
-};
\ No newline at end of file
+    std::array<q31_t, (inputSamples >> 1)> mag;
+    int64_t acc[CONFIG_NB_BINS];
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+// The magnitudes are in f16 and the bins are accumulated in f32
+template <int inputSamples>
+class Spectrogram<cf16, inputSamples>
+    : public GenericSink<cf16, inputSamples>, public SpectrogramBins
+{
+  public:
+    Spectrogram(FIFOBase<cf16> &src,EventQueue *queue)
+        : GenericSink<cf16, inputSamples>(src),SpectrogramBins(queue)
+    {
+    };
+
+
+    int run() final
+    {
+        const int magSamples = inputSamples >> 1;
+        cf16 *in = this->getReadBuffer();
+
+        // We keep half of the complex FFT spectrum
+        arm_cmplx_mag_f16((float16_t *)in, mag.data(), magSamples);
+
+        float di = 1.0f * CONFIG_NB_BINS / ((float)magSamples);
+        float k = 0;
+        memset(bins, 0, sizeof(bins));
+
+        for (int i = 0; i < magSamples; i++)
+        {
+            if (k < CONFIG_NB_BINS)
+                bins[(int)k] += (float32_t)mag[i];
+            k += di;
+        }
+
+        clampAndSendBins();
+
+        return (CG_SUCCESS);
+    };
+
+    void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
+    {
+        ev0.subscribe(dst, dstPort);
+    }
+
+  protected:
+    std::array<float16_t, (inputSamples >> 1)> mag;
+};
+#endif
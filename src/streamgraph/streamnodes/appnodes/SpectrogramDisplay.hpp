@@ -2,14 +2,13 @@
 
 #include "nodes/ZephyrLCD.hpp"
 #include "appnodes/ImgUtils.hpp"
+#include "EventDispatch.hpp"
 
 using namespace arm_cmsis_stream;
 
 class SpectrogramDisplay : public ZephyrLCD
 
 {
-    static constexpr uint16_t refresh = 40; // ms
-
     static constexpr int PADDING_LEFT = 10;
     static constexpr int PADDING_RIGHT = 10;
     static constexpr int PADDING_TOP = 10;
@@ -101,50 +100,35 @@ class SpectrogramDisplay : public ZephyrLCD
 
     }
 
-    void genNewFrame()
-    {
-        // generate a new frame
-        bool canRender = this->renderNewFrame();
-        (void)canRender;
-        // Ask for a new frame to be rendered
-        //Event evt(kDo, kNormalPriority);
-        //evt.setTTL(refresh);
-        //EventQueue::cg_eventQueue->push(LocalDestination{this, 0}, std::move(evt));
-    }
-
     void processEvent(int dstPort, Event &&evt) final override
     {
-        if (evt.event_id == kValue)
-        {
-            if (dstPort == 0)
-            {
-                if (evt.wellFormed<TensorPtr<float>>())
-                {
-                    evt.apply<TensorPtr<float>>(&SpectrogramDisplay::processLeftSpectrogram, *this);
-                }
-            }
+        // kDo : redraw requested by the frame rate governor of ZephyrLCD
+        using Dispatch = EventDispatch<
+            EventHandler<kAnyPort, kDo, void, &SpectrogramDisplay::redraw>,
+            EventHandler<0, kValue, TensorPtr<float>, &SpectrogramDisplay::processLeftSpectrogram>,
+            EventHandler<1, kValue, TensorPtr<float>, &SpectrogramDisplay::processRightSpectrogram>>;
 
-            if (dstPort == 1)
-            {
-                if (evt.wellFormed<TensorPtr<float>>())
-                {
-                    evt.apply<TensorPtr<float>>(&SpectrogramDisplay::processRightSpectrogram, *this);
-                }
-            }
-            genNewFrame();
-        }
-
-        
+        Dispatch::dispatch(*this, dstPort, std::move(evt));
     }
 protected:
-void processLeftSpectrogram(TensorPtr<float> &&frame)
+void redraw()
+    {
+        bool canRender = this->renderIfDirty();
+        (void)canRender;
+    }
+
+    // Left and right spectrograms are coalesced in
+    // the same redraw
+    void processLeftSpectrogram(TensorPtr<float> &&frame)
     {
         leftSpectrogram = std::move(frame);
+        this->requestRedraw();
     }
 
     void processRightSpectrogram(TensorPtr<float> &&frame)
     {
         rightSpectrogram = std::move(frame);
+        this->requestRedraw();
     }
 
    int period_ms_ = 1000;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#if defined(CONFIG_I2S)
+
+/*
+
+Audio capture broker.
+
+The broker owns the I2S RX stream and its memory slab. A capture thread
+reads the slab blocks from the driver and publishes them to all the
+subscribed consumers (one per audio source node). A block is shared by
+all the consumers without copy and is given back to the slab when the
+last consumer has released it.
+
+Each consumer has its own ring of blocks. If a consumer is too slow
+and its ring is full, the oldest block is dropped for this consumer
+only and its overrun counter is incremented. The other consumers are
+not impacted.
+
+So several graphs can read the microphones at the same time.
+
+The stream is started by the first subscription. It is stopped
+CONFIG_I2S_STOP_DELAY_MS after the last consumer has unsubscribed so
+that the next graph can take over the running stream during a context
+switch.
+
+*/
+
+struct audio_broker_block {
+	void *data;
+	size_t size;
+	// Cycle count when the block was received from the driver
+	uint32_t timestamp;
+	// Number of consumers still using the block
+	uint32_t refs;
+};
+
+struct audio_broker_consumer;
+
+extern struct audio_broker_consumer *audio_broker_subscribe(const struct device *i2s,
+							     struct k_mem_slab *mem_slab);
+extern void audio_broker_unsubscribe(struct audio_broker_consumer *consumer);
+
+// Wait for the next block published for this consumer.
+// The block must be released with audio_broker_release.
+// Returns -EAGAIN without a block when the consumer was unsubscribed
+// while waiting, or when the semaphore was given for a block already
+// given back by an unsubscribe (the read can be retried).
+extern int audio_broker_read(struct audio_broker_consumer *consumer,
+			     struct audio_broker_block **block, k_timeout_t timeout);
+extern void audio_broker_release(struct audio_broker_block *block);
+
+// Number of blocks dropped because the consumer was too slow
+extern uint32_t audio_broker_overruns(const struct audio_broker_consumer *consumer);
+
+#endif
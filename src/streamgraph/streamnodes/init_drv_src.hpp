@@ -6,7 +6,23 @@
 extern const struct device *init_audio_source(k_mem_slab **mem_slab_out);
 #endif 
 
+#if defined(CONFIG_AUDIO_SINK)
+extern const struct device *init_audio_sink(k_mem_slab **mem_slab_out);
+#endif
+
 #if defined(CONFIG_DISPLAY)
 extern int init_display();
 extern void clear_display();
-#endif
\ No newline at end of file
+// Faster than clear_display. Used during context switch.
+extern void blank_display();
+#endif
+
+#if defined(CONFIG_FILE_VIDEO_SOURCE)
+#define FILE_VIDEO_MAX_WIDTH  480
+#define FILE_VIDEO_MAX_HEIGHT 272
+#define FILE_VIDEO_NB_FRAMES  CONFIG_FILE_VIDEO_SOURCE_NUM_BUFFERS
+#define FILE_VIDEO_FRAME_SIZE (FILE_VIDEO_MAX_WIDTH * FILE_VIDEO_MAX_HEIGHT * 2) // RGB565
+
+// Frames of ZephyrFileVideoSource
+extern struct k_mem_slab file_video_slab;
+#endif
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "GenericNodes.hpp"
+#include "StreamNode.hpp"
+#include "arm_math_types.h"
+#include "cg_enums.h"
+#include "node_settings_datatype.h"
+
+#include "dsp/basic_math_functions.h"
+#include "dsp/statistics_functions.h"
+
+#include <array>
+#include <cmath>
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Gain computation of the AGC (see agcParams in node_settings_datatype.h).
+
+The envelope is computed once per block from the RMS level of the block.
+The settings are read from the params structure of the graph when its
+version has changed (and is not being updated). A copy is used so that
+a modification during a block has no effect on it.
+
+The node is counted in the nbNodes field of the settings while it
+exists so that the shell can tell whether the settings are used.
+
+*/
+class AGCGainComputer
+{
+  public:
+    AGCGainComputer(struct agcParams &params, int blockSize)
+        : params_(&params), blockSize_(blockSize)
+    {
+        __atomic_fetch_add(&params.nbNodes, 1, __ATOMIC_RELAXED);
+        apply(params);
+        version_ = params.version;
+        envelope_ = targetLevel_;
+        gainDb_ = 0.0f;
+    }
+
+    ~AGCGainComputer()
+    {
+        __atomic_fetch_sub(&params_->nbNodes, 1, __ATOMIC_RELAXED);
+    }
+
+    float32_t gain() const
+    {
+        return gain_;
+    }
+
+    // Gain to reach at the end of the block
+    float32_t update(float32_t rms)
+    {
+        checkParams();
+
+        const float32_t level = 20.0f * log10f(rms + 1e-9f);
+        const float32_t coef = (level > envelope_) ? attack_ : release_;
+        envelope_ = coef * envelope_ + (1.0f - coef) * level;
+
+        // Below the gate the gain is held
+        if (envelope_ >= gateLevel_)
+        {
+            float32_t g = (targetLevel_ - envelope_) * slope_;
+            if (g > maxGain_)
+            {
+                g = maxGain_;
+            }
+            if (g < minGain_)
+            {
+                g = minGain_;
+            }
+            gainDb_ = g;
+        }
+
+        gain_ = powf(10.0f, gainDb_ / 20.0f);
+        return gain_;
+    }
+
+  protected:
+    void checkParams()
+    {
+        const uint32_t v = __atomic_load_n(&params_->version, __ATOMIC_ACQUIRE);
+        if ((v == version_) || (v & 1))
+        {
+            return;
+        }
+
+        const struct agcParams settings = *params_;
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&params_->version, __ATOMIC_RELAXED) != v)
+        {
+            // Updated during the copy. Will be read with next block
+            return;
+        }
+        version_ = v;
+        apply(settings);
+    }
+
+    void apply(const struct agcParams &settings)
+    {
+        const float32_t blockDuration = 1000.0f * blockSize_ / settings.sampleRate;
+        attack_ = (settings.attackTime > 0.0f) ? expf(-blockDuration / settings.attackTime) : 0.0f;
+        release_ = (settings.releaseTime > 0.0f) ? expf(-blockDuration / settings.releaseTime) : 0.0f;
+        slope_ = (settings.ratio > 1.0f) ? 1.0f - 1.0f / settings.ratio : 0.0f;
+        targetLevel_ = settings.targetLevel;
+        gateLevel_ = settings.gateLevel;
+        minGain_ = settings.minGain;
+        maxGain_ = settings.maxGain;
+    }
+
+    struct agcParams *params_;
+    int blockSize_;
+    uint32_t version_;
+
+    float32_t attack_;
+    float32_t release_;
+    float32_t slope_;
+    float32_t targetLevel_;
+    float32_t gateLevel_;
+    float32_t minGain_;
+    float32_t maxGain_;
+
+    float32_t envelope_;
+    float32_t gainDb_;
+    float32_t gain_ = 1.0f;
+};
+
+/*
+
+Automatic gain control / compressor.
+
+The gain is computed per block and is linearly interpolated over the
+block from the gain of the previous block. The gain is applied with
+CMSIS-DSP (Helium when available).
+
+*/
+template <typename IN, int inputSize,
+          typename OUT, int outputSize>
+class AGC;
+
+template <int inputSamples>
+class AGC<float32_t, inputSamples, float32_t, inputSamples> : public GenericNode<float32_t, inputSamples, float32_t, inputSamples>
+{
+  public:
+    AGC(FIFOBase<float32_t> &src, FIFOBase<float32_t> &dst, struct agcParams &params)
+        : GenericNode<float32_t, inputSamples, float32_t, inputSamples>(src, dst),
+          computer(params, inputSamples)
+    {
+        for (int i = 0; i < inputSamples; i++)
+        {
+            ramp[i] = (float32_t)(i + 1) / inputSamples;
+        }
+    };
+
+    int run() final
+    {
+        float32_t *in = this->getReadBuffer();
+        float32_t *out = this->getWriteBuffer();
+
+        float32_t rms;
+        arm_rms_f32(in, inputSamples, &rms);
+
+        const float32_t g0 = computer.gain();
+        const float32_t g1 = computer.update(rms);
+
+        if (g0 == g1)
+        {
+            arm_scale_f32(in, g1, out, inputSamples);
+        }
+        else
+        {
+            arm_scale_f32(ramp.data(), g1 - g0, gains.data(), inputSamples);
+            arm_offset_f32(gains.data(), g0, gains.data(), inputSamples);
+            arm_mult_f32(in, gains.data(), out, inputSamples);
+        }
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    AGCGainComputer computer;
+    std::array<float32_t, inputSamples> ramp;
+    std::array<float32_t, inputSamples> gains;
+};
+
+// The gains are mantissa * 2^shift with a Q15 mantissa. The shift is done
+// after the multiplication so that it saturates only the output.
+template <int inputSamples>
+class AGC<q15_t, inputSamples, q15_t, inputSamples> : public GenericNode<q15_t, inputSamples, q15_t, inputSamples>
+{
+  public:
+    AGC(FIFOBase<q15_t> &src, FIFOBase<q15_t> &dst, struct agcParams &params)
+        : GenericNode<q15_t, inputSamples, q15_t, inputSamples>(src, dst),
+          computer(params, inputSamples)
+    {
+        for (int i = 0; i < inputSamples; i++)
+        {
+            ramp[i] = (q15_t)(32767 * (i + 1) / inputSamples);
+        }
+    };
+
+    int run() final
+    {
+        q15_t *in = this->getReadBuffer();
+        q15_t *out = this->getWriteBuffer();
+
+        q15_t rms;
+        arm_rms_q15(in, inputSamples, &rms);
+
+        float32_t g0 = computer.gain();
+        float32_t g1 = computer.update((float32_t)rms / 32768.0f);
+
+        int shift = 0;
+        float32_t m = (g0 > g1) ? g0 : g1;
+        while (m >= 1.0f)
+        {
+            m /= 2.0f;
+            g0 /= 2.0f;
+            g1 /= 2.0f;
+            shift++;
+        }
+
+        const q15_t m0 = (q15_t)(g0 * 32767.0f);
+        const q15_t m1 = (q15_t)(g1 * 32767.0f);
+
+        if (m0 == m1)
+        {
+            arm_scale_q15(in, m1, shift, out, inputSamples);
+        }
+        else
+        {
+            arm_scale_q15(ramp.data(), (q15_t)(m1 - m0), 0, gains.data(), inputSamples);
+            arm_offset_q15(gains.data(), m0, gains.data(), inputSamples);
+            arm_mult_q15(in, gains.data(), out, inputSamples);
+            if (shift > 0)
+            {
+                arm_shift_q15(out, shift, out, inputSamples);
+            }
+        }
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    AGCGainComputer computer;
+    std::array<q15_t, inputSamples> ramp;
+    std::array<q15_t, inputSamples> gains;
+};
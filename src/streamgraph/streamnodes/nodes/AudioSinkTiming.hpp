@@ -0,0 +1,122 @@
+#pragma once
+
+/*
+
+Timing checks of the audio sinks.
+
+- Period: the sink must consume a block every blockSamples / SAMPLE_RATE.
+  The intervals between two runs and the drift from the real time since
+  the start are measured. A run later than 1.5 period is counted as late.
+- Latency: the time from the capture of the last microphone block read
+  by the ZephyrAudioSource of the same graph (capture_timestamp of the
+  hardwareParams) to the output of the block. The algorithmic delay of
+  the nodes (overlap, filters) is not included.
+- Underruns: the blocks the sink could not output.
+
+The statistics are logged by report() when the sink is paused.
+
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include "node_settings_datatype.h"
+
+class AudioSinkTiming
+{
+      public:
+	explicit AudioSinkTiming(int blockSamples)
+		: periodUs_((uint32_t)(1000000ULL * blockSamples / CONFIG_SAMPLE_RATE))
+	{
+		reset();
+	}
+
+	void reset()
+	{
+		nbBlocks_ = 0;
+		nbLate_ = 0;
+		nbUnderruns_ = 0;
+		minIntervalUs_ = UINT32_MAX;
+		maxIntervalUs_ = 0;
+		nbLatency_ = 0;
+		minLatencyUs_ = UINT32_MAX;
+		maxLatencyUs_ = 0;
+		sumLatencyUs_ = 0;
+	}
+
+	// Called for each block output. outputDelayUs is the duration of the
+	// audio already queued before this block.
+	void block(const struct hardwareParams &settings, uint32_t outputDelayUs = 0)
+	{
+		uint32_t now = k_cycle_get_32();
+		if (nbBlocks_ == 0) {
+			start_ = now;
+		} else {
+			uint32_t interval = k_cyc_to_us_near32(now - last_);
+			if (interval < minIntervalUs_) {
+				minIntervalUs_ = interval;
+			}
+			if (interval > maxIntervalUs_) {
+				maxIntervalUs_ = interval;
+			}
+			if (2 * interval > 3 * periodUs_) {
+				nbLate_++;
+			}
+		}
+		last_ = now;
+		nbBlocks_++;
+
+		// 0 when the graph has no audio source
+		uint32_t captured = __atomic_load_n(&settings.capture_timestamp, __ATOMIC_RELAXED);
+		if (captured != 0) {
+			uint32_t latency = k_cyc_to_us_near32(now - captured) + outputDelayUs;
+			if (latency < minLatencyUs_) {
+				minLatencyUs_ = latency;
+			}
+			if (latency > maxLatencyUs_) {
+				maxLatencyUs_ = latency;
+			}
+			sumLatencyUs_ += latency;
+			nbLatency_++;
+		}
+	}
+
+	// Called for each block dropped by the sink
+	void underrun()
+	{
+		nbUnderruns_++;
+	}
+
+	void report(const char *name) const
+	{
+		if (nbUnderruns_ > 0) {
+			LOG_WRN("%s: %u underruns", name, nbUnderruns_);
+		}
+		if (nbBlocks_ < 2) {
+			return;
+		}
+		int64_t elapsedUs = (int64_t)k_cyc_to_us_near64((uint64_t)(last_ - start_));
+		int64_t expectedUs = (int64_t)(nbBlocks_ - 1) * periodUs_;
+		LOG_INF("%s: %u blocks, period %u us (min %u, max %u), %u late, drift %lld us",
+			name, nbBlocks_, periodUs_, minIntervalUs_, maxIntervalUs_, nbLate_,
+			elapsedUs - expectedUs);
+		if (nbLatency_ > 0) {
+			LOG_INF("%s: latency %u us (min %u, max %u)", name,
+				(uint32_t)(sumLatencyUs_ / nbLatency_), minLatencyUs_, maxLatencyUs_);
+		}
+	}
+
+      protected:
+	uint32_t periodUs_;
+	uint32_t start_{0};
+	uint32_t last_{0};
+	uint32_t nbBlocks_;
+	uint32_t nbLate_;
+	uint32_t nbUnderruns_;
+	uint32_t minIntervalUs_;
+	uint32_t maxIntervalUs_;
+	uint32_t nbLatency_;
+	uint32_t minLatencyUs_;
+	uint32_t maxLatencyUs_;
+	uint64_t sumLatencyUs_;
+};
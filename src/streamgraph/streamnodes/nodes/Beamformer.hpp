@@ -0,0 +1,224 @@
+#pragma once
+
+#include "GenericNodes.hpp"
+#include "StreamNode.hpp"
+#include "arm_math_types.h"
+#include "cg_enums.h"
+
+#include "dsp/basic_math_functions.h"
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+#include <array>
+#include <cmath>
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Delay and sum beamformer for a pair of microphones.
+
+The right channel is assumed to be the left channel delayed by delay
+samples (negative when the right microphone is the closest to the
+source). The left channel is delayed by centerDelay + delay/2 and the
+right channel by centerDelay - delay/2 with fractional delay FIRs so
+that both are aligned, and they are averaged (the 0.5 is in the taps).
+
+The FIRs are windowed sinc with firTaps taps and are run with
+arm_fir_q15 (Helium when available). The output is delayed by
+centerDelay samples.
+
+When adaptive is not 0, the delay is estimated for each block from the
+peak of the cross correlation of the channels for lags in
+[-maxDelay,maxDelay] (refined with a parabolic interpolation) and
+smoothed. Blocks that are too quiet or not correlated enough keep the
+previous estimate. The taps are only recomputed when the delay changes
+by more than delayStep.
+
+When adaptive is 0, the delay argument is used.
+
+*/
+template <typename IN, int inputSize,
+          typename OUT, int outputSize>
+class Beamformer;
+
+template <int inputSamples>
+class Beamformer<sq15, inputSamples, q15_t, inputSamples> : public GenericNode<sq15, inputSamples, q15_t, inputSamples>, public ContextSwitch
+{
+  public:
+    static constexpr int firTaps = 16;
+    static constexpr float32_t centerDelay = 0.5f * (firTaps - 1);
+    static constexpr int maxLag = 4;
+    static constexpr float32_t delayStep = 1.0f / 16.0f;
+
+    static_assert(inputSamples > 2 * maxLag, "Block too small for the delay estimation");
+
+    Beamformer(FIFOBase<sq15> &src, FIFOBase<q15_t> &dst,
+               float32_t delay, float32_t maxDelay, int adaptive)
+        : GenericNode<sq15, inputSamples, q15_t, inputSamples>(src, dst),
+          fixedDelay_(delay), adaptive_(adaptive != 0)
+    {
+        maxDelay_ = fabsf(maxDelay);
+        if (maxDelay_ > maxLag)
+        {
+            maxDelay_ = maxLag;
+        }
+        arm_fir_init_q15(&firLeft, firTaps, tapsLeft.data(), stateLeft.data(), inputSamples);
+        arm_fir_init_q15(&firRight, firTaps, tapsRight.data(), stateRight.data(), inputSamples);
+        reset();
+    };
+
+    int pause() final override
+    {
+        return 0;
+    }
+
+    // The previous samples are not related to the new ones
+    int resume() final override
+    {
+        reset();
+        return 0;
+    }
+
+    int run() final
+    {
+        sq15 *in = this->getReadBuffer();
+        q15_t *out = this->getWriteBuffer();
+
+        for (int i = 0; i < inputSamples; i++)
+        {
+            left[i] = in[i].left;
+            right[i] = in[i].right;
+        }
+
+        if (adaptive_)
+        {
+            estimateDelay();
+        }
+
+        arm_fir_q15(&firLeft, left.data(), out, inputSamples);
+        arm_fir_q15(&firRight, right.data(), delayedRight.data(), inputSamples);
+        arm_add_q15(out, delayedRight.data(), out, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    void reset()
+    {
+        stateLeft.fill(0);
+        stateRight.fill(0);
+        delay_ = fixedDelay_;
+        setTaps(delay_);
+    }
+
+    static void fractionalDelay(float32_t d, q15_t *taps)
+    {
+        std::array<float32_t, firTaps> h;
+        float32_t sum = 0.0f;
+        for (int n = 0; n < firTaps; n++)
+        {
+            float32_t x = n - d;
+            float32_t s = (fabsf(x) < 1e-6f) ? 1.0f : sinf(PI * x) / (PI * x);
+            // Blackman window centered on the delay
+            float32_t w = 2.0f * PI * (x + 0.5f * firTaps) / firTaps;
+            float32_t win = (fabsf(x) < 0.5f * firTaps) ? 0.42f - 0.5f * cosf(w) + 0.08f * cosf(2.0f * w) : 0.0f;
+            h[n] = s * win;
+            sum += h[n];
+        }
+        // Unity gain at DC and 0.5 for the average
+        for (int n = 0; n < firTaps; n++)
+        {
+            h[n] = 0.5f * h[n] / sum;
+        }
+        arm_float_to_q15(h.data(), taps, firTaps);
+    }
+
+    void setTaps(float32_t delay)
+    {
+        tapsDelay_ = delay;
+        fractionalDelay(centerDelay + 0.5f * delay, tapsLeft.data());
+        fractionalDelay(centerDelay - 0.5f * delay, tapsRight.data());
+    }
+
+    void estimateDelay()
+    {
+        constexpr int nb = inputSamples - 2 * maxLag;
+        constexpr float32_t minEnergy = 1e-5f;
+        constexpr float32_t minCorrelation = 0.5f;
+        constexpr float32_t smoothing = 0.9f;
+
+        q63_t acc;
+        arm_dot_prod_q15(left.data() + maxLag, left.data() + maxLag, nb, &acc);
+        const float32_t el = (float32_t)acc / (1LL << 30);
+        arm_dot_prod_q15(right.data() + maxLag, right.data() + maxLag, nb, &acc);
+        const float32_t er = (float32_t)acc / (1LL << 30);
+
+        if ((el < minEnergy * nb) || (er < minEnergy * nb))
+        {
+            return;
+        }
+
+        // corr[maxLag + k] = sum left[n] right[n + k]
+        const int lags = (int)ceilf(maxDelay_);
+        std::array<float32_t, 2 * maxLag + 1> corr;
+        int best = 0;
+        for (int k = -lags; k <= lags; k++)
+        {
+            arm_dot_prod_q15(left.data() + maxLag, right.data() + maxLag + k, nb, &acc);
+            corr[maxLag + k] = (float32_t)acc / (1LL << 30);
+            if (corr[maxLag + k] > corr[maxLag + best])
+            {
+                best = k;
+            }
+        }
+
+        if (corr[maxLag + best] < minCorrelation * sqrtf(el * er))
+        {
+            return;
+        }
+
+        float32_t d = (float32_t)best;
+        if ((best > -lags) && (best < lags))
+        {
+            const float32_t cm = corr[maxLag + best - 1];
+            const float32_t c0 = corr[maxLag + best];
+            const float32_t cp = corr[maxLag + best + 1];
+            const float32_t den = cm - 2.0f * c0 + cp;
+            if (den < 0.0f)
+            {
+                d += 0.5f * (cm - cp) / den;
+            }
+        }
+        if (d > maxDelay_)
+        {
+            d = maxDelay_;
+        }
+        if (d < -maxDelay_)
+        {
+            d = -maxDelay_;
+        }
+
+        delay_ = smoothing * delay_ + (1.0f - smoothing) * d;
+        if (fabsf(delay_ - tapsDelay_) > delayStep)
+        {
+            setTaps(delay_);
+        }
+    }
+
+    float32_t fixedDelay_;
+    float32_t maxDelay_;
+    bool adaptive_;
+    float32_t delay_;
+    float32_t tapsDelay_;
+
+    arm_fir_instance_q15 firLeft;
+    arm_fir_instance_q15 firRight;
+    std::array<q15_t, firTaps> tapsLeft;
+    std::array<q15_t, firTaps> tapsRight;
+    std::array<q15_t, firTaps + inputSamples - 1> stateLeft;
+    std::array<q15_t, firTaps + inputSamples - 1> stateRight;
+    std::array<q15_t, inputSamples> left;
+    std::array<q15_t, inputSamples> right;
+    std::array<q15_t, inputSamples> delayedRight;
+};
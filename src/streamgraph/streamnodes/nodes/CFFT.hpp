@@ -7,6 +7,9 @@
 #include "arm_math_types.h"
 
 #include "dsp/transform_functions.h"
+#if defined(ARM_FLOAT16_SUPPORTED)
+#include "dsp/transform_functions_f16.h"
+#endif
 #include <cstring>
 
 using namespace arm_cmsis_stream;
@@ -49,4 +52,89 @@ class CFFT<cf32, inputSamples, cf32, inputSamples> : public GenericNode<cf32, in
 
   protected:
     arm_cfft_instance_f32 varInstCfftF32;
-};
\ No newline at end of file
+};
+
+// The fixed point FFTs scale the output down by the FFT length
+// (for 1024 samples, a Q15 input gives a 11.5 output)
+template <int inputSamples>
+class CFFT<cq15, inputSamples, cq15, inputSamples> : public GenericNode<cq15, inputSamples, cq15, inputSamples>
+{
+  public:
+    CFFT(FIFOBase<cq15> &src, FIFOBase<cq15> &dst)
+        : GenericNode<cq15, inputSamples, cq15, inputSamples>(src, dst)
+    {
+        static_assert((inputSamples >= 16) && (inputSamples <= 4096) && ((inputSamples & (inputSamples - 1)) == 0),
+                      "Unsupported FFT size");
+        arm_cfft_init_q15(&varInstCfftQ15, inputSamples);
+    };
+
+    int run() final
+    {
+        cq15 *o = this->getWriteBuffer();
+        cq15 *in = this->getReadBuffer();
+
+        memcpy(o, in, sizeof(cq15) * inputSamples);
+        arm_cfft_q15(&varInstCfftQ15, (q15_t *)o, 0, 1);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    arm_cfft_instance_q15 varInstCfftQ15;
+};
+
+template <int inputSamples>
+class CFFT<cq31, inputSamples, cq31, inputSamples> : public GenericNode<cq31, inputSamples, cq31, inputSamples>
+{
+  public:
+    CFFT(FIFOBase<cq31> &src, FIFOBase<cq31> &dst)
+        : GenericNode<cq31, inputSamples, cq31, inputSamples>(src, dst)
+    {
+        static_assert((inputSamples >= 16) && (inputSamples <= 4096) && ((inputSamples & (inputSamples - 1)) == 0),
+                      "Unsupported FFT size");
+        arm_cfft_init_q31(&varInstCfftQ31, inputSamples);
+    };
+
+    int run() final
+    {
+        cq31 *o = this->getWriteBuffer();
+        cq31 *in = this->getReadBuffer();
+
+        memcpy(o, in, sizeof(cq31) * inputSamples);
+        arm_cfft_q31(&varInstCfftQ31, (q31_t *)o, 0, 1);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    arm_cfft_instance_q31 varInstCfftQ31;
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template <int inputSamples>
+class CFFT<cf16, inputSamples, cf16, inputSamples> : public GenericNode<cf16, inputSamples, cf16, inputSamples>
+{
+  public:
+    CFFT(FIFOBase<cf16> &src, FIFOBase<cf16> &dst)
+        : GenericNode<cf16, inputSamples, cf16, inputSamples>(src, dst)
+    {
+        static_assert((inputSamples >= 16) && (inputSamples <= 4096) && ((inputSamples & (inputSamples - 1)) == 0),
+                      "Unsupported FFT size");
+        arm_cfft_init_f16(&varInstCfftF16, inputSamples);
+    };
+
+    int run() final
+    {
+        cf16 *o = this->getWriteBuffer();
+        cf16 *in = this->getReadBuffer();
+
+        memcpy(o, in, sizeof(cf16) * inputSamples);
+        arm_cfft_f16(&varInstCfftF16, (float16_t *)o, 0, 1);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    arm_cfft_instance_f16 varInstCfftF16;
+};
+#endif
@@ -6,6 +6,9 @@
 #include "arm_math_types.h"
 
 #include "dsp/support_functions.h"
+#if defined(ARM_FLOAT16_SUPPORTED)
+#include "dsp/support_functions_f16.h"
+#endif
 
 
 using namespace arm_cmsis_stream;
@@ -66,4 +69,79 @@ class Convert<q15_t, inputSamples, float, inputSamples> : public GenericNode<q15
 
         return (CG_SUCCESS);
     };
-};
\ No newline at end of file
+};
+
+template <int inputSamples>
+class Convert<q15_t, inputSamples, q31_t, inputSamples> : public GenericNode<q15_t, inputSamples, q31_t, inputSamples>
+{
+  public:
+    Convert(FIFOBase<q15_t> &src, FIFOBase<q31_t> &dst)
+        : GenericNode<q15_t, inputSamples, q31_t, inputSamples>(src, dst) {};
+
+
+    int run() final
+    {
+        q31_t *o = this->getWriteBuffer();
+        q15_t *in = this->getReadBuffer();
+        arm_q15_to_q31(in, o, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+// Conversions at the edges of a f16 part of a graph
+template <int inputSamples>
+class Convert<q15_t, inputSamples, float16_t, inputSamples> : public GenericNode<q15_t, inputSamples, float16_t, inputSamples>
+{
+  public:
+    Convert(FIFOBase<q15_t> &src, FIFOBase<float16_t> &dst)
+        : GenericNode<q15_t, inputSamples, float16_t, inputSamples>(src, dst) {};
+
+
+    int run() final
+    {
+        float16_t *o = this->getWriteBuffer();
+        q15_t *in = this->getReadBuffer();
+        arm_q15_to_f16(in, o, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+};
+
+template <int inputSamples>
+class Convert<float, inputSamples, float16_t, inputSamples> : public GenericNode<float, inputSamples, float16_t, inputSamples>
+{
+  public:
+    Convert(FIFOBase<float> &src, FIFOBase<float16_t> &dst)
+        : GenericNode<float, inputSamples, float16_t, inputSamples>(src, dst) {};
+
+
+    int run() final
+    {
+        float16_t *o = this->getWriteBuffer();
+        float *in = this->getReadBuffer();
+        arm_float_to_f16(in, o, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+};
+
+template <int inputSamples>
+class Convert<float16_t, inputSamples, float, inputSamples> : public GenericNode<float16_t, inputSamples, float, inputSamples>
+{
+  public:
+    Convert(FIFOBase<float16_t> &src, FIFOBase<float> &dst)
+        : GenericNode<float16_t, inputSamples, float, inputSamples>(src, dst) {};
+
+
+    int run() final
+    {
+        float *o = this->getWriteBuffer();
+        float16_t *in = this->getReadBuffer();
+        arm_f16_to_float(in, o, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+};
+#endif
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "EventQueue.hpp"
+#include "GenericNodes.hpp"
+#include "StreamNode.hpp"
+#include "arm_math_types.h"
+#include "cg_enums.h"
+#include "EventDispatch.hpp"
+
+using namespace arm_cmsis_stream;
+
+#define FRAME_MAILBOX_MAX_SLOTS 4
+
+/*
+
+Latest frame wins mailbox between a video producer and a slow consumer.
+
+Input event port 0 : frames from the producer
+Input event port 1 : request for a new frame from the consumer (any event)
+Output event port 0: frames to the consumer
+
+The mailbox keeps at most nbSlots frames. When a new frame arrives and
+the mailbox is full, the oldest frame is released immediately (so that the
+producer can reuse its buffer) and the drop is counted.
+When the consumer requests a frame and the mailbox is empty, the next
+frame received is forwarded directly.
+
+So the producer is never stalled by the consumer and the consumer
+always gets the most recent frames.
+
+*/
+class FrameMailbox : public StreamNode, public ContextSwitch
+{
+  public:
+    using Frame = TensorPtr<const uint16_t>;
+
+    FrameMailbox(EventQueue *queue, int nbSlots = 1)
+        : StreamNode(), ev(queue)
+    {
+        nbSlots_ = nbSlots;
+        if (nbSlots_ < 1)
+        {
+            nbSlots_ = 1;
+        }
+        if (nbSlots_ > FRAME_MAILBOX_MAX_SLOTS)
+        {
+            nbSlots_ = FRAME_MAILBOX_MAX_SLOTS;
+        }
+    }
+
+    virtual ~FrameMailbox()
+    {
+    }
+
+    int pause() final override
+    {
+        // Give the frames back to the producer
+        clear();
+        return 0;
+    }
+
+    int resume() final override
+    {
+        clear();
+        waiting_ = true;
+        return 0;
+    }
+
+    uint32_t droppedFrames() const
+    {
+        return dropped_;
+    }
+
+    void processEvent(int dstPort, Event &&evt) final override
+    {
+        using Dispatch = EventDispatch<
+            EventHandler<0, kValue, Frame, &FrameMailbox::receiveFrame>,
+            EventHandler<1, kAnyEvent, void, &FrameMailbox::frameRequested>>;
+
+        Dispatch::dispatch(*this, dstPort, std::move(evt));
+    }
+
+    void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
+    {
+        if (outputPort == 0)
+        {
+            ev.subscribe(dst, dstPort);
+        }
+    }
+
+  protected:
+    void frameRequested()
+    {
+        if (nb_ > 0)
+        {
+            Frame f = std::move(slots_[head_]);
+            head_ = (head_ + 1) % nbSlots_;
+            nb_--;
+            waiting_ = false;
+            ev.sendSync(kNormalPriority, kValue, std::move(f));
+        }
+        else
+        {
+            waiting_ = true;
+        }
+    }
+
+    void receiveFrame(Frame &&frame)
+    {
+        if (waiting_)
+        {
+            waiting_ = false;
+            ev.sendSync(kNormalPriority, kValue, std::move(frame));
+            return;
+        }
+
+        if (nb_ == nbSlots_)
+        {
+            // Release the oldest frame
+            slots_[head_] = Frame();
+            head_ = (head_ + 1) % nbSlots_;
+            nb_--;
+            dropped_++;
+        }
+
+        slots_[(head_ + nb_) % nbSlots_] = std::move(frame);
+        nb_++;
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < FRAME_MAILBOX_MAX_SLOTS; i++)
+        {
+            slots_[i] = Frame();
+        }
+        head_ = 0;
+        nb_ = 0;
+    }
+
+    EventOutput ev;
+    Frame slots_[FRAME_MAILBOX_MAX_SLOTS];
+    int nbSlots_;
+    int head_{0};
+    int nb_{0};
+    bool waiting_{true};
+    uint32_t dropped_{0};
+};
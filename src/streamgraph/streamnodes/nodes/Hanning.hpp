@@ -6,6 +6,11 @@
 #include "arm_math_types.h"
 #include "dsp/basic_math_functions.h"
 #include "dsp/window_functions.h"
+#if defined(ARM_FLOAT16_SUPPORTED)
+#include "dsp/basic_math_functions_f16.h"
+#endif
+#include <array>
+#include <cmath>
 #include <cstring>
 
 
@@ -21,15 +26,9 @@ class Hanning<float32_t, inputSamples, float32_t, outputSamples> : public Generi
     Hanning(FIFOBase<float32_t> &src, FIFOBase<float32_t> &dst)
         : GenericNode<float32_t, inputSamples, float32_t, outputSamples>(src, dst)
     {
-        window = new float32_t[inputSamples];
-        arm_hanning_f32(window, inputSamples);
+        arm_hanning_f32(window.data(), inputSamples);
     };
 
-    ~Hanning()
-    {
-        delete[] window;
-    }
-
     
     int run() final
     {
@@ -37,12 +36,112 @@ class Hanning<float32_t, inputSamples, float32_t, outputSamples> : public Generi
         float32_t *out = this->getWriteBuffer();
 
         memset(out, 0, sizeof(float32_t) * outputSamples);
-        arm_mult_f32(in, window, out + offset, inputSamples);
+        arm_mult_f32(in, window.data(), out + offset, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    std::array<float32_t, inputSamples> window;
+    static constexpr int offset = (outputSamples - inputSamples) >> 1;
+};
+
+// Same window as arm_hanning_f32 for the fixed point specializations
+static inline float32_t hanningCoef(int i, int blockSize)
+{
+    return 0.5f * (1.0f - cosf(PI * i * 2.0f / (float32_t)blockSize));
+}
+
+// The signal stays in Q15 up to the spectrogram. The window is in Q15
+// (1.0 is saturated to 0x7FFF).
+template <int inputSamples, int outputSamples>
+class Hanning<q15_t, inputSamples, q15_t, outputSamples> : public GenericNode<q15_t, inputSamples, q15_t, outputSamples>
+{
+  public:
+    Hanning(FIFOBase<q15_t> &src, FIFOBase<q15_t> &dst)
+        : GenericNode<q15_t, inputSamples, q15_t, outputSamples>(src, dst)
+    {
+        for (int i = 0; i < inputSamples; i++)
+        {
+            float32_t w = hanningCoef(i, inputSamples) * 32768.0f;
+            window[i] = (w >= 32767.0f) ? (q15_t)0x7FFF : (q15_t)w;
+        }
+    };
+
+    int run() final
+    {
+        q15_t *in = this->getReadBuffer();
+        q15_t *out = this->getWriteBuffer();
+
+        memset(out, 0, sizeof(q15_t) * outputSamples);
+        arm_mult_q15(in, window.data(), out + offset, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    std::array<q15_t, inputSamples> window;
+    static constexpr int offset = (outputSamples - inputSamples) >> 1;
+};
+
+template <int inputSamples, int outputSamples>
+class Hanning<q31_t, inputSamples, q31_t, outputSamples> : public GenericNode<q31_t, inputSamples, q31_t, outputSamples>
+{
+  public:
+    Hanning(FIFOBase<q31_t> &src, FIFOBase<q31_t> &dst)
+        : GenericNode<q31_t, inputSamples, q31_t, outputSamples>(src, dst)
+    {
+        for (int i = 0; i < inputSamples; i++)
+        {
+            float32_t w = hanningCoef(i, inputSamples) * 2147483648.0f;
+            window[i] = (w >= 2147483647.0f) ? (q31_t)0x7FFFFFFF : (q31_t)w;
+        }
+    };
+
+    int run() final
+    {
+        q31_t *in = this->getReadBuffer();
+        q31_t *out = this->getWriteBuffer();
+
+        memset(out, 0, sizeof(q31_t) * outputSamples);
+        arm_mult_q31(in, window.data(), out + offset, inputSamples);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    std::array<q31_t, inputSamples> window;
+    static constexpr int offset = (outputSamples - inputSamples) >> 1;
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+// Half the FIFO memory of f32 and 8 lanes per MVE instruction
+template <int inputSamples, int outputSamples>
+class Hanning<float16_t, inputSamples, float16_t, outputSamples> : public GenericNode<float16_t, inputSamples, float16_t, outputSamples>
+{
+  public:
+    Hanning(FIFOBase<float16_t> &src, FIFOBase<float16_t> &dst)
+        : GenericNode<float16_t, inputSamples, float16_t, outputSamples>(src, dst)
+    {
+        for (int i = 0; i < inputSamples; i++)
+        {
+            window[i] = (float16_t)hanningCoef(i, inputSamples);
+        }
+    };
+
+    int run() final
+    {
+        float16_t *in = this->getReadBuffer();
+        float16_t *out = this->getWriteBuffer();
+
+        memset(out, 0, sizeof(float16_t) * outputSamples);
+        arm_mult_f16(in, window.data(), out + offset, inputSamples);
 
         return (CG_SUCCESS);
     };
 
   protected:
-    float32_t *window;
+    std::array<float16_t, inputSamples> window;
     static constexpr int offset = (outputSamples - inputSamples) >> 1;
-};
\ No newline at end of file
+};
+#endif
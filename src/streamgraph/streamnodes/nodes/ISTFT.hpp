@@ -0,0 +1,108 @@
+#pragma once
+
+#include "STFT.hpp"
+
+/*
+
+Inverse STFT with weighted overlap add.
+
+The input is the packed spectrum produced by a STFT node with the same
+fftSize, hop, window length and window. Each run outputs hop samples.
+
+The synthesis window is the analysis window. The output is normalized
+by the sum of the products of the analysis and synthesis windows
+overlapping at each position so that STFT followed by ISTFT gives back
+the input delayed by windowLength - hop samples, whatever the window
+and hop.
+
+The inverse FFT is computed in place in the input FIFO (the CMSIS-DSP
+inverse RFFT uses its input as a scratch buffer).
+
+*/
+template <typename IN, int inputSize,
+          typename OUT, int outputSize>
+class ISTFT;
+
+template <int nbBins, int hop>
+class ISTFT<cf32, nbBins, float32_t, hop> : public GenericNode<cf32, nbBins, float32_t, hop>, public ContextSwitch
+{
+  public:
+    static constexpr int fftSize = 2 * nbBins;
+    static_assert((fftSize >= 32) && (fftSize <= 4096) && ((fftSize & (fftSize - 1)) == 0),
+                  "Unsupported FFT size");
+
+    ISTFT(FIFOBase<cf32> &src, FIFOBase<float32_t> &dst, int windowLength, STFTWindow window)
+        : GenericNode<cf32, nbBins, float32_t, hop>(src, dst), windowLength_(windowLength)
+    {
+        arm_rfft_fast_init_f32(&rfft, fftSize);
+        for (int i = 0; i < fftSize; i++)
+        {
+            window_[i] = (i < windowLength) ? stftWindowCoef(window, i, windowLength) : 0.0f;
+        }
+
+        valid_ = (windowLength >= hop) && (windowLength <= fftSize);
+        for (int n = 0; n < hop; n++)
+        {
+            float32_t s = 0.0f;
+            for (int k = n; k < windowLength; k += hop)
+            {
+                s += window_[k] * window_[k];
+            }
+            if (s < 1e-6f)
+            {
+                valid_ = false;
+                s = 1.0f;
+            }
+            normalization[n] = 1.0f / s;
+        }
+
+        overlap.fill(0.0f);
+    };
+
+    // The window must overlap all the samples
+    cg_status init() final override
+    {
+        if (!valid_)
+        {
+            return (CG_INIT_FAILURE);
+        }
+        return (CG_SUCCESS);
+    }
+
+    int pause() final override
+    {
+        return 0;
+    }
+
+    int resume() final override
+    {
+        overlap.fill(0.0f);
+        return 0;
+    }
+
+    int run() final
+    {
+        cf32 *in = this->getReadBuffer();
+        float32_t *out = this->getWriteBuffer();
+
+        arm_rfft_fast_f32(&rfft, (float32_t *)in, frame.data(), 1);
+        arm_mult_f32(frame.data(), window_.data(), frame.data(), windowLength_);
+        arm_add_f32(overlap.data(), frame.data(), overlap.data(), windowLength_);
+
+        arm_mult_f32(overlap.data(), normalization.data(), out, hop);
+
+        memmove(overlap.data(), overlap.data() + hop, (windowLength_ - hop) * sizeof(float32_t));
+        memset(overlap.data() + windowLength_ - hop, 0, hop * sizeof(float32_t));
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    arm_rfft_fast_instance_f32 rfft;
+    int windowLength_;
+    bool valid_;
+    std::array<float32_t, fftSize> window_;
+    std::array<float32_t, hop> normalization;
+    std::array<float32_t, fftSize> overlap;
+    std::array<float32_t, fftSize> frame;
+};
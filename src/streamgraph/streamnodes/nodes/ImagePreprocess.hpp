@@ -0,0 +1,348 @@
+#pragma once
+
+#include "EventQueue.hpp"
+#include "GenericNodes.hpp"
+#include "StreamNode.hpp"
+#include "arm_math_types.h"
+#include "cg_enums.h"
+#include "EventDispatch.hpp"
+
+#include <new>
+
+extern "C" {
+#include "node_settings_datatype.h"
+}
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Convert a RGB565 camera frame into an int8 tensor for a vision network.
+
+The processing is done in one pass over the frame:
+- Crop of the region of interest
+- Bilinear resize (Q8 fixed point weights)
+- RGB565 to RGB888 or grayscale
+- Per channel normalization and quantization
+
+For each output row, the two source rows are blended vertically into
+a small scratch row (vectorized with Helium when available). The
+horizontal interpolation then uses precomputed indexes and weights.
+Normalization and quantization of a channel is a 256 entries look-up table
+computed at init.
+
+Output tensor is NHWC without the batch dimension: {height,width,channels}.
+
+Input event port 0 is the frame.
+When flow control is enabled, the node forwards a new tensor only
+after an event has been received on input port 1 (for instance the ack
+from the TFLite node). Frames received in between are dropped.
+
+*/
+class ImagePreprocess : public StreamNode, public ContextSwitch
+{
+  public:
+    ImagePreprocess(EventQueue *queue, const struct imagePreprocessParams &params,
+                    bool flowControl = false)
+        : StreamNode(), ev(queue), params_(params), flowControl_(flowControl)
+    {
+    }
+
+    virtual ~ImagePreprocess()
+    {
+        delete[] scratch_;
+        delete[] xIdx_;
+        delete[] xFrac_;
+    }
+
+    cg_status init() final override
+    {
+        roiX_ = params_.roiX;
+        roiY_ = params_.roiY;
+        roiW_ = params_.roiWidth;
+        roiH_ = params_.roiHeight;
+        if ((roiW_ <= 0) || (roiH_ <= 0))
+        {
+            roiX_ = 0;
+            roiY_ = 0;
+            roiW_ = params_.frameWidth;
+            roiH_ = params_.frameHeight;
+        }
+
+        if ((roiX_ < 0) || (roiY_ < 0) || (roiW_ <= 0) || (roiH_ <= 0) ||
+            (roiX_ + roiW_ > params_.frameWidth) ||
+            (roiY_ + roiH_ > params_.frameHeight) ||
+            (params_.outWidth <= 0) || (params_.outHeight <= 0) ||
+            (params_.scale == 0.0f))
+        {
+            LOG_ERR("ImagePreprocess: invalid settings\n");
+            return CG_INIT_FAILURE;
+        }
+
+        channels_ = params_.grayscale ? 1 : 3;
+
+        scratch_ = new (std::nothrow) uint8_t[3 * roiW_];
+        xIdx_ = new (std::nothrow) uint16_t[params_.outWidth];
+        xFrac_ = new (std::nothrow) uint16_t[params_.outWidth];
+        if ((scratch_ == nullptr) || (xIdx_ == nullptr) || (xFrac_ == nullptr))
+        {
+            return CG_MEMORY_ALLOCATION_FAILURE;
+        }
+
+        for (int x = 0; x < params_.outWidth; x++)
+        {
+            int idx, frac;
+            sourceCoordinate(x, params_.outWidth, roiW_, idx, frac);
+            xIdx_[x] = (uint16_t)idx;
+            xFrac_[x] = (uint16_t)frac;
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            const float stdv = (params_.std[c] != 0.0f) ? params_.std[c] : 1.0f;
+            for (int v = 0; v < 256; v++)
+            {
+                float n = ((float)v / 255.0f - params_.mean[c]) / stdv;
+                float q = n / params_.scale + (float)params_.zero_point;
+                int32_t r = (int32_t)(q >= 0.0f ? q + 0.5f : q - 0.5f);
+                lut_[c][v] = (int8_t)__SSAT(r, 8);
+            }
+        }
+
+        return CG_SUCCESS;
+    }
+
+    int pause() final override
+    {
+        return 0;
+    }
+
+    int resume() final override
+    {
+        ready_ = true;
+        return 0;
+    }
+
+    uint32_t droppedFrames() const
+    {
+        return dropped_;
+    }
+
+    void processEvent(int dstPort, Event &&evt) final override
+    {
+        using Dispatch = EventDispatch<
+            EventHandler<0, kValue, TensorPtr<const uint16_t>, &ImagePreprocess::receiveFrame>,
+            EventHandler<1, kAnyEvent, void, &ImagePreprocess::consumerReady>>;
+
+        Dispatch::dispatch(*this, dstPort, std::move(evt));
+    }
+
+    void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
+    {
+        if (outputPort == 0)
+        {
+            ev.subscribe(dst, dstPort);
+        }
+    }
+
+  protected:
+    // Map output coordinate to source coordinate (pixel centers aligned)
+    // Result is an integer index and a Q8 fractional part.
+    static void sourceCoordinate(int o, int outSize, int inSize, int &idx, int &frac)
+    {
+        int32_t s = (int32_t)((((int64_t)(2 * o + 1) * inSize * 256) / (2 * outSize)) - 128);
+        if (s < 0)
+        {
+            s = 0;
+        }
+        idx = s >> 8;
+        frac = s & 0xFF;
+        if (idx >= inSize - 1)
+        {
+            idx = inSize - 1;
+            frac = 0;
+        }
+    }
+
+    // Vertical interpolation of two RGB565 rows into the 8 bits
+    // R, G and B planes of the scratch row.
+    void blendRows(const uint16_t *row0, const uint16_t *row1, uint16_t fy)
+    {
+        uint8_t *pR = scratch_;
+        uint8_t *pG = scratch_ + roiW_;
+        uint8_t *pB = scratch_ + 2 * roiW_;
+        const uint16_t wy0 = 256 - fy;
+        int i = 0;
+
+#if defined(ARM_MATH_MVEI)
+        // 255 * 256 fits in 16 bits so the blend can be done in u16
+        for (; i <= roiW_ - 8; i += 8)
+        {
+            uint16x8_t p0 = vld1q_u16(row0 + i);
+            uint16x8_t p1 = vld1q_u16(row1 + i);
+
+            uint16x8_t r0 = vshrq_n_u16(p0, 11);
+            uint16x8_t r1 = vshrq_n_u16(p1, 11);
+            r0 = vorrq_u16(vshlq_n_u16(r0, 3), vshrq_n_u16(r0, 2));
+            r1 = vorrq_u16(vshlq_n_u16(r1, 3), vshrq_n_u16(r1, 2));
+
+            uint16x8_t g0 = vandq_u16(vshrq_n_u16(p0, 5), vdupq_n_u16(0x3F));
+            uint16x8_t g1 = vandq_u16(vshrq_n_u16(p1, 5), vdupq_n_u16(0x3F));
+            g0 = vorrq_u16(vshlq_n_u16(g0, 2), vshrq_n_u16(g0, 4));
+            g1 = vorrq_u16(vshlq_n_u16(g1, 2), vshrq_n_u16(g1, 4));
+
+            uint16x8_t b0 = vandq_u16(p0, vdupq_n_u16(0x1F));
+            uint16x8_t b1 = vandq_u16(p1, vdupq_n_u16(0x1F));
+            b0 = vorrq_u16(vshlq_n_u16(b0, 3), vshrq_n_u16(b0, 2));
+            b1 = vorrq_u16(vshlq_n_u16(b1, 3), vshrq_n_u16(b1, 2));
+
+            uint16x8_t r = vmlaq_n_u16(vmulq_n_u16(r0, wy0), r1, fy);
+            uint16x8_t g = vmlaq_n_u16(vmulq_n_u16(g0, wy0), g1, fy);
+            uint16x8_t b = vmlaq_n_u16(vmulq_n_u16(b0, wy0), b1, fy);
+
+            vstrbq_u16(pR + i, vshrq_n_u16(r, 8));
+            vstrbq_u16(pG + i, vshrq_n_u16(g, 8));
+            vstrbq_u16(pB + i, vshrq_n_u16(b, 8));
+        }
+#endif
+        for (; i < roiW_; i++)
+        {
+            const uint16_t p0 = row0[i];
+            const uint16_t p1 = row1[i];
+            uint16_t r0 = p0 >> 11, r1 = p1 >> 11;
+            uint16_t g0 = (p0 >> 5) & 0x3F, g1 = (p1 >> 5) & 0x3F;
+            uint16_t b0 = p0 & 0x1F, b1 = p1 & 0x1F;
+            r0 = (r0 << 3) | (r0 >> 2);
+            r1 = (r1 << 3) | (r1 >> 2);
+            g0 = (g0 << 2) | (g0 >> 4);
+            g1 = (g1 << 2) | (g1 >> 4);
+            b0 = (b0 << 3) | (b0 >> 2);
+            b1 = (b1 << 3) | (b1 >> 2);
+            pR[i] = (uint8_t)((r0 * wy0 + r1 * fy) >> 8);
+            pG[i] = (uint8_t)((g0 * wy0 + g1 * fy) >> 8);
+            pB[i] = (uint8_t)((b0 * wy0 + b1 * fy) >> 8);
+        }
+    }
+
+    static uint8_t lerp(const uint8_t *p, int i0, int i1, uint16_t fx)
+    {
+        return (uint8_t)((p[i0] * (256 - fx) + p[i1] * fx) >> 8);
+    }
+
+    // Horizontal interpolation, color conversion and quantization
+    // of one output row
+    void outputRow(int8_t *dst)
+    {
+        const uint8_t *pR = scratch_;
+        const uint8_t *pG = scratch_ + roiW_;
+        const uint8_t *pB = scratch_ + 2 * roiW_;
+        for (int x = 0; x < params_.outWidth; x++)
+        {
+            const int i0 = xIdx_[x];
+            const int i1 = (i0 + 1 < roiW_) ? i0 + 1 : i0;
+            const uint16_t fx = xFrac_[x];
+            const uint8_t r = lerp(pR, i0, i1, fx);
+            const uint8_t g = lerp(pG, i0, i1, fx);
+            const uint8_t b = lerp(pB, i0, i1, fx);
+            if (channels_ == 1)
+            {
+                // ITU-R BT.601 luma in Q8
+                const uint8_t y = (uint8_t)((77 * r + 150 * g + 29 * b) >> 8);
+                *dst++ = lut_[0][y];
+            }
+            else
+            {
+                *dst++ = lut_[0][r];
+                *dst++ = lut_[1][g];
+                *dst++ = lut_[2][b];
+            }
+        }
+    }
+
+    void consumerReady()
+    {
+        ready_ = true;
+    }
+
+    void receiveFrame(TensorPtr<const uint16_t> &&frame)
+    {
+        if (flowControl_ && !ready_)
+        {
+            dropped_++;
+            return;
+        }
+        processFrame(std::move(frame));
+    }
+
+    void processFrame(TensorPtr<const uint16_t> &&frame)
+    {
+        const int outW = params_.outWidth;
+        const int outH = params_.outHeight;
+        UniquePtr<int8_t> tensorData(outW * outH * channels_);
+        if (tensorData.get() == nullptr)
+        {
+            LOG_ERR("ImagePreprocess: not enough memory for output tensor\n");
+            return;
+        }
+
+        bool lockError;
+        bool ok = false;
+        frame.lock_shared(lockError, [this, &tensorData, &ok, outW, outH](const Tensor<const uint16_t> &tensor)
+        {
+            const uint16_t *buf = tensor.buffer();
+            if ((buf == nullptr) ||
+                ((int)tensor.dims[0] != params_.frameHeight) ||
+                ((int)tensor.dims[1] != params_.frameWidth))
+            {
+                LOG_ERR("ImagePreprocess: unexpected frame size\n");
+                return;
+            }
+
+            const uint16_t *roi = buf + roiY_ * params_.frameWidth + roiX_;
+            int8_t *dst = tensorData.get();
+            for (int y = 0; y < outH; y++)
+            {
+                int y0, fy;
+                sourceCoordinate(y, outH, roiH_, y0, fy);
+                const int y1 = (y0 + 1 < roiH_) ? y0 + 1 : y0;
+                blendRows(roi + y0 * params_.frameWidth,
+                          roi + y1 * params_.frameWidth,
+                          (uint16_t)fy);
+                outputRow(dst);
+                dst += outW * channels_;
+            }
+            ok = true;
+        });
+
+        if (lockError || !ok)
+        {
+            return;
+        }
+
+        TensorPtr<int8_t> t = TensorPtr<int8_t>::create_with((uint8_t)3,
+                                                             cg_tensor_dims_t{(uint32_t)outH, (uint32_t)outW, (uint32_t)channels_},
+                                                             std::move(tensorData));
+        if (flowControl_)
+        {
+            ready_ = false;
+        }
+        ev.sendSync(kNormalPriority, kValue, std::move(t));
+    }
+
+    EventOutput ev;
+    const struct imagePreprocessParams params_;
+    bool flowControl_;
+    bool ready_{true};
+    uint32_t dropped_{0};
+
+    int roiX_{0};
+    int roiY_{0};
+    int roiW_{0};
+    int roiH_{0};
+    int channels_{3};
+
+    uint8_t *scratch_{nullptr};
+    uint16_t *xIdx_{nullptr};
+    uint16_t *xFrac_{nullptr};
+    int8_t lut_[3][256];
+};
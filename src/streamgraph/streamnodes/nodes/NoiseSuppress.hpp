@@ -0,0 +1,158 @@
+#pragma once
+
+#include "GenericNodes.hpp"
+#include "StreamNode.hpp"
+#include "arm_math_types.h"
+#include "cg_enums.h"
+
+#include "dsp/complex_math_functions.h"
+
+#include <array>
+#include <cstring>
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Noise suppression with a Wiener filter in the STFT domain.
+
+The node is a spectral gain between a STFT and an ISTFT node (see
+STFT.hpp): it has no framing, window, FFT or overlap add. Each run
+reads the packed spectrum of a frame (nbBins cf32 values with the DC
+and Nyquist components in the first one) and outputs the same spectrum
+with a gain per bin. The input and output can be the same buffer.
+
+For each bin:
+- the noise power is tracked by a minimum tracking of the smoothed power
+  (it follows the decreases and rises slowly with noiseRise per frame)
+- the gain is the Wiener gain computed from the a priori SNR estimated
+  with the decision directed method
+- the gain is limited to minGain to limit the musical noise
+
+The spectrum operations are done with CMSIS-DSP (Helium when
+available).
+
+*/
+template <int nbBins>
+class NoiseSuppressor
+{
+  public:
+    // DC to Nyquist
+    static constexpr int nbPowers = nbBins + 1;
+
+    NoiseSuppressor(float32_t minGain = 0.1f,
+                    float32_t noiseRise = 1.01f)
+        : minGain_(minGain), noiseRise_(noiseRise)
+    {
+        reset();
+        noise.fill(0.0f);
+        smoothedPower.fill(0.0f);
+        noiseInitialized = false;
+    }
+
+    // The noise estimate is kept
+    void reset()
+    {
+        prevGain.fill(1.0f);
+        prevSnrPost.fill(1.0f);
+    }
+
+    void process(const cf32 *in, cf32 *out)
+    {
+        const float32_t dc = in[0].real;
+        const float32_t nyquist = in[0].imag;
+
+        arm_cmplx_mag_squared_f32((const float32_t *)in, power.data(), nbBins);
+        power[0] = dc * dc;
+        power[nbBins] = nyquist * nyquist;
+
+        updateGains();
+
+        arm_cmplx_mult_real_f32((const float32_t *)in, gains.data(), (float32_t *)out, nbBins);
+        out[0].real = dc * gains[0];
+        out[0].imag = nyquist * gains[nbBins];
+    }
+
+  protected:
+    void updateGains()
+    {
+        constexpr float32_t powerSmoothing = 0.8f;
+        constexpr float32_t decisionDirected = 0.98f;
+        constexpr float32_t noiseFloor = 1e-12f;
+
+        if (!noiseInitialized)
+        {
+            memcpy(smoothedPower.data(), power.data(), nbPowers * sizeof(float32_t));
+            memcpy(noise.data(), power.data(), nbPowers * sizeof(float32_t));
+            noiseInitialized = true;
+        }
+
+        for (int k = 0; k < nbPowers; k++)
+        {
+            smoothedPower[k] = powerSmoothing * smoothedPower[k] + (1.0f - powerSmoothing) * power[k];
+            float32_t n = noise[k] * noiseRise_;
+            noise[k] = (smoothedPower[k] < n) ? smoothedPower[k] : n;
+
+            float32_t snrPost = power[k] / (noise[k] + noiseFloor);
+            float32_t snrInst = (snrPost > 1.0f) ? snrPost - 1.0f : 0.0f;
+            float32_t snrPrio = decisionDirected * prevGain[k] * prevGain[k] * prevSnrPost[k] + (1.0f - decisionDirected) * snrInst;
+            float32_t g = snrPrio / (1.0f + snrPrio);
+            if (g < minGain_)
+            {
+                g = minGain_;
+            }
+
+            gains[k] = g;
+            prevGain[k] = g;
+            prevSnrPost[k] = snrPost;
+        }
+    }
+
+    float32_t minGain_;
+    float32_t noiseRise_;
+    bool noiseInitialized;
+
+    std::array<float32_t, nbPowers> power;
+    std::array<float32_t, nbPowers> gains;
+    std::array<float32_t, nbPowers> smoothedPower;
+    std::array<float32_t, nbPowers> noise;
+    std::array<float32_t, nbPowers> prevGain;
+    std::array<float32_t, nbPowers> prevSnrPost;
+};
+
+template <typename IN, int inputSize,
+          typename OUT, int outputSize>
+class NoiseSuppress;
+
+template <int nbBins>
+class NoiseSuppress<cf32, nbBins, cf32, nbBins> : public GenericNode<cf32, nbBins, cf32, nbBins>, public ContextSwitch
+{
+  public:
+    NoiseSuppress(FIFOBase<cf32> &src, FIFOBase<cf32> &dst)
+        : GenericNode<cf32, nbBins, cf32, nbBins>(src, dst) {};
+
+    int pause() final override
+    {
+        return 0;
+    }
+
+    // The previous frames are not related to the new ones
+    int resume() final override
+    {
+        suppressor.reset();
+        return 0;
+    }
+
+    int run() final
+    {
+        cf32 *in = this->getReadBuffer();
+        cf32 *out = this->getWriteBuffer();
+
+        suppressor.process(in, out);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    NoiseSuppressor<nbBins> suppressor;
+};
@@ -6,6 +6,7 @@
 #include "EventQueue.hpp"
 #include "StreamNode.hpp"
 #include "GenericNodes.hpp"
+#include "EventDispatch.hpp"
 
 
 using namespace arm_cmsis_stream;
@@ -45,16 +46,10 @@ class NullSink: public GenericSink<OUT, outputSamples>
 
     void processEvent(int dstPort, Event &&evt) final override
     {
-        if (dstPort == 0)
-        {
-            if (evt.event_id == kValue)
-            {
-                if (evt.wellFormed<uint32_t>())
-                {
-                    evt.apply<uint32_t>(&NullSink::processValue, *this);
-                }
-            }
-        }
+        using Dispatch = EventDispatch<
+            EventHandler<0, kValue, uint32_t, &NullSink::processValue>>;
+
+        Dispatch::dispatch(*this, dstPort, std::move(evt));
     };
 
     void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
@@ -31,4 +31,72 @@ class RealToComplex<float, inputSamples, cf32, inputSamples> : public GenericNod
 
         return (CG_SUCCESS);
     };
-};
\ No newline at end of file
+};
+
+template <int inputSamples>
+class RealToComplex<q15_t, inputSamples, cq15, inputSamples> : public GenericNode<q15_t, inputSamples, cq15, inputSamples>
+{
+  public:
+    RealToComplex(FIFOBase<q15_t> &src, FIFOBase<cq15> &dst)
+        : GenericNode<q15_t, inputSamples, cq15, inputSamples>(src, dst) {};
+
+
+    int run() final
+    {
+        cq15 *o = this->getWriteBuffer();
+        q15_t *in = this->getReadBuffer();
+        for (int i = 0; i < inputSamples; i++)
+        {
+            o[i].real = in[i];
+            o[i].imag = 0;
+        }
+
+        return (CG_SUCCESS);
+    };
+};
+
+template <int inputSamples>
+class RealToComplex<q31_t, inputSamples, cq31, inputSamples> : public GenericNode<q31_t, inputSamples, cq31, inputSamples>
+{
+  public:
+    RealToComplex(FIFOBase<q31_t> &src, FIFOBase<cq31> &dst)
+        : GenericNode<q31_t, inputSamples, cq31, inputSamples>(src, dst) {};
+
+
+    int run() final
+    {
+        cq31 *o = this->getWriteBuffer();
+        q31_t *in = this->getReadBuffer();
+        for (int i = 0; i < inputSamples; i++)
+        {
+            o[i].real = in[i];
+            o[i].imag = 0;
+        }
+
+        return (CG_SUCCESS);
+    };
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template <int inputSamples>
+class RealToComplex<float16_t, inputSamples, cf16, inputSamples> : public GenericNode<float16_t, inputSamples, cf16, inputSamples>
+{
+  public:
+    RealToComplex(FIFOBase<float16_t> &src, FIFOBase<cf16> &dst)
+        : GenericNode<float16_t, inputSamples, cf16, inputSamples>(src, dst) {};
+
+
+    int run() final
+    {
+        cf16 *o = this->getWriteBuffer();
+        float16_t *in = this->getReadBuffer();
+        for (int i = 0; i < inputSamples; i++)
+        {
+            o[i].real = in[i];
+            o[i].imag = (float16_t)0.0f;
+        }
+
+        return (CG_SUCCESS);
+    };
+};
+#endif
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "GenericNodes.hpp"
+#include "StreamNode.hpp"
+#include "arm_math_types.h"
+#include "cg_enums.h"
+
+#include "dsp/basic_math_functions.h"
+
+#include <array>
+#include <cstring>
+#include <numeric>
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Polyphase filter of a L/M resampler.
+The specializations are generated with the graph by python/nodes/Resampler.py
+(coefs[p] are the taps of phase p in the order of the input samples and
+include the gain L).
+
+*/
+template <int L, int M>
+struct ResamplerFilter;
+
+#include "resampler_filters/resampler_filters.hpp"
+
+/*
+
+Rational resampler by L/M. The ratio is the one between the output and
+input sizes of the node (for instance 960 samples at 48 kHz to 320
+samples at 16 kHz is a 1/3 resampler).
+
+Only the output samples are computed: for each output sample, the
+polyphase branch of the sample is applied to the most recent input
+samples. There is no zero stuffing and no computation of samples that are
+then thrown away by the decimation. The dot product uses the Helium
+implementation of CMSIS-DSP when available.
+
+*/
+template <typename IN, int inputSize,
+          typename OUT, int outputSize>
+class Resampler;
+
+template <int inputSamples, int outputSamples>
+class Resampler<float, inputSamples, float, outputSamples> : public GenericNode<float, inputSamples, float, outputSamples>, public ContextSwitch
+{
+    static constexpr int G = std::gcd(inputSamples, outputSamples);
+    static constexpr int L = outputSamples / G;
+    static constexpr int M = inputSamples / G;
+    using Filter = ResamplerFilter<L, M>;
+    static constexpr int T = Filter::tapsPerPhase;
+
+  public:
+    Resampler(FIFOBase<float> &src, FIFOBase<float> &dst)
+        : GenericNode<float, inputSamples, float, outputSamples>(src, dst)
+    {
+        history.fill(0.0f);
+    };
+
+    int pause() final override
+    {
+        return 0;
+    }
+
+    // The previous samples are not related to the new ones
+    int resume() final override
+    {
+        history.fill(0.0f);
+        return 0;
+    }
+
+    int run() final
+    {
+        float *in = this->getReadBuffer();
+        float *out = this->getWriteBuffer();
+
+        // The T-1 last samples of the previous block followed by the new block
+        memcpy(history.data() + T - 1, in, inputSamples * sizeof(float));
+
+        // Output n uses the input samples ending at floor(n*M/L) and the
+        // phase (n*M) mod L
+        int base = 0;
+        int phase = 0;
+        for (int n = 0; n < outputSamples; n++)
+        {
+            arm_dot_prod_f32(history.data() + base, Filter::coefs[phase], T, &out[n]);
+            base += M / L;
+            phase += M % L;
+            if (phase >= L)
+            {
+                phase -= L;
+                base++;
+            }
+        }
+
+        memmove(history.data(), history.data() + inputSamples, (T - 1) * sizeof(float));
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    std::array<float, T - 1 + inputSamples> history;
+};
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#include "StreamArena.hpp"
+
+/*
+
+Link between two partitions of a graph running on different threads.
+
+When a graph is partitioned (see python/partition.py), each edge between
+two partitions is replaced by a SPSCSink in the producer partition and a
+SPSCSource in the consumer partition (SPSCSink.hpp and SPSCSource.hpp).
+Both nodes use the same channel: a single producer / single consumer
+ring buffer.
+
+The read and write indices are only written by one side so no lock is
+needed. The semaphores are only used to wait when the ring is full or
+empty. The capacity must be at least the sum of the block sizes of the
+producer and the consumer to avoid a deadlock (computed by the Python).
+
+*/
+
+#define SPSC_MAX_CHANNELS 8
+// Max wait for the other partition before reporting an error
+#define SPSC_WAIT_TIMEOUT_MS 1000
+
+class SPSCRing
+{
+  public:
+    SPSCRing(uint8_t *mem, size_t capacity) : mem_(mem), capacity_(capacity)
+    {
+        k_sem_init(&data_, 0, 1);
+        k_sem_init(&space_, 0, 1);
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    // Called by the producer only
+    bool write(const uint8_t *src, size_t n, k_timeout_t timeout)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        while (capacity_ - (head - tail_.load(std::memory_order_acquire)) < n)
+        {
+            if (k_sem_take(&space_, timeout) != 0)
+            {
+                return false;
+            }
+        }
+        copy_in(head % capacity_, src, n);
+        head_.store(head + n, std::memory_order_release);
+        k_sem_give(&data_);
+        return true;
+    }
+
+    // Called by the consumer only
+    bool read(uint8_t *dst, size_t n, k_timeout_t timeout)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        while (head_.load(std::memory_order_acquire) - tail < n)
+        {
+            if (k_sem_take(&data_, timeout) != 0)
+            {
+                return false;
+            }
+        }
+        copy_out(tail % capacity_, dst, n);
+        tail_.store(tail + n, std::memory_order_release);
+        k_sem_give(&space_);
+        return true;
+    }
+
+  protected:
+    void copy_in(size_t pos, const uint8_t *src, size_t n)
+    {
+        size_t first = (pos + n <= capacity_) ? n : capacity_ - pos;
+        memcpy(mem_ + pos, src, first);
+        memcpy(mem_, src + first, n - first);
+    }
+
+    void copy_out(size_t pos, uint8_t *dst, size_t n) const
+    {
+        size_t first = (pos + n <= capacity_) ? n : capacity_ - pos;
+        memcpy(dst, mem_ + pos, first);
+        memcpy(dst + first, mem_, n - first);
+    }
+
+    uint8_t *mem_;
+    const size_t capacity_;
+    // Total number of bytes written and read
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+    struct k_sem data_;
+    struct k_sem space_;
+};
+
+/*
+
+The channel is created by the first of the two nodes to be initialized.
+The partitions are initialized from one thread before being started.
+
+A channel is identified by the name of the partitioned graph and the
+channel number in this graph: the channel numbers are only unique in a
+graph. The name is a string literal from the generated code so it is
+not copied.
+
+*/
+struct SPSCChannel
+{
+    const char *graph;
+    int channel;
+    SPSCRing *ring;
+};
+
+inline SPSCChannel spsc_channels[SPSC_MAX_CHANNELS] = {};
+
+inline SPSCChannel *spsc_find_channel(const char *graph, int channel)
+{
+    for (int i = 0; i < SPSC_MAX_CHANNELS; i++)
+    {
+        SPSCChannel &c = spsc_channels[i];
+        if ((c.ring != nullptr) && (c.channel == channel) && (strcmp(c.graph, graph) == 0))
+        {
+            return &c;
+        }
+    }
+    return nullptr;
+}
+
+inline SPSCRing *spsc_channel(const char *graph, int channel, size_t capacity)
+{
+    SPSCChannel *c = spsc_find_channel(graph, channel);
+    if (c == nullptr)
+    {
+        // First free entry
+        for (int i = 0; (c == nullptr) && (i < SPSC_MAX_CHANNELS); i++)
+        {
+            if (spsc_channels[i].ring == nullptr)
+            {
+                c = &spsc_channels[i];
+            }
+        }
+        if (c == nullptr)
+        {
+            return nullptr;
+        }
+        void *mem = stream_arena_alloc(ArenaScope::current(), capacity, 16);
+        if (mem == nullptr)
+        {
+            mem = new (std::nothrow) uint8_t[capacity];
+        }
+        if (mem == nullptr)
+        {
+            return nullptr;
+        }
+        SPSCRing *ring = arena_new<SPSCRing>(static_cast<uint8_t *>(mem), capacity);
+        if (ring == nullptr)
+        {
+            return nullptr;
+        }
+        *c = {graph, channel, ring};
+    }
+    if (c->ring->capacity() != capacity)
+    {
+        return nullptr;
+    }
+    return c->ring;
+}
+
+// Called when a node using the channel is destroyed. The memory
+// is released with the arena of the graph.
+inline void spsc_channel_release(const char *graph, int channel)
+{
+    SPSCChannel *c = spsc_find_channel(graph, channel);
+    if (c != nullptr)
+    {
+        *c = {};
+    }
+}
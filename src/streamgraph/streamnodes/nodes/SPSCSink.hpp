@@ -0,0 +1,52 @@
+#pragma once
+
+#include "cg_enums.h"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+
+#include "SPSCFifo.hpp"
+
+using namespace arm_cmsis_stream;
+
+// Producer side of a link between two partitions (see SPSCFifo.hpp)
+template <typename IN, int inputSize>
+class SPSCSink : public GenericSink<IN, inputSize>
+{
+  public:
+    SPSCSink(FIFOBase<IN> &src, const char *graph, int channel, int capacity)
+        : GenericSink<IN, inputSize>(src), graph_(graph), channel_(channel)
+    {
+        ring_ = spsc_channel(graph, channel, capacity * sizeof(IN));
+    }
+
+    ~SPSCSink()
+    {
+        spsc_channel_release(graph_, channel_);
+    }
+
+    cg_status init() final override
+    {
+        if (ring_ == nullptr)
+        {
+            LOG_ERR("SPSC channel can't be created");
+            return CG_INIT_FAILURE;
+        }
+        return CG_SUCCESS;
+    }
+
+    int run() final
+    {
+        IN *a = this->getReadBuffer();
+        if (!ring_->write(reinterpret_cast<const uint8_t *>(a), inputSize * sizeof(IN),
+                          K_MSEC(SPSC_WAIT_TIMEOUT_MS)))
+        {
+            return CG_BUFFER_OVERFLOW;
+        }
+        return CG_SUCCESS;
+    }
+
+  protected:
+    const char *graph_;
+    int channel_;
+    SPSCRing *ring_;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "cg_enums.h"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+
+#include "SPSCFifo.hpp"
+
+using namespace arm_cmsis_stream;
+
+// Consumer side of a link between two partitions (see SPSCFifo.hpp)
+template <typename OUT, int outputSize>
+class SPSCSource : public GenericSource<OUT, outputSize>
+{
+  public:
+    SPSCSource(FIFOBase<OUT> &dst, const char *graph, int channel, int capacity)
+        : GenericSource<OUT, outputSize>(dst), graph_(graph), channel_(channel)
+    {
+        ring_ = spsc_channel(graph, channel, capacity * sizeof(OUT));
+    }
+
+    ~SPSCSource()
+    {
+        spsc_channel_release(graph_, channel_);
+    }
+
+    cg_status init() final override
+    {
+        if (ring_ == nullptr)
+        {
+            LOG_ERR("SPSC channel can't be created");
+            return CG_INIT_FAILURE;
+        }
+        return CG_SUCCESS;
+    }
+
+    int run() final
+    {
+        OUT *b = this->getWriteBuffer();
+        if (!ring_->read(reinterpret_cast<uint8_t *>(b), outputSize * sizeof(OUT),
+                         K_MSEC(SPSC_WAIT_TIMEOUT_MS)))
+        {
+            return CG_BUFFER_UNDERFLOW;
+        }
+        return CG_SUCCESS;
+    }
+
+  protected:
+    const char *graph_;
+    int channel_;
+    SPSCRing *ring_;
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "GenericNodes.hpp"
+#include "StreamNode.hpp"
+#include "arm_math_types.h"
+#include "cg_enums.h"
+
+#include "dsp/basic_math_functions.h"
+#include "dsp/transform_functions.h"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Windows of the STFT and ISTFT nodes (periodic windows).
+SqrtHann is used for analysis and synthesis with 50% overlap.
+Hann and Hamming are better with 75% overlap.
+
+*/
+enum class STFTWindow
+{
+    Hann,
+    SqrtHann,
+    Hamming
+};
+
+static inline float32_t stftWindowCoef(STFTWindow window, int i, int windowLength)
+{
+    const float32_t x = 2.0f * PI * i / windowLength;
+    switch (window)
+    {
+    case STFTWindow::SqrtHann:
+        return sinf(0.5f * x);
+    case STFTWindow::Hamming:
+        return 0.54f - 0.46f * cosf(x);
+    case STFTWindow::Hann:
+    default:
+        return 0.5f * (1.0f - cosf(x));
+    }
+}
+
+/*
+
+Short time Fourier transform.
+
+Each run reads hop new samples and outputs the spectrum of the last
+windowLength samples (windowLength <= fftSize, the frame is zero
+padded).
+
+The output is the packed spectrum of arm_rfft_fast_f32: fftSize/2 cf32
+values where the bin 0 contains the DC (real) and the Nyquist (imag)
+components. Spectral processing nodes can work in place on the FIFO
+between a STFT and an ISTFT with the same parameters.
+
+The FFT is computed directly in the output FIFO. The twiddle tables are
+the constant tables of CMSIS-DSP shared by all the instances.
+
+*/
+template <typename IN, int inputSize,
+          typename OUT, int outputSize>
+class STFT;
+
+template <int hop, int nbBins>
+class STFT<float32_t, hop, cf32, nbBins> : public GenericNode<float32_t, hop, cf32, nbBins>, public ContextSwitch
+{
+  public:
+    static constexpr int fftSize = 2 * nbBins;
+    static_assert((fftSize >= 32) && (fftSize <= 4096) && ((fftSize & (fftSize - 1)) == 0),
+                  "Unsupported FFT size");
+
+    STFT(FIFOBase<float32_t> &src, FIFOBase<cf32> &dst, int windowLength, STFTWindow window)
+        : GenericNode<float32_t, hop, cf32, nbBins>(src, dst), windowLength_(windowLength)
+    {
+        arm_rfft_fast_init_f32(&rfft, fftSize);
+        for (int i = 0; i < fftSize; i++)
+        {
+            window_[i] = (i < windowLength) ? stftWindowCoef(window, i, windowLength) : 0.0f;
+        }
+        history.fill(0.0f);
+    };
+
+    cg_status init() final override
+    {
+        if ((windowLength_ < hop) || (windowLength_ > fftSize))
+        {
+            return (CG_INIT_FAILURE);
+        }
+        return (CG_SUCCESS);
+    }
+
+    int pause() final override
+    {
+        return 0;
+    }
+
+    // The previous samples are not related to the new ones
+    int resume() final override
+    {
+        history.fill(0.0f);
+        return 0;
+    }
+
+    int run() final
+    {
+        float32_t *in = this->getReadBuffer();
+        cf32 *out = this->getWriteBuffer();
+
+        // The last windowLength samples
+        memmove(history.data(), history.data() + hop, (windowLength_ - hop) * sizeof(float32_t));
+        memcpy(history.data() + windowLength_ - hop, in, hop * sizeof(float32_t));
+
+        // The zero padding is done by the window
+        arm_mult_f32(history.data(), window_.data(), frame.data(), fftSize);
+        arm_rfft_fast_f32(&rfft, frame.data(), (float32_t *)out, 0);
+
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    arm_rfft_fast_instance_f32 rfft;
+    int windowLength_;
+    std::array<float32_t, fftSize> window_;
+    std::array<float32_t, fftSize> history;
+    std::array<float32_t, fftSize> frame;
+};
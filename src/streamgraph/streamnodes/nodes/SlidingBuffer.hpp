@@ -26,18 +26,20 @@
 
 #pragma once
 
+#include <array>
+
 #include "GenericNodes.hpp"
 
 using namespace arm_cmsis_stream;
 
 template<typename IN,int windowSize, int overlap>
-class SlidingBuffer: public GenericNode<IN,windowSize-overlap,IN,windowSize>, public ContextSwitch
+class SlidingBuffer: public GenericNode<IN,windowSize-overlap,IN,windowSize>, public WarmContextSwitch
 {
 public:
     SlidingBuffer(FIFOBase<IN> &src,FIFOBase<IN> &dst):GenericNode<IN,windowSize-overlap,IN,windowSize>(src,dst)
     {
         static_assert((windowSize-overlap)>0, "Overlap is too big");
-        memory.resize(overlap);
+        memset(memory.data(),0,overlap*sizeof(IN));
     };
 
     int pause()
@@ -51,6 +53,32 @@ public:
         return(0);
     }
 
+    // The overlap is the state of the node
+    size_t stateSize() const final
+    {
+        return(overlap*sizeof(IN));
+    }
+
+    int saveState(void *blob, size_t size) const final
+    {
+        if (size != stateSize())
+        {
+            return(-1);
+        }
+        memcpy(blob,(const void*)memory.data(),size);
+        return(0);
+    }
+
+    int restoreState(const void *blob, size_t size) final
+    {
+        if (size != stateSize())
+        {
+            return(-1);
+        }
+        memcpy((void*)memory.data(),blob,size);
+        return(0);
+    }
+
 
 
     int run() final
@@ -63,7 +91,8 @@ public:
         return(CG_SUCCESS);
     };
 protected:
-    std::vector<IN> memory;
+    // Part of the node object: allocated with the node
+    std::array<IN,overlap> memory;
 
 };
 
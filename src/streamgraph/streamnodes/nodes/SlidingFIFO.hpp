@@ -0,0 +1,185 @@
+#pragma once
+
+#include <zephyr/sys/__assert.h>
+
+#include "GenericNodes.hpp"
+
+#include <cstring>
+
+using namespace arm_cmsis_stream;
+
+/*
+
+FIFO of overlapping windows used between a SlidingWindow node and its
+consumer (see SlidingWindow.hpp).
+
+The FIFO stores the stream of samples in a linear buffer. A window is a
+pointer into this buffer: the first overlap samples of a new window are
+the last samples of the previous one and are not copied. The producer
+only writes the hop new samples at the end of the window.
+
+When the end of the buffer is reached, the overlap is copied once at the
+beginning (mirrored tail) and the next windows are written from there.
+The buffer is big enough for the copy to cost less than hop samples per
+window on average.
+
+The buffer keeps the overlap between two windows so it cannot be shared
+with the other FIFOs like the buffers allocated by the scheduler. It is
+a static buffer of sliding_fifo_size() samples emitted in the scheduler
+by the generator (sliding_fifo_buffers in python/postprocess.py). The
+scheduler buffer of this FIFO is removed when no other FIFO uses it.
+
+*/
+
+// Number of samples of the buffer of a SlidingFIFO of length samples
+// (as computed by the scheduler)
+constexpr int sliding_fifo_size(int length, int windowSize, int overlap)
+{
+    const int hop = windowSize - overlap;
+    const int maxWindows = (length / windowSize > 0) ? length / windowSize : 1;
+    // The amortized copy of the overlap is at most hop samples per window
+    const int nbHops = (overlap + hop - 1) / hop + maxWindows + 1;
+    return overlap + nbHops * hop;
+}
+
+template <typename T>
+class SlidingFIFOBase : public FIFOBase<T>
+{
+  public:
+    // Length of the FIFO in samples as computed by the scheduler and
+    // buffer of capacity samples
+    SlidingFIFOBase(int length, T *buffer, int capacity)
+        : ring_(buffer), length_(length), capacity_(capacity)
+    {
+    }
+
+    // Called by the SlidingWindow node when it is created
+    bool configure(int windowSize, int overlap)
+    {
+        if (sliding_fifo_size(length_, windowSize, overlap) > capacity_)
+        {
+            return false;
+        }
+        window_ = windowSize;
+        overlap_ = overlap;
+        hop_ = windowSize - overlap;
+        maxWindows_ = (length_ / windowSize > 0) ? length_ / windowSize : 1;
+        size_ = sliding_fifo_size(length_, windowSize, overlap);
+        reset();
+        return true;
+    }
+
+    bool configured() const
+    {
+        return (size_ > 0);
+    }
+
+    void reset()
+    {
+        if (size_ > 0)
+        {
+            memset(ring_, 0, size_ * sizeof(T));
+        }
+        // The first window starts with an overlap of zeros
+        write_ = overlap_;
+        read_ = 0;
+        wrapFrom_ = -1;
+        nbWindows_ = 0;
+    }
+
+    // Last overlap samples written: they start the next window. They
+    // are the state of the SlidingWindow node.
+    T *overlapData()
+    {
+        return ring_ + write_ - overlap_;
+    }
+
+    // Return the start of the window. Only the last hop samples must
+    // be written.
+    T *getWriteBuffer(int nb) final override
+    {
+        // The producer writes one window at a time
+        __ASSERT(nb == window_, "SlidingFIFO written with %d samples instead of a window", nb);
+        (void)nb;
+        if (write_ + hop_ > size_)
+        {
+            // Mirrored tail: the overlap of the next window is moved to
+            // the beginning of the buffer
+            memcpy(ring_, ring_ + write_ - overlap_, overlap_ * sizeof(T));
+            wrapFrom_ = write_ - overlap_;
+            write_ = overlap_;
+        }
+        T *window = ring_ + write_ - overlap_;
+        write_ += hop_;
+        nbWindows_++;
+        return window;
+    }
+
+    T *getReadBuffer(int nb) final override
+    {
+        // The consumer reads one window at a time
+        __ASSERT(nb == window_, "SlidingFIFO read with %d samples instead of a window", nb);
+        (void)nb;
+        if (read_ == wrapFrom_)
+        {
+            read_ = 0;
+            wrapFrom_ = -1;
+        }
+        T *window = ring_ + read_;
+        read_ += hop_;
+        nbWindows_--;
+        return window;
+    }
+
+    bool willUnderflowWith(int nb) const final override
+    {
+        return (nbWindows_ * window_ < nb);
+    }
+
+    // The buffer is big enough for the windows allowed by the length of
+    // the FIFO to never overwrite a window not yet read
+    bool willOverflowWith(int nb) const final override
+    {
+        return (nbWindows_ * window_ + nb > maxWindows_ * window_);
+    }
+
+    int nbSamplesInFIFO() const final override
+    {
+        return nbWindows_ * window_;
+    }
+
+  protected:
+    T *ring_;
+    int length_;
+    int capacity_;
+    int maxWindows_{1};
+    int window_{0};
+    int overlap_{0};
+    int hop_{1};
+    int size_{0};
+    int write_{0};
+    int read_{0};
+    int wrapFrom_{-1};
+    int nbWindows_{0};
+};
+
+/*
+
+Class used by the generated scheduler (fifoClass="SlidingFIFO" in Python).
+The template arguments are the ones of the CMSIS-Stream FIFO.
+The buffer is the one emitted by sliding_fifo_buffers (the constructor
+of the CMSIS-Stream FIFO with the scheduler buffer is not provided).
+
+*/
+template <typename T, int length, int isArray = 0, int isAsync = 0>
+class SlidingFIFO : public SlidingFIFOBase<T>
+{
+  public:
+    static constexpr int fifoLength = length;
+
+    template <int capacity>
+    explicit SlidingFIFO(T (&buffer)[capacity])
+        : SlidingFIFOBase<T>(length, buffer, capacity)
+    {
+    }
+};
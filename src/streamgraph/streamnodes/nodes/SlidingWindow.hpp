@@ -0,0 +1,99 @@
+#pragma once
+
+#include "GenericNodes.hpp"
+#include "SlidingFIFO.hpp"
+#include "cg_enums.h"
+
+#include <cstring>
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Same behavior as SlidingBuffer but the output FIFO must be a SlidingFIFO
+(use connect_sliding_window in python/nodes/SlidingWindow.py).
+
+The windows are overlapping views of the SlidingFIFO: the overlap is
+already in place and run() only copies the hop new samples. With
+windowSize=490 and overlap=480, a run copies 10 samples instead of
+about 1000 for SlidingBuffer.
+
+The overlap is in the FIFO. The node has no buffer.
+
+*/
+template <typename IN, int hop,
+          typename OUT, int windowSize>
+class SlidingWindow;
+
+template <typename IN, int hop, int windowSize>
+class SlidingWindow<IN, hop, IN, windowSize> : public GenericNode<IN, hop, IN, windowSize>, public WarmContextSwitch
+{
+    static constexpr int overlap = windowSize - hop;
+
+  public:
+    SlidingWindow(FIFOBase<IN> &src, FIFOBase<IN> &dst)
+        : GenericNode<IN, hop, IN, windowSize>(src, dst),
+          windows(static_cast<SlidingFIFOBase<IN> &>(dst))
+    {
+        static_assert(overlap >= 0, "Hop is bigger than the window");
+        windows.configure(windowSize, overlap);
+    };
+
+    // The FIFO buffer must be big enough for the windows
+    cg_status init() final override
+    {
+        if (!windows.configured())
+        {
+            return (CG_INIT_FAILURE);
+        }
+        return (CG_SUCCESS);
+    }
+
+    int pause() final override
+    {
+        memset(windows.overlapData(), 0, overlap * sizeof(IN));
+        return (0);
+    }
+
+    int resume() final override
+    {
+        return (0);
+    }
+
+    // The overlap is the state of the node
+    size_t stateSize() const final
+    {
+        return (overlap * sizeof(IN));
+    }
+
+    int saveState(void *blob, size_t size) const final
+    {
+        if (size != stateSize())
+        {
+            return (-1);
+        }
+        memcpy(blob, (const void *)windows.overlapData(), size);
+        return (0);
+    }
+
+    int restoreState(const void *blob, size_t size) final
+    {
+        if (size != stateSize())
+        {
+            return (-1);
+        }
+        memcpy((void *)windows.overlapData(), blob, size);
+        return (0);
+    }
+
+    int run() final
+    {
+        IN *a = this->getReadBuffer();
+        IN *b = this->getWriteBuffer();
+        memcpy((void *)(b + overlap), (void *)a, hop * sizeof(IN));
+        return (CG_SUCCESS);
+    };
+
+  protected:
+    SlidingFIFOBase<IN> &windows;
+};
@@ -5,6 +5,8 @@
 #include "StreamNode.hpp"
 #include "arm_math_types.h"
 #include "cg_enums.h"
+#include "EventDispatch.hpp"
+#include "stream_runner.hpp"
 
 
 #include "tensorflow/lite/c/common.h"
@@ -265,7 +267,10 @@ class TFLite : public StreamNode
         if ((int)inputReceived == ((1 << nb) - 1))
         {
             inputReceived = 0;
+            // The NPU may be shared with other graphs running concurrently
+            stream_resource_lock(STREAM_RESOURCE_NPU);
             TfLiteStatus invoke_status = this->m_pInterpreter->Invoke();
+            stream_resource_unlock(STREAM_RESOURCE_NPU);
             if (invoke_status != kTfLiteOk)
             {
                 LOG_ERR("TFLite: Invoke failed on model\n");
@@ -391,28 +396,16 @@ class TFLite : public StreamNode
 
     void processEvent(int dstPort, Event &&evt) final override
     {
-
-        if (evt.event_id == kValue)
-        {
-            if (evt.wellFormed<TensorPtr<float>>())
-            {
-                    convertReceivedF32Tensor(dstPort, std::move(evt.get<TensorPtr<float>>()));
-            }
-            if (evt.wellFormed<TensorPtr<const float>>())
-            {
-                    convertReceivedF32Tensor(dstPort, std::move(evt.get<TensorPtr<const float>>()));
-            }
-            if (evt.wellFormed<TensorPtr<float>>())
-            {
-                    convertReceivedInt8Tensor(dstPort, std::move(evt.get<TensorPtr<float>>()));
-            }
-            if (evt.wellFormed<TensorPtr<const float>>())
-            {
-                    convertReceivedInt8Tensor(dstPort, std::move(evt.get<TensorPtr<const float>>()));
-            }
-            
-           
-        }
+        // Float tensors are converted to the input type of the model.
+        // Int8 tensors are already quantized (like from the ImagePreprocess node)
+        // Each tensor is converted once and gives one inference attempt.
+        using Dispatch = EventDispatch<
+            EventHandler<kAnyPort, kValue, TensorPtr<float>, &TFLite::convertReceivedF32Tensor<float>>,
+            EventHandler<kAnyPort, kValue, TensorPtr<const float>, &TFLite::convertReceivedF32Tensor<const float>>,
+            EventHandler<kAnyPort, kValue, TensorPtr<int8_t>, &TFLite::convertReceivedInt8Tensor<int8_t>>,
+            EventHandler<kAnyPort, kValue, TensorPtr<const int8_t>, &TFLite::convertReceivedInt8Tensor<const int8_t>>>;
+
+        Dispatch::dispatch(*this, dstPort, std::move(evt));
     }
 
     void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
@@ -0,0 +1,169 @@
+#pragma once
+
+/*
+
+Audio playback on the I2S TX device (CONFIG_AUDIO_SINK).
+
+The samples of the input FIFO are copied to a block of the TX memory
+slab and the block is queued to the driver, which frees it after the
+transfer. Before the stream is started, AUDIO_SINK_PRIMING_BLOCKS blocks
+of silence are queued so that the DMA always has the next block while
+the graph is producing the current one (double buffering). This is
+also the output latency added by the sink.
+
+An underrun (the driver ran out of blocks, no TX block was freed in
+time or the stream could not be primed) drops the current block: the
+stream is primed and started again by the next run and the graph keeps
+running. The underruns are counted in the timing statistics.
+
+The TX stream is stopped when the graph is paused and started again by
+the first run after the graph is resumed.
+
+*/
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2s.h>
+
+#include "cg_enums.h"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+#include "arm_math_types.h"
+extern "C" {
+#include "node_settings_datatype.h"
+}
+
+#include "AudioSinkTiming.hpp"
+
+#include <cstring>
+
+using namespace arm_cmsis_stream;
+
+#define AUDIO_SINK_PRIMING_BLOCKS 2
+
+// Max wait for a free TX block (10 blocks)
+#define AUDIO_SINK_TIMEOUT_MS (10 * 1000 * CONFIG_I2S_SAMPLES / CONFIG_SAMPLE_RATE)
+
+template <typename IN, int inputSize> class ZephyrAudioSink;
+
+template <int inputSamples>
+class ZephyrAudioSink<sq15, inputSamples> : public GenericSink<sq15, inputSamples>, public ContextSwitch
+{
+	static_assert(CONFIG_I2S_SAMPLES == inputSamples,
+		      "The audio sink input size must match CONFIG_I2S_SAMPLES");
+	static_assert(CONFIG_AUDIO_SINK_NUM_BUFFERS > AUDIO_SINK_PRIMING_BLOCKS,
+		      "CONFIG_AUDIO_SINK_NUM_BUFFERS is too small");
+
+	static constexpr size_t blockSize = inputSamples * sizeof(sq15);
+
+      public:
+	ZephyrAudioSink(FIFOBase<sq15> &src, const struct hardwareParams &settings)
+		: GenericSink<sq15, inputSamples>(src), settings_(settings), timing_(inputSamples)
+	{
+	};
+
+	cg_status init() final override
+	{
+		if ((settings_.i2s_spk == nullptr) || (settings_.spk_slab == nullptr)) {
+			LOG_ERR("No I2S device for the audio sink");
+			return (CG_INIT_FAILURE);
+		}
+		return (CG_SUCCESS);
+	}
+
+	int pause() final
+	{
+		if (started_) {
+			int rc = i2s_trigger(settings_.i2s_spk, I2S_DIR_TX, I2S_TRIGGER_DROP);
+			if (rc < 0) {
+				LOG_ERR("I2S TX drop failed: %i", rc);
+			}
+			started_ = false;
+		}
+		timing_.report("Audio sink");
+		timing_.reset();
+		return 0;
+	}
+
+	int resume() final
+	{
+		return 0;
+	}
+
+	int run() final
+	{
+		// The block is consumed even when it is dropped
+		sq15 *in = this->getReadBuffer();
+
+		if (!started_) {
+			if (start_stream() != 0) {
+				// The priming blocks already queued are dropped
+				return underrun(I2S_TRIGGER_DROP);
+			}
+		}
+
+		void *block = nullptr;
+		int err = k_mem_slab_alloc(settings_.spk_slab, &block, K_MSEC(AUDIO_SINK_TIMEOUT_MS));
+		if (err != 0) {
+			LOG_WRN("No free audio sink block: %d", err);
+			return underrun(I2S_TRIGGER_DROP);
+		}
+
+		memcpy(block, in, blockSize);
+		err = i2s_write(settings_.i2s_spk, block, blockSize);
+		if (err != 0) {
+			// The driver is in the error state after an underrun
+			LOG_WRN("i2s_write failed: %d", err);
+			k_mem_slab_free(settings_.spk_slab, block);
+			return underrun(I2S_TRIGGER_PREPARE);
+		}
+
+		timing_.block(settings_, AUDIO_SINK_PRIMING_BLOCKS * 1000000U * inputSamples / CONFIG_SAMPLE_RATE);
+
+		return (CG_SUCCESS);
+	};
+
+      protected:
+	// The stream is reset with cmd and started again by the next run
+	int underrun(enum i2s_trigger_cmd cmd)
+	{
+		int rc = i2s_trigger(settings_.i2s_spk, I2S_DIR_TX, cmd);
+		if (rc < 0) {
+			LOG_ERR("I2S TX reset failed: %i", rc);
+		}
+		timing_.underrun();
+		started_ = false;
+		return (CG_SUCCESS);
+	}
+
+	int start_stream()
+	{
+		for (int i = 0; i < AUDIO_SINK_PRIMING_BLOCKS; i++) {
+			void *block = nullptr;
+			int err = k_mem_slab_alloc(settings_.spk_slab, &block, K_NO_WAIT);
+			if (err != 0) {
+				LOG_WRN("No free audio sink block for priming: %d", err);
+				return err;
+			}
+			memset(block, 0, blockSize);
+			err = i2s_write(settings_.i2s_spk, block, blockSize);
+			if (err != 0) {
+				LOG_ERR("i2s_write failed: %d", err);
+				k_mem_slab_free(settings_.spk_slab, block);
+				return err;
+			}
+		}
+
+		int rc = i2s_trigger(settings_.i2s_spk, I2S_DIR_TX, I2S_TRIGGER_START);
+		if (rc < 0) {
+			LOG_ERR("I2S TX start failed: %i", rc);
+			return rc;
+		}
+		started_ = true;
+		return 0;
+	}
+
+	bool started_ = false;
+	const struct hardwareParams &settings_;
+	AudioSinkTiming timing_;
+};
@@ -27,14 +27,23 @@ extern "C" {
 #include "node_settings_datatype.h"
 }
 
-#include "init_drv_src.hpp"
-
-#include <atomic>
+#include "audio_broker.hpp"
 
 using namespace arm_cmsis_stream;
 
+// Max wait for an audio block before reporting an underflow (10 blocks)
+#define AUDIO_SOURCE_TIMEOUT_MS (10 * 1000 * CONFIG_I2S_SAMPLES / CONFIG_SAMPLE_RATE)
+
 template <typename OUT, int outputSize> class ZephyrAudioSource;
 
+/*
+
+pause() is called from another thread than run(). Both are serialized
+by lock_: a pause waits for the end of the block being read (at most
+one audio period when the microphones are running) and the consumer
+is never unsubscribed while run() is reading from it.
+
+*/
 template <int outputSamples>
 class ZephyrAudioSource<sq15, outputSamples> : public GenericSource<sq15, outputSamples>, public ContextSwitch
 {
@@ -42,24 +51,19 @@ class ZephyrAudioSource<sq15, outputSamples> : public GenericSource<sq15, output
 		      "The audio source output size must match CONFIG_I2S_SAMPLES");
 
       public:
-	ZephyrAudioSource(FIFOBase<sq15> &dst, const struct hardwareParams &settings)
+	ZephyrAudioSource(FIFOBase<sq15> &dst, struct hardwareParams &settings)
 		: GenericSource<sq15, outputSamples>(dst), settings_(settings)
 	{
-		
+		k_mutex_init(&lock_);
 	};
 
 	int pause() final
 	{
-		// Implementation of pause
-		if (started_.load() == false) {
-			// If it was never started, nothing to do
-			return 0;
-		}
-		int rc = i2s_trigger(settings_.i2s_mic, I2S_DIR_RX, I2S_TRIGGER_STOP);
-		if (rc < 0) {
-			LOG_ERR("I2S_TRIGGER_STOP failed: %i", rc);
-		}
-		started_.store(false);
+		k_mutex_lock(&lock_, K_FOREVER);
+		// The stream is stopped by the broker when
+		// no other graph is using it.
+		stop_audio();
+		k_mutex_unlock(&lock_);
 		return 0;
 	}
 
@@ -69,51 +73,68 @@ class ZephyrAudioSource<sq15, outputSamples> : public GenericSource<sq15, output
 		return 0;
 	}
 
-	
 	int run() final
 	{
-		size_t size;
-		if (!started_.load()) {
-			LOG_DBG("Starting RX");
-			
-			int rc = i2s_trigger(settings_.i2s_mic, I2S_DIR_RX, I2S_TRIGGER_START);
-
-			if (rc < 0) {
-				LOG_ERR("i2s_trigger start failed: %i", rc);
+		k_mutex_lock(&lock_, K_FOREVER);
+		int status = read_block();
+		k_mutex_unlock(&lock_);
+		return status;
+	};
+
+      protected:
+	// Called with lock_ held
+	int read_block()
+	{
+		if (consumer_ == nullptr) {
+			consumer_ = audio_broker_subscribe(settings_.i2s_mic, settings_.mem_slab);
+
+			if (consumer_ == nullptr) {
 				return (CG_INIT_FAILURE);
 			}
-			started_.store(true);
 		}
 
+		struct audio_broker_consumer *consumer = consumer_;
 		sq15 *out = this->getWriteBuffer();
-		memset(out, 0, outputSamples * sizeof(sq15));
-		int err=0;
-		void *buffer = NULL;
-		//err = i2s_buf_read(i2s_mic, out, &size);
-		err = i2s_read(settings_.i2s_mic, &buffer, &size);
-		
+		struct audio_broker_block *block = nullptr;
+		int err;
+
+		// -EAGAIN: count of the semaphore left by a previous subscription
+		// of the slot. The consumer is still subscribed since pause()
+		// cannot run during the read.
+		do {
+			err = audio_broker_read(consumer, &block, K_MSEC(AUDIO_SOURCE_TIMEOUT_MS));
+		} while (err == -EAGAIN);
 
 		if (err != 0) {
-			LOG_ERR("i2s_buf_read failed: %d", err);
-			k_mem_slab_free(settings_.mem_slab, buffer);
-            stop_audio();
+			LOG_ERR("audio_broker_read failed: %d", err);
+			stop_audio();
 			return (CG_BUFFER_UNDERFLOW);
 		}
 
-		memcpy(out, buffer, size);
-		k_mem_slab_free(settings_.mem_slab, buffer);
+		// The block is shared with the other graphs reading the microphones
+		memcpy(out, block->data, block->size);
+		// Read by the audio sinks of this graph for the latency
+		__atomic_store_n(&settings_.capture_timestamp, block->timestamp, __ATOMIC_RELAXED);
+		audio_broker_release(block);
 		return (CG_SUCCESS);
-	};
+	}
 
-      protected:
+	// Called with lock_ held
 	void stop_audio()
 	{
-		int rc = i2s_trigger(settings_.i2s_mic, I2S_DIR_RX, I2S_TRIGGER_DROP);
-		if (rc < 0) {
-			LOG_ERR("I2S_TRIGGER_DROP failed: %i", rc);
+		if (consumer_ == nullptr) {
+			// Never started or already stopped
+			return;
 		}
-		started_.store(false);
+		uint32_t overruns = audio_broker_overruns(consumer_);
+		if (overruns > 0) {
+			LOG_WRN("Audio source: %u blocks dropped", overruns);
+		}
+		audio_broker_unsubscribe(consumer_);
+		consumer_ = nullptr;
 	}
-	std::atomic<bool> started_ = false;
-	const struct hardwareParams &settings_;
-};
\ No newline at end of file
+
+	struct k_mutex lock_;
+	struct audio_broker_consumer *consumer_ = nullptr;
+	struct hardwareParams &settings_;
+};
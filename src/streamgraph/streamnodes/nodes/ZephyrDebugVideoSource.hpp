@@ -18,7 +18,11 @@ using namespace arm_cmsis_stream;
 #define DBG_VIDEO_HEIGHT     50
 #define DBG_VIDEO_FRAME_SIZE (DBG_VIDEO_WIDTH * DBG_VIDEO_HEIGHT * 2) // RGB565
 
-K_MEM_SLAB_DEFINE_STATIC(video_slab, DBG_VIDEO_FRAME_SIZE, 2, 4);
+// One frame being rendered, one frame waiting in a mailbox
+// and one frame being generated
+#define DBG_VIDEO_NB_FRAMES  3
+
+K_MEM_SLAB_DEFINE_STATIC(video_slab, DBG_VIDEO_FRAME_SIZE, DBG_VIDEO_NB_FRAMES, 4);
 
 struct DebugVideoCtx {
   struct k_work_delayable dwork;
@@ -81,7 +85,10 @@ class ZephyrDebugVideoSource: public StreamNode, public ContextSwitch
 		if ((evt.event_id == kDo) && (must_refresh_.load())) {
 			uint16_t *frameBuffer_ = nullptr;
 			k_mem_slab_alloc(&video_slab, (void **)&frameBuffer_, K_NO_WAIT);
-			if (frameBuffer_ != nullptr) {
+			if (frameBuffer_ == nullptr) {
+				// All frames are still used by the graph
+				dropped_++;
+			} else {
 				val += dt;
 				if (val >= 1.0f) {
 					val -= 1.0f;
@@ -116,6 +123,11 @@ class ZephyrDebugVideoSource: public StreamNode, public ContextSwitch
 		}
 	};
 
+	uint32_t droppedFrames() const
+	{
+		return dropped_;
+	}
+
 	void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
 	{
 		if (outputPort == 0) {
@@ -130,4 +142,5 @@ class ZephyrDebugVideoSource: public StreamNode, public ContextSwitch
 	float dt;
 	float val;
 	std::atomic<bool> must_refresh_{false};
+	uint32_t dropped_{0};
 };
@@ -0,0 +1,189 @@
+#pragma once
+
+/*
+
+File backed video source.
+
+Used for host testing (native_sim) when there is no camera.
+The file is a raw sequence of RGB565 frames of width x height
+pixels. When the end of the file is reached, the node loops back
+to the first frame.
+
+Frames are read into buffers from a memory slab and are sent to the
+graph without copies, like for ZephyrVideoSource. The slab buffer is
+released when the last consumer of the frame drops it.
+
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/logging/log.h>
+
+#include <new>
+
+#include "cg_enums.h"
+#include "EventQueue.hpp"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+#include "arm_math_types.h"
+#include "init_drv_src.hpp"
+
+#if !defined(CONFIG_FILE_VIDEO_SOURCE)
+#error "ZephyrFileVideoSource needs CONFIG_FILE_VIDEO_SOURCE"
+#endif
+
+#include <atomic>
+
+using namespace arm_cmsis_stream;
+
+// Period between two frames read from the file (10 fps)
+#define FILE_VIDEO_PERIOD_MS 100
+
+struct FileVideoCtx {
+  struct k_work_delayable dwork;
+  void *owner;
+};
+
+// RGB565
+class ZephyrFileVideoSource : public StreamNode, public ContextSwitch
+{
+      public:
+	ZephyrFileVideoSource(EventQueue *queue, const char *path, int width, int height)
+	    : StreamNode(), queue_(queue), ev(queue), path_(path), width_(width),
+	      height_(height)
+	{
+		ctx_.owner = this;
+		k_work_init_delayable(&ctx_.dwork, &ZephyrFileVideoSource::refresh);
+		fs_file_t_init(&file_);
+	}
+
+	// The work item must not run once the node has been freed
+	~ZephyrFileVideoSource()
+	{
+		struct k_work_sync sync;
+
+		must_refresh_.store(false);
+		k_work_cancel_delayable_sync(&ctx_.dwork, &sync);
+		if (opened_) {
+			fs_close(&file_);
+		}
+	}
+
+	cg_status init() final override
+	{
+		if ((width_ <= 0) || (height_ <= 0) ||
+		    (width_ * height_ * 2 > FILE_VIDEO_FRAME_SIZE)) {
+			LOG_ERR("Unsupported frame size %dx%d", width_, height_);
+			return (CG_INIT_FAILURE);
+		}
+
+		int ret = fs_open(&file_, path_, FS_O_READ);
+		if (ret < 0) {
+			LOG_ERR("Unable to open video file %s (%d)", path_, ret);
+			return (CG_INIT_FAILURE);
+		}
+		opened_ = true;
+
+		return (CG_SUCCESS);
+	}
+
+	static void release_video_frame(void *frame)
+	{
+		k_mem_slab_free(&file_video_slab, frame);
+	}
+
+	static void refresh(struct k_work *work)
+	{
+		struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+		FileVideoCtx *ctx = CONTAINER_OF(dwork, FileVideoCtx, dwork);
+		ZephyrFileVideoSource *self = static_cast<ZephyrFileVideoSource *>(ctx->owner);
+
+		if (self->must_refresh_.load()) {
+			self->queue_->push(LocalDestination{self, 0}, Event(kDo, kNormalPriority));
+
+			k_work_schedule(dwork, K_MSEC(FILE_VIDEO_PERIOD_MS));
+		}
+	}
+
+	int pause() final
+	{
+		must_refresh_.store(false);
+		k_work_cancel_delayable(&ctx_.dwork);
+		return 0;
+	}
+
+	int resume() final
+	{
+		must_refresh_.store(true);
+		k_work_schedule(&ctx_.dwork, K_MSEC(FILE_VIDEO_PERIOD_MS));
+		return 0;
+	}
+
+	void processEvent(int dstPort, Event &&evt) final override
+	{
+		if ((evt.event_id != kDo) || (!must_refresh_.load()) || (!opened_)) {
+			return;
+		}
+
+		uint16_t *frameBuffer = nullptr;
+		// If all frames are still used by the graph, this one is dropped
+		if (k_mem_slab_alloc(&file_video_slab, (void **)&frameBuffer, K_NO_WAIT) != 0) {
+			return;
+		}
+
+		if (!read_frame((uint8_t *)frameBuffer)) {
+			k_mem_slab_free(&file_video_slab, frameBuffer);
+			return;
+		}
+
+		UniquePtr<const uint16_t> tensorData((const uint16_t *)frameBuffer,
+						     release_video_frame);
+		TensorPtr<const uint16_t> t = TensorPtr<const uint16_t>::create_with(
+			(uint8_t)2, cg_tensor_dims_t{(uint32_t)height_, (uint32_t)width_},
+			std::move(tensorData));
+
+		ev.sendSync(kHighPriority, kValue, std::move(t));
+	};
+
+	void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
+	{
+		if (outputPort == 0) {
+			ev.subscribe(dst, dstPort);
+		}
+	}
+
+      protected:
+	// Read a full frame. Loop to the beginning of the file when
+	// the end is reached.
+	bool read_frame(uint8_t *dst)
+	{
+		const size_t frameSize = (size_t)width_ * height_ * 2;
+
+		ssize_t nb = fs_read(&file_, dst, frameSize);
+		if ((nb >= 0) && ((size_t)nb < frameSize)) {
+			// Partial frame at the end of the file is ignored
+			if (fs_seek(&file_, 0, FS_SEEK_SET) < 0) {
+				LOG_ERR("Unable to rewind video file %s", path_);
+				return false;
+			}
+			nb = fs_read(&file_, dst, frameSize);
+		}
+
+		if ((nb < 0) || ((size_t)nb != frameSize)) {
+			LOG_ERR("Unable to read frame from %s", path_);
+			return false;
+		}
+		return true;
+	}
+
+	FileVideoCtx ctx_;
+	EventQueue *queue_;
+	EventOutput ev;
+	const char *path_;
+	int width_;
+	int height_;
+	struct fs_file_t file_;
+	bool opened_{false};
+	std::atomic<bool> must_refresh_{false};
+};
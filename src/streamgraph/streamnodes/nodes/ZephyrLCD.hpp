@@ -12,29 +12,110 @@ extern "C"
 }
 
 #include "init_drv_src.hpp"
+#include "stream_runner.hpp"
 
 using namespace arm_cmsis_stream;
 
+struct LCDCtx {
+  struct k_work_delayable dwork;
+  void *owner;
+};
+
+/*
+
+Nodes receiving data faster than the panel refresh rate should not
+render on each new data. They call requestRedraw() to mark the view
+as dirty. A single timer then sends a kDo event to the node at most
+CONFIG_DISPLAY_MAX_FPS times per second. The node calls renderIfDirty()
+when it receives this kDo event.
+
+*/
 class ZephyrLCD : public StreamNode, public ContextSwitch
 {
     public:
 	static constexpr size_t DISPLAY_IMAGE_SIZE = (DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(uint16_t));
+	static constexpr uint32_t MIN_FRAME_PERIOD_MS = 1000 / CONFIG_DISPLAY_MAX_FPS;
 
 	ZephyrLCD() : StreamNode()
 	{
+		ctx_.owner = this;
+		k_work_init_delayable(&ctx_.dwork, &ZephyrLCD::redrawTimer);
 	};
 
 	int pause()
 	{
+		active_.store(false);
+		k_work_cancel_delayable(&ctx_.dwork);
+		dirty_.store(false);
+		// The events of the graph are cleared during the pause
+		redrawPending_.store(false);
 		return 0;
 	}
 
 	int resume()
 	{
-		clear_display();
+		// Queue of the graph being resumed. EventQueue::cg_eventQueue
+		// cannot be used later when several graphs are running.
+		queue_ = EventQueue::cg_eventQueue;
+		blank_display();
+		active_.store(true);
 		return 0;
 	}
 
+	// Mark the view as dirty. A redraw will be triggered
+	// when the minimum frame period has elapsed.
+	void requestRedraw()
+	{
+		dirty_.store(true);
+		if (!active_.load()) {
+			return;
+		}
+		// The timer is scheduled or its kDo has not yet been handled
+		if (redrawPending_.exchange(true)) {
+			return;
+		}
+		uint32_t elapsed = k_uptime_get_32() - lastRenderMs_;
+		uint32_t wait = (elapsed >= MIN_FRAME_PERIOD_MS) ? 0 : MIN_FRAME_PERIOD_MS - elapsed;
+		k_work_schedule(&ctx_.dwork, K_MSEC(wait));
+	}
+
+	// Render only if some data has changed since last rendering
+	bool renderIfDirty()
+	{
+		// A background graph keeps its view dirty until
+		// it owns the display
+		redrawPending_.store(false);
+		if (!stream_runner_owns_display()) {
+			return false;
+		}
+		if (!dirty_.exchange(false)) {
+			return false;
+		}
+		lastRenderMs_ = k_uptime_get_32();
+		if (!renderNewFrame()) {
+			// The update is not lost. Try again after a frame period.
+			requestRedraw();
+			return false;
+		}
+		return true;
+	}
+
+	static void redrawTimer(struct k_work *work)
+	{
+		struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+		LCDCtx *ctx = CONTAINER_OF(dwork, LCDCtx, dwork);
+		ZephyrLCD *self = static_cast<ZephyrLCD *>(ctx->owner);
+
+		bool pushed = false;
+		if (self->active_.load() && self->dirty_.load()) {
+			pushed = self->queue_->push(LocalDestination{self, 0}, Event(kDo, kNormalPriority));
+		}
+		if (!pushed) {
+			self->redrawPending_.store(false);
+		}
+	}
+
 	void *renderingFrame() const
 	{
 		return display_inactive_buffer();
@@ -42,6 +123,7 @@ class ZephyrLCD : public StreamNode, public ContextSwitch
 
 	virtual ~ZephyrLCD()
 	{
+		k_work_cancel_delayable(&ctx_.dwork);
 	};
 
 	virtual void drawFrame() = 0;
@@ -49,21 +131,28 @@ class ZephyrLCD : public StreamNode, public ContextSwitch
 	// The node was asked to render a new frame
 	bool renderNewFrame()
 	{
-		if (inRender.load()) {
+		if (inRender.load() || !stream_runner_owns_display()) {
 			return false;
 		}
 
 		inRender.store(true);
 
+		stream_resource_lock(STREAM_RESOURCE_DISPLAY);
 		this->drawFrame();
+        display_next_frame();
+		stream_resource_unlock(STREAM_RESOURCE_DISPLAY);
 
 		inRender.store(false);
-
-        display_next_frame();
 		return true;
 	}
 
 	
       protected:
 	std::atomic<bool> inRender{false};
+	std::atomic<bool> dirty_{false};
+	std::atomic<bool> active_{false};
+	std::atomic<bool> redrawPending_{false};
+	uint32_t lastRenderMs_{0};
+	EventQueue *queue_{nullptr};
+	LCDCtx ctx_;
 };
\ No newline at end of file
@@ -25,23 +25,86 @@ Alif video example modified for inclusion in CMSIS Stream
 #include <zephyr/drivers/video.h>
 #include <zephyr/logging/log.h>
 
+#include <atomic>
+
 using namespace arm_cmsis_stream;
 
-#define N_FRAMES   1
+// At least two buffers are needed so that the driver can capture
+// into one buffer while a consumer of the graph is still using the other.
+#define N_FRAMES   3
 #define N_VID_BUFF MIN(CONFIG_VIDEO_BUFFER_POOL_NUM_MAX, N_FRAMES)
 
 #define FORMAT_TO_CAPTURE VIDEO_PIX_FMT_RGB565
 #define MAX_WIDTH         480
 #define MAX_HEIGHT        272
 
-// RGB565
+// Period used to poll the driver for a new captured frame
+#define VIDEO_POLL_PERIOD_MS 10
+
+/*
+ * As per our observation, if we are not giving this much delay
+ * after the setup then mt9m114 camera sensor is not setup properly
+ * and images its sending out are not clear.
+ */
+#define VIDEO_SENSOR_WARMUP_MS 7000
+
+BUILD_ASSERT(N_VID_BUFF >= 2, "CONFIG_VIDEO_BUFFER_POOL_NUM_MAX must be at least 2");
+
+struct VideoCtx {
+  struct k_work_delayable dwork;
+  struct k_work_delayable warmup;
+  void *owner;
+};
+
+/*
+
+RGB565
+
+The sensor needs several seconds after setup before the frames
+are usable. init() only does the setup and returns. The warm-up
+is done on a delayable work item so that boot of the other
+graphs is not delayed. Capture is started when the sensor is ready
+and the graph has been resumed (in whatever order those two
+things happen).
+
+*/
 class ZephyrVideoSource : public StreamNode, public ContextSwitch
 {
       public:
-	ZephyrVideoSource(EventQueue *queue) : StreamNode(), ev(queue)
+	enum SensorState {
+		kUninitialized,
+		kWarmingUp,
+		kReady
+	};
+
+	ZephyrVideoSource(EventQueue *queue) : StreamNode(), queue_(queue), ev(queue)
+	{
+		ctx_.owner = this;
+		k_work_init_delayable(&ctx_.dwork, &ZephyrVideoSource::refresh);
+		k_work_init_delayable(&ctx_.warmup, &ZephyrVideoSource::warmup_done);
+		k_mutex_init(&lock_);
+	}
+
+	// The work items must not run once the node has been freed
+	~ZephyrVideoSource()
+	{
+		struct k_work_sync sync;
+
+		must_refresh_.store(false);
+		k_work_cancel_delayable_sync(&ctx_.warmup, &sync);
+		k_work_cancel_delayable_sync(&ctx_.dwork, &sync);
+	}
+
+	// The sensor is still warming up when init() returns. Reported to the
+	// C interface of the node (cstream_node.h).
+	bool needsAsynchronousInit() const final override
+	{
+		return true;
+	}
+
+	bool ready() const
 	{
-		dt = 1.0f / 10.0f;
-		val = 0.0f;
+		return (state_.load() == kReady);
 	}
 
 	cg_status init() final override
@@ -50,7 +113,8 @@ class ZephyrVideoSource : public StreamNode, public ContextSwitch
 		int ret;
 		size_t bsize;
 
-		video = DEVICE_DT_GET_ONE(alif_cam);
+		video_ = DEVICE_DT_GET_ONE(alif_cam);
+		const struct device *video = video_;
 		if (!device_is_ready(video)) {
 			LOG_ERR("%s: device not ready.", video->name);
 			return (CG_INIT_FAILURE);
@@ -136,57 +200,129 @@ class ZephyrVideoSource : public StreamNode, public ContextSwitch
 			fmt.pitch, fmt.height, bsize);
 
 		/* Alloc video buffers and enqueue for capture */
-		for (i = 0; i < ARRAY_SIZE(buffers); i++) {
-			buffers[i] = video_buffer_alloc(bsize,K_NO_WAIT);
-			if (buffers[i] == NULL) {
+		for (i = 0; i < ARRAY_SIZE(buffers_); i++) {
+			buffers_[i] = video_buffer_alloc(bsize,K_NO_WAIT);
+			if (buffers_[i] == NULL) {
 				LOG_ERR("Unable to alloc video buffer");
 				return (CG_INIT_FAILURE);
 			}
 
 			/* Allocated Buffer Information */
 			LOG_INF("- addr - 0x%x, size - %d, bytesused - %d\n",
-				(uint32_t)buffers[i]->buffer, bsize, buffers[i]->bytesused);
+				(uint32_t)buffers_[i]->buffer, bsize, buffers_[i]->bytesused);
 
-			memset(buffers[i]->buffer, 0, sizeof(char) * bsize);
-			video_enqueue(video, VIDEO_EP_OUT, buffers[i]);
+			memset(buffers_[i]->buffer, 0, sizeof(char) * bsize);
+			video_enqueue(video, VIDEO_EP_OUT, buffers_[i]);
 
 			LOG_INF("capture buffer[%d]: dump binary memory "
 				"\"/home/$USER/capture_%d.bin\" 0x%08x 0x%08x -r\n\n",
-				i, i, (uint32_t)buffers[i]->buffer,
-				(uint32_t)buffers[i]->buffer + bsize - 1);
+				i, i, (uint32_t)buffers_[i]->buffer,
+				(uint32_t)buffers_[i]->buffer + bsize - 1);
 		}
 
-		/*
-		 * TODO: Need to fix this delay.
-		 * As per our observation, if we are not giving this much delay
-		 * then mt9m114 camera sensor is not setup properly and images its
-		 * sending out are not clear.
-		 */
-		k_msleep(7000);
+		state_.store(kWarmingUp);
+		k_work_schedule(&ctx_.warmup, K_MSEC(VIDEO_SENSOR_WARMUP_MS));
 
 		return (CG_SUCCESS);
 	}
 
 	int pause() final
-	{		
-		
+	{
+		k_mutex_lock(&lock_, K_FOREVER);
+		must_refresh_.store(false);
+		k_work_cancel_delayable(&ctx_.dwork);
+		if (streaming_) {
+			if (video_stream_stop(video_)) {
+				LOG_ERR("Unable to stop video capture");
+			}
+			streaming_ = false;
+		}
+		k_mutex_unlock(&lock_);
 		return 0;
 	}
 
 	int resume() final
 	{
-		
-		return 0;
+		int err = 0;
+
+		k_mutex_lock(&lock_, K_FOREVER);
+		must_refresh_.store(true);
+		// If the sensor is still warming up, capture is started
+		// by warmup_done
+		if (ready()) {
+			err = start_capture();
+		}
+		k_mutex_unlock(&lock_);
+		return err;
+	}
+
+	static void warmup_done(struct k_work *work)
+	{
+		struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+		VideoCtx *ctx = CONTAINER_OF(dwork, VideoCtx, warmup);
+		ZephyrVideoSource *self = static_cast<ZephyrVideoSource *>(ctx->owner);
+
+		k_mutex_lock(&self->lock_, K_FOREVER);
+		self->state_.store(kReady);
+		LOG_INF("Camera sensor ready");
+		if (self->must_refresh_.load()) {
+			self->start_capture();
+		}
+		k_mutex_unlock(&self->lock_);
 	}
 
+	/*
+
+	Called when the last reference to a captured frame is released
+	by the graph. The buffer is given back to the driver so that it can
+	be used for a new capture. Frames are never copied.
+
+	*/
 	static void release_video_frame(void *frame)
 	{
+		for (size_t i = 0; i < ARRAY_SIZE(buffers_); i++) {
+			if ((buffers_[i] != nullptr) && (buffers_[i]->buffer == frame)) {
+				video_enqueue(video_, VIDEO_EP_OUT, buffers_[i]);
+				return;
+			}
+		}
+		LOG_ERR("Released frame is not a video buffer");
+	}
+
+	static void refresh(struct k_work *work)
+	{
+		struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+		VideoCtx *ctx = CONTAINER_OF(dwork, VideoCtx, dwork);
+		ZephyrVideoSource *self = static_cast<ZephyrVideoSource *>(ctx->owner);
+
+		// Polling is rescheduled here and not when the kDo is processed
+		// so that a dropped event does not stop the capture
+		if (self->must_refresh_.load()) {
+			self->queue_->push(LocalDestination{self, 0}, Event(kDo, kNormalPriority));
+			k_work_schedule(dwork, K_MSEC(VIDEO_POLL_PERIOD_MS));
+		}
 	}
 
 	void processEvent(int dstPort, Event &&evt) final override
 	{
-		
-		
+		if ((evt.event_id != kDo) || (!must_refresh_.load()) || (!ready())) {
+			return;
+		}
+
+		struct video_buffer *vbuf = nullptr;
+		// Send all the frames captured since last poll. Consumers
+		// decide if they want to keep them or not.
+		while (video_dequeue(video_, VIDEO_EP_OUT, &vbuf, K_NO_WAIT) == 0) {
+			UniquePtr<const uint16_t> tensorData((const uint16_t *)vbuf->buffer,
+							     release_video_frame);
+			TensorPtr<const uint16_t> t = TensorPtr<const uint16_t>::create_with(
+				(uint8_t)2, cg_tensor_dims_t{fmt.height, fmt.width},
+				std::move(tensorData));
+
+			ev.sendSync(kHighPriority, kValue, std::move(t));
+		}
 	};
 
 	void subscribe(int outputPort, StreamNode &dst, int dstPort) final override
@@ -197,11 +333,32 @@ class ZephyrVideoSource : public StreamNode, public ContextSwitch
 	}
 
       protected:
+	// Must be called with lock_ taken
+	int start_capture()
+	{
+		if (!streaming_) {
+			if (video_stream_start(video_)) {
+				LOG_ERR("Unable to start video capture");
+				return -1;
+			}
+			streaming_ = true;
+		}
+		k_work_schedule(&ctx_.dwork, K_MSEC(VIDEO_POLL_PERIOD_MS));
+		return 0;
+	}
+
+	VideoCtx ctx_;
+	EventQueue *queue_;
 	EventOutput ev;
-	float dt;
-	float val;
-	struct video_buffer *buffers[N_VID_BUFF], *vbuf;
 	struct video_format fmt = {0};
 	struct video_caps caps;
-	const struct device *video;
+	bool streaming_{false};
+	struct k_mutex lock_;
+	std::atomic<SensorState> state_{kUninitialized};
+	std::atomic<bool> must_refresh_{false};
+
+	// Static because the release callback of a frame has no
+	// access to the node. There is only one camera.
+	static inline struct video_buffer *buffers_[N_VID_BUFF] = {nullptr};
+	static inline const struct device *video_ = nullptr;
 };
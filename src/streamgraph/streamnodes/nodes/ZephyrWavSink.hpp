@@ -0,0 +1,140 @@
+#pragma once
+
+/*
+
+File backed audio sink.
+
+Used for host testing (native_sim) when there is no audio output, and
+to measure the timing of a graph (see AudioSinkTiming.hpp).
+The stereo samples are appended to a 16-bit PCM WAV file at
+CONFIG_SAMPLE_RATE. The sizes in the WAV header are updated each time
+the graph is paused and when the node is destroyed.
+
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "cg_enums.h"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+#include "arm_math_types.h"
+
+#include "AudioSinkTiming.hpp"
+
+using namespace arm_cmsis_stream;
+
+#define WAV_HEADER_SIZE 44
+
+template <typename IN, int inputSize> class ZephyrWavSink;
+
+template <int inputSamples>
+class ZephyrWavSink<sq15, inputSamples> : public GenericSink<sq15, inputSamples>, public ContextSwitch
+{
+	static constexpr size_t blockSize = inputSamples * sizeof(sq15);
+
+      public:
+	ZephyrWavSink(FIFOBase<sq15> &src, const char *path, const struct hardwareParams &settings)
+		: GenericSink<sq15, inputSamples>(src), path_(path), settings_(settings),
+		  timing_(inputSamples)
+	{
+		fs_file_t_init(&file_);
+	};
+
+	~ZephyrWavSink()
+	{
+		if (opened_) {
+			update_header();
+			fs_close(&file_);
+		}
+	}
+
+	cg_status init() final override
+	{
+		int ret = fs_open(&file_, path_, FS_O_CREATE | FS_O_WRITE);
+		if (ret < 0) {
+			LOG_ERR("Unable to open WAV file %s (%d)", path_, ret);
+			return (CG_INIT_FAILURE);
+		}
+		opened_ = true;
+
+		if ((fs_truncate(&file_, 0) < 0) || !update_header()) {
+			LOG_ERR("Unable to write WAV header to %s", path_);
+			return (CG_INIT_FAILURE);
+		}
+
+		return (CG_SUCCESS);
+	}
+
+	int pause() final
+	{
+		if (opened_) {
+			update_header();
+		}
+		timing_.report(path_);
+		timing_.reset();
+		return 0;
+	}
+
+	int resume() final
+	{
+		return 0;
+	}
+
+	int run() final
+	{
+		sq15 *in = this->getReadBuffer();
+
+		ssize_t nb = fs_write(&file_, in, blockSize);
+		if ((nb < 0) || ((size_t)nb != blockSize)) {
+			LOG_ERR("Unable to write to %s", path_);
+			return (CG_BUFFER_OVERFLOW);
+		}
+		dataSize_ += blockSize;
+
+		timing_.block(settings_);
+
+		return (CG_SUCCESS);
+	};
+
+      protected:
+	bool update_header()
+	{
+		constexpr uint16_t channels = 2;
+		constexpr uint16_t bitsPerSample = 16;
+		uint8_t h[WAV_HEADER_SIZE];
+
+		memcpy(h, "RIFF", 4);
+		sys_put_le32(WAV_HEADER_SIZE - 8 + dataSize_, h + 4);
+		memcpy(h + 8, "WAVEfmt ", 8);
+		sys_put_le32(16, h + 16);
+		sys_put_le16(1, h + 20); // PCM
+		sys_put_le16(channels, h + 22);
+		sys_put_le32(CONFIG_SAMPLE_RATE, h + 24);
+		sys_put_le32(CONFIG_SAMPLE_RATE * channels * bitsPerSample / 8, h + 28);
+		sys_put_le16(channels * bitsPerSample / 8, h + 32);
+		sys_put_le16(bitsPerSample, h + 34);
+		memcpy(h + 36, "data", 4);
+		sys_put_le32(dataSize_, h + 40);
+
+		if (fs_seek(&file_, 0, FS_SEEK_SET) < 0) {
+			return false;
+		}
+		bool ok = (fs_write(&file_, h, WAV_HEADER_SIZE) == WAV_HEADER_SIZE);
+		// Next samples are appended
+		if (fs_seek(&file_, 0, FS_SEEK_END) < 0) {
+			return false;
+		}
+		fs_sync(&file_);
+		return ok;
+	}
+
+	const char *path_;
+	struct fs_file_t file_;
+	bool opened_{false};
+	uint32_t dataSize_{0};
+	const struct hardwareParams &settings_;
+	AudioSinkTiming timing_;
+};
@@ -0,0 +1,171 @@
+// This file is automatically generated by python/nodes/Resampler.py. Do not edit.
+#pragma once
+
+// Polyphase filter for a 160/441 resampler
+template <>
+struct ResamplerFilter<160, 441>
+{
+    static constexpr int tapsPerPhase = 48;
+    static constexpr float coefs[160][48] = {
+        {-9.00649859e-05f, -0.000105958002f, 0.000154300205f, 0.000603043343f, 0.000578615424f, -0.00054360842f, -0.00210353077f, -0.00196451015f, 0.0013008527f, 0.00548839827f, 0.00521932569f, -0.00244950335f, -0.0120905303f, -0.0119846858f, 0.00385420121f, 0.0243139082f, 0.0257365806f, -0.00521345223f, -0.0492918265f, -0.0588583214f, 0.00608329961f, 0.137022875f, 0.270101047f, 0.326523868f, 0.270762154f, 0.137934739f, 0.00673839916f, -0.0587066182f, -0.0495142692f, -0.0054877702f, 0.0256433831f, 0.0244071297f, 0.00398910326f, -0.0119331324f, -0.0121325209f, -0.00251423737f, 0.00519380829f, 0.00550646255f, 0.00132879946f, -0.00195385018f, -0.00211048394f, -0.000553653687f, 0.000575236817f, 0.000605272672f, 0.000156921514f, -0.000105363427f, -9.05754449e-05f, -1.53101829e-05f},
+        {-8.95527445e-05f, -0.000106540776f, 0.000151688587f, 0.000600795826f, 0.000581946499f, -0.000533586341f, -0.00209650949f, -0.00197503455f, 0.0012729551f, 0.00547015248f, 0.00524452282f, -0.00238487226f, -0.0120481404f, -0.012035561f, 0.00371953029f, 0.0242199099f, 0.0258283942f, -0.0049397561f, -0.0490680141f, -0.0590069393f, 0.00543098239f, 0.136111153f, 0.26943679f, 0.326519228f, 0.271420092f, 0.138846723f, 0.007396271f, -0.0585518241f, -0.0497353283f, -0.00576270044f, 0.0255488019f, 0.0244995682f, 0.00412423123f, -0.0118809011f, -0.0121741092f, -0.00257907172f, 0.00516797071f, 0.00552434383f, 0.00135679425f, -0.0019430546f, -0.00211736836f, -0.000563721741f, 0.000571810611f, 0.000607483581f, 0.000159552422f, -0.000104757001f, -9.10840652e-05f, -1.56162207e-05f},
+        {-8.9038777e-05f, -0.000107111796f, 0.000149086754f, 0.000598530348f, 0.000585230116f, -0.000523587846f, -0.00208942074f, -0.00198542341f, 0.00124510779f, 0.00545172667f, 0.00526939961f, -0.00232034667f, -0.0120053545f, -0.0120857578f, 0.00358509569f, 0.024125141f, 0.0259188244f, -0.00466669136f, -0.0488428455f, -0.0591524779f, 0.00478145743f, 0.135199593f, 0.2687694f, 0.326509949f, 0.272074846f, 0.139758806f, 0.00805690499f, -0.0583939334f, -0.0499549905f, -0.0060382333f, 0.0254528368f, 0.0245912173f, 0.00425957986f, -0.0118279922f, -0.0122152921f, -0.00264400381f, 0.00514181303f, 0.00554204063f, 0.00138483595f, -0.00193212338f, -0.00212418338f, -0.00057381218f, 0.000568336736f, 0.000609675843f, 0.000162192831f, -0.000104138679f, -9.15907898e-05f, -1.59251671e-05f},
+        {-8.85231394e-05f, -0.000107671113f, 0.000146494797f, 0.00059624714f, 0.000588466349f, -0.000513613327f, -0.00208226517f, -0.00199567681f, 0.00121731189f, 0.00543312232f, 0.00529395601f, -0.00225592914f, -0.0119621757f, -0.0121352761f, 0.00345090257f, 0.024029608f, 0.0260078711f, -0.00439426747f, -0.0486163343f, -0.0592949429f, 0.00413473457f, 0.134288217f, 0.268098893f, 0.32649603f, 0.272726398f, 0.140670968f, 0.00872029092f, -0.0582329404f, -0.0501732419f, -0.0063143591f, 0.0253554877f, 0.0246820707f, 0.00439514388f, -0.011774406f, -0.0122560665f, -0.00270903101f, 0.00511533537f, 0.00555955146f, 0.0014129234f, -0.00192105648f, -0.00213092838f, -0.000583924599f, 0.000564815127f, 0.000611849226f, 0.000164842646f, -0.000103508411f, -9.20955618e-05f, -1.62370192e-05f},
+        {-8.80058872e-05f, -0.000108218776f, 0.000143912809f, 0.00059394643f, 0.000591655274f, -0.000503663176f, -0.00207504343f, -0.00200579479f, 0.00118956851f, 0.00541434095f, 0.00531819199f, -0.00219162224f, -0.011918607f, -0.0121841157f, 0.00331695609f, 0.0239333172f, 0.0260955349f, -0.00412249387f, -0.0483884943f, -0.0594343406f, 0.00349082353f, 0.133377046f, 0.267425288f, 0.326477472f, 0.273374731f, 0.141583186f, 0.00938641845f, -0.0580688398f, -0.0503900691f, -0.00659106809f, 0.0252567548f, 0.0247721223f, 0.00453091802f, -0.0117201428f, -0.0122964294f, -0.0027741507f, 0.00508853787f, 0.00557687486f, 0.00144105546f, -0.00190985388f, -0.00213760271f, -0.00059405859f, 0.000561245721f, 0.000614003501f, 0.000167501769f, -0.000102866151f, -9.25983239e-05f, -1.65517734e-05f},
+        {-8.74870759e-05f, -0.000108754834f, 0.000141340877f, 0.000591628447f, 0.000594796971f, -0.00049373778f, -0.00206775615f, -0.00201577743f, 0.00116187874f, 0.00539538404f, 0.00534210751f, -0.00212742849f, -0.0118746517f, -0.0122322764f, 0.00318326135f, 0.0238362749f, 0.0261818159f, -0.00385137993f, -0.0481593391f, -0.0595706768f, 0.00284973397f, 0.132466101f, 0.266748602f, 0.326454276f, 0.274019828f, 0.14249544f, 0.0100552771f, -0.057901626f, -0.0506054584f, -0.00686835048f, 0.0251566382f, 0.0248613658f, 0.00466689695f, -0.0116652029f, -0.0123363776f, -0.00283936024f, 0.00506142066f, 0.00559400934f, 0.00146923098f, -0.00189851558f, -0.00214420573f, -0.000604213741f, 0.000557628458f, 0.000616138437f, 0.000170170101f, -0.000102211854f, -9.30990185e-05f, -1.68694263e-05f},
+        {-8.69667605e-05f, -0.000109279339f, 0.000138779091f, 0.000589293419f, 0.000597891519f, -0.000483837523f, -0.00206040397f, -0.00202562479f, 0.00113424369f, 0.00537625311f, 0.00536570258f, -0.00206335043f, -0.0118303128f, -0.0122797582f, 0.00304982345f, 0.0237384875f, 0.0262667147f, -0.00358093495f, -0.0479288824f, -0.0597039578f, 0.00221147541f, 0.131555402f, 0.266068852f, 0.326426442f, 0.274661672f, 0.143407708f, 0.0107268565f, -0.0577312938f, -0.0508193963f, -0.00714619643f, 0.0250551381f, 0.024949795f, 0.00480307533f, -0.0116095869f, -0.0123759081f, -0.00290465697f, 0.0050339839f, 0.00561095345f, 0.00149744878f, -0.00188704156f, -0.0021507368f, -0.000614389637f, 0.000553963278f, 0.000618253805f, 0.000172847543f, -0.000101545473f, -9.35975878e-05f, -1.7189974e-05f},
+        {-8.64449958e-05f, -0.000109792341f, 0.000136227539f, 0.000586941574f, 0.000600939004f, -0.000473962785f, -0.00205298756f, -0.00203533696f, 0.00110666444f, 0.00535694965f, 0.0053889772f, -0.00199939056f, -0.0117855935f, -0.012326561f, 0.00291664745f, 0.0236399613f, 0.0263502316f, -0.0033111682f, -0.0476971379f, -0.0598341898f, 0.0015760573f, 0.130644972f, 0.265386056f, 0.32639397f, 0.275300247f, 0.144319969f, 0.0114011459f, -0.057557838f, -0.0510318692f, -0.00742459602f, 0.0249522547f, 0.0250374036f, 0.0049394478f, -0.0115532951f, -0.0124150179f, -0.00297003822f, 0.00500622776f, 0.00562770571f, 0.0015257077f, -0.00187543183f, -0.00215719529f, -0.000624585862f, 0.000550250126f, 0.000620349374f, 0.000175533992f, -0.000100866963f, -9.40939737e-05f, -1.75134121e-05f},
+        {-8.59218365e-05f, -0.000110293893f, 0.000133686305f, 0.000584573141f, 0.000603939508f, -0.000464113946f, -0.00204550754f, -0.00204491402f, 0.00107914209f, 0.00533747517f, 0.0054119314f, -0.00193555138f, -0.0117404971f, -0.0123726848f, 0.0027837384f, 0.0235407028f, 0.0264323671f, -0.0030420889f, -0.0474641192f, -0.0599613792f, 0.000943488971f, 0.129734829f, 0.264700232f, 0.326356863f, 0.275935536f, 0.145232202f, 0.0120781346f, -0.0573812533f, -0.0512428635f, -0.00770353931f, 0.0248479882f, 0.0251241856f, 0.00507600897f, -0.0114963279f, -0.0124537038f, -0.00303550133f, 0.00497815244f, 0.00564426467f, 0.00155400657f, -0.00186368638f, -0.00216358056f, -0.000634801994f, 0.000546488947f, 0.000622424913f, 0.000178229347f, -0.000100176279f, -9.45881178e-05f, -1.78397361e-05f},
+        {-8.53973366e-05f, -0.000110784045f, 0.000131155476f, 0.000582188346f, 0.000606893121f, -0.000454291381f, -0.00203796458f, -0.00205435606f, 0.0010516777f, 0.00531783119f, 0.0054345652f, -0.00187183538f, -0.0116950266f, -0.0124181295f, 0.00265110131f, 0.0234407184f, 0.0265131219f, -0.00277370618f, -0.04722984f, -0.0600855324f, 0.000313779662f, 0.128824997f, 0.264011398f, 0.32631512f, 0.276567523f, 0.146144385f, 0.0127578117f, -0.0572015347f, -0.0514523658f, -0.0079830163f, 0.0247423391f, 0.0252101348f, 0.00521275343f, -0.011438686f, -0.0124919629f, -0.0031010436f, 0.00494975815f, 0.00566062886f, 0.00158234421f, -0.00185180524f, -0.00216989198f, -0.000645037611f, 0.00054267969f, 0.000624480192f, 0.000180933505f, -9.94733771e-05f, -9.50799615e-05f, -1.81689413e-05f},
+        {-8.487155e-05f, -0.00011126285f, 0.000128635134f, 0.000579787418f, 0.000609799932f, -0.000444495461f, -0.0020303593f, -0.00206366317f, 0.00102427235f, 0.00529801923f, 0.00545687867f, -0.00180824504f, -0.0116491853f, -0.0124628952f, 0.00251874116f, 0.0233400144f, 0.0265924966f, -0.00250602916f, -0.0469943141f, -0.0602066558f, -0.000313061488f, 0.127915495f, 0.263319571f, 0.326268743f, 0.277196191f, 0.147056497f, 0.0134401665f, -0.0570186773f, -0.0516603625f, -0.00826301694f, 0.0246353078f, 0.025295245f, 0.00534967574f, -0.0113803698f, -0.0125297921f, -0.00316666233f, 0.00492104509f, 0.00567679684f, 0.00161071943f, -0.00183978842f, -0.00217612891f, -0.000655292287f, 0.000538822306f, 0.000626514979f, 0.00018364636f, -9.8758214e-05f, -9.5569446e-05f, -1.85010225e-05f},
+        {-8.43445306e-05f, -0.00011173036f, 0.000126125364f, 0.000577370582f, 0.000612660031f, -0.000434726554f, -0.00202269237f, -0.00207283548f, 0.000996927094f, 0.00527804079f, 0.00547887187f, -0.0017447828f, -0.0116029762f, -0.012506982f, 0.00238666291f, 0.0232385974f, 0.0266704918f, -0.00223906687f, -0.0467575552f, -0.060324756f, -0.000937025442f, 0.127006344f, 0.262624769f, 0.326217733f, 0.277821523f, 0.147968517f, 0.0141251878f, -0.0568326761f, -0.05186684f, -0.00854353112f, 0.0245268947f, 0.0253795101f, 0.00548677045f, -0.0113213798f, -0.0125671885f, -0.0032323548f, 0.00489201351f, 0.00569276716f, 0.00163913104f, -0.00182763595f, -0.00218229073f, -0.000665565592f, 0.000534916748f, 0.000628529046f, 0.000186367807f, -9.80307462e-05f, -9.60565121e-05f, -1.88359744e-05f},
+        {-8.38163315e-05f, -0.00011218663f, 0.000123626246f, 0.000574938067f, 0.000615473514f, -0.000424985028f, -0.00201496444f, -0.00208187307f, 0.000969642996f, 0.0052578974f, 0.00550054488f, -0.00168145112f, -0.0115564027f, -0.0125503899f, 0.00225487151f, 0.0231364737f, 0.0267471082f, -0.00197282831f, -0.0465195769f, -0.0604398398f, -0.00155810326f, 0.126097565f, 0.26192701f, 0.326162091f, 0.278443503f, 0.148880423f, 0.0148128646f, -0.0566435264f, -0.0520717849f, -0.00882454869f, 0.0244171003f, 0.0254629241f, 0.00562403206f, -0.0112617167f, -0.012604149f, -0.00329811829f, 0.00486266367f, 0.00570853837f, 0.00166757783f, -0.00181534785f, -0.00218837679f, -0.000675857094f, 0.000530962971f, 0.00063052216f, 0.000189097739f, -9.72909312e-05f, -9.65411005e-05f, -1.9173791e-05f},
+        {-8.32870057e-05f, -0.000112631712f, 0.000121137861f, 0.000572490097f, 0.000618240475f, -0.000415271245f, -0.00200717614f, -0.00209077607f, 0.000942421104f, 0.00523759059f, 0.00552189779f, -0.00161825242f, -0.011509468f, -0.0125931191f, 0.00212337185f, 0.0230336498f, 0.0268223468f, -0.00170732239f, -0.046280393f, -0.0605519137f, -0.00217628612f, 0.125189178f, 0.261226313f, 0.326101819f, 0.279062116f, 0.149792193f, 0.0155031856f, -0.0564512234f, -0.0522751838f, -0.00910605944f, 0.0243059253f, 0.0255454807f, 0.00576145509f, -0.0112013811f, -0.0126406706f, -0.00336395006f, 0.00483299581f, 0.00572410904f, 0.0016960586f, -0.00180292418f, -0.00219438648f, -0.000686166358f, 0.000526960934f, 0.00063249409f, 0.000191836049f, -9.65387268e-05f, -9.70231517e-05f, -1.95144666e-05f},
+        {-8.27566061e-05f, -0.00011306566f, 0.000118660289f, 0.0005700269f, 0.000620961012f, -0.000405585564f, -0.00199932812f, -0.00209954461f, 0.00091526246f, 0.00521712186f, 0.00554293073f, -0.00155518913f, -0.0114621751f, -0.0126351697f, 0.00199216882f, 0.0229301323f, 0.0268962082f, -0.001442558f, -0.0460400171f, -0.0606609847f, -0.00279156526f, 0.124281206f, 0.260522695f, 0.326036919f, 0.279677344f, 0.150703807f, 0.0161961396f, -0.0562557625f, -0.0524770231f, -0.00938805312f, 0.0241933702f, 0.025627174f, 0.00589903399f, -0.0111403736f, -0.0126767504f, -0.00342984736f, 0.00480301024f, 0.00573947773f, 0.00172457214f, -0.00179036498f, -0.00220031915f, -0.000696492947f, 0.000522910596f, 0.000634444606f, 0.000194582626f, -9.57740917e-05f, -9.75026057e-05f, -1.98579946e-05f},
+        {-8.2225185e-05f, -0.000113488529f, 0.000116193607f, 0.000567548701f, 0.000623635226f, -0.000395928342f, -0.00199142105f, -0.00210817881f, 0.0008881681f, 0.00519649276f, 0.0055636438f, -0.00149226364f, -0.0114145275f, -0.0126765418f, 0.00186126728f, 0.0228259275f, 0.0269686935f, -0.00117854396f, -0.0457984632f, -0.0607670596f, -0.00340393207f, 0.123373667f, 0.259816175f, 0.325967393f, 0.280289172f, 0.151615243f, 0.0168917152f, -0.0560571392f, -0.0526772895f, -0.00967051942f, 0.0240794359f, 0.025707998f, 0.00603676323f, -0.0110786949f, -0.0127123854f, -0.00349580744f, 0.00477270724f, 0.005754643f, 0.00175311724f, -0.0017776703f, -0.0022061742f, -0.000706836419f, 0.000518811922f, 0.000636373478f, 0.00019733736f, -9.49969848e-05f, -9.79794024e-05f, -2.02043685e-05f},
+        {-8.16927946e-05f, -0.000113900373f, 0.000113737893f, 0.000565055725f, 0.000626263218f, -0.000386299932f, -0.00198345555f, -0.0021166788f, 0.000861139052f, 0.00517570481f, 0.00558403716f, -0.00142947835f, -0.0113665281f, -0.0127172358f, 0.00173067204f, 0.0227210419f, 0.0270398035f, -0.000915289036f, -0.0455557447f, -0.0608701453f, -0.004013378f, 0.122466584f, 0.25910677f, 0.325893241f, 0.280897584f, 0.15252648f, 0.0175899009f, -0.055855349f, -0.0528759695f, -0.009953448f, 0.023964123f, 0.0257879465f, 0.00617463722f, -0.0110163458f, -0.0127475725f, -0.00356182751f, 0.00474208714f, 0.00576960344f, 0.00178169266f, -0.0017648402f, -0.00221195098f, -0.000717196332f, 0.000514664874f, 0.000638280473f, 0.000200100141f, -9.42073659e-05f, -9.84534817e-05f, -2.05535812e-05f},
+        {-8.11594866e-05f, -0.000114301247f, 0.000111293222f, 0.000562548197f, 0.000628845092f, -0.000376700684f, -0.00197543229f, -0.00212504474f, 0.000834176338f, 0.00515475955f, 0.00560411096f, -0.00136683563f, -0.0113181804f, -0.0127572517f, 0.00160038792f, 0.0226154821f, 0.0271095393f, -0.000652801928f, -0.0453118755f, -0.0609702491f, -0.00461989463f, 0.121559975f, 0.2583945f, 0.325814466f, 0.281502564f, 0.153437495f, 0.018290685f, -0.0556503876f, -0.0530730496f, -0.0102368284f, 0.0238474324f, 0.0258670137f, 0.00631265037f, -0.010953327f, -0.012782309f, -0.00362790479f, 0.00471115025f, 0.00578435762f, 0.00181029719f, -0.00175187474f, -0.00221764887f, -0.000727572238f, 0.000510469423f, 0.000640165361f, 0.000202870855f, -9.34051951e-05f, -9.89247828e-05f, -2.09056256e-05f},
+        {-8.06253126e-05f, -0.000114691208f, 0.000108859669f, 0.000560026341f, 0.000631380955f, -0.000367130947f, -0.00196735192f, -0.00213327675f, 0.000807280974f, 0.00513365849f, 0.00562386536f, -0.00130433785f, -0.0112694875f, -0.0127965899f, 0.00147041967f, 0.0225092546f, 0.027177902f, -0.00039109129f, -0.0450668693f, -0.0610673779f, -0.00522347362f, 0.120653863f, 0.257679382f, 0.325731071f, 0.282104095f, 0.154348267f, 0.0189940559f, -0.0554422506f, -0.0532685166f, -0.0105206503f, 0.023729365f, 0.0259451934f, 0.00645079707f, -0.0108896393f, -0.0128165918f, -0.00369403649f, 0.00467989694f, 0.00579890413f, 0.00183892958f, -0.00173877401f, -0.00222326725f, -0.000737963688f, 0.000506225537f, 0.000642027912f, 0.000205649389f, -9.25904333e-05f, -9.93932451e-05f, -2.1260494e-05f},
+        {-8.00903237e-05f, -0.000115070311f, 0.000106437308f, 0.000557490383f, 0.000633870913f, -0.000357591062f, -0.00195921507f, -0.00214137501f, 0.000780453966f, 0.00511240319f, 0.00564330055f, -0.00124198735f, -0.0112204526f, -0.0128352508f, 0.00134077206f, 0.0224023659f, 0.0272448927f, -0.000130165717f, -0.0448207399f, -0.0611615389f, -0.00582410675f, 0.119748267f, 0.256961436f, 0.325643057f, 0.282702163f, 0.155258775f, 0.0197000019f, -0.055230934f, -0.053462357f, -0.0108049031f, 0.0236099217f, 0.0260224798f, 0.00658907168f, -0.0108252834f, -0.012850418f, -0.00376021981f, 0.00464832755f, 0.00581324155f, 0.00186758859f, -0.00172553809f, -0.0022288055f, -0.000748370231f, 0.000501933189f, 0.000643867894f, 0.000208435627f, -9.17630418e-05f, -9.98588075e-05f, -2.16181785e-05f},
+        {-7.95545708e-05f, -0.000115438611f, 0.000104026212f, 0.000554940545f, 0.000636315078f, -0.000348081372f, -0.00195102241f, -0.00214933966f, 0.000753696316f, 0.00509099518f, 0.00566241672f, -0.00117978646f, -0.0111710791f, -0.0128732345f, 0.00121144978f, 0.0222948225f, 0.0273105125f, 0.000129966254f, -0.0445735009f, -0.0612527396f, -0.00642178588f, 0.118843209f, 0.256240679f, 0.325550427f, 0.283296752f, 0.156168998f, 0.020408511f, -0.0550164336f, -0.0536545575f, -0.0110895762f, 0.0234891036f, 0.0260988669f, 0.00672746853f, -0.0107602603f, -0.0128837847f, -0.00382645191f, 0.00461644247f, 0.00582736848f, 0.00189627298f, -0.00171216706f, -0.002234263f, -0.00075879141f, 0.000497592355f, 0.000645685076f, 0.000211229454f, -9.09229825e-05f, -0.000100321409f, -2.1978671e-05f},
+        {-7.90181045e-05f, -0.000115796166f, 0.000101626452f, 0.000552377052f, 0.000638713559f, -0.000338602215f, -0.00194277458f, -0.00215717087f, 0.000727009017f, 0.005069436f, 0.00568121408f, -0.00111773751f, -0.0111213701f, -0.0129105415f, 0.00108245755f, 0.022186631f, 0.0273747627f, 0.000389296144f, -0.0443251661f, -0.0613409871f, -0.00701650299f, 0.117938707f, 0.25551713f, 0.325453183f, 0.283887846f, 0.157078913f, 0.0211195713f, -0.0547987454f, -0.0538451047f, -0.0113746591f, 0.0233669116f, 0.0261743489f, 0.00686598195f, -0.0106945708f, -0.012916689f, -0.00389272998f, 0.00458424209f, 0.00584128352f, 0.00192498149f, -0.00169866101f, -0.00223963912f, -0.000769226769f, 0.000493203012f, 0.000647479229f, 0.000214030753f, -9.00702181e-05f, -0.000100780988f, -2.23419628e-05f},
+        {-7.8480975e-05f, -0.000116143033f, 9.92380973e-05f, 0.000549800125f, 0.000641066473f, -0.000329153924f, -0.00193447223f, -0.00216486881f, 0.000700393057f, 0.00504772718f, 0.00569969287f, -0.0010558428f, -0.0110713288f, -0.0129471721f, 0.000953800005f, 0.0220777978f, 0.0274376445f, 0.000647815529f, -0.0440757492f, -0.061426289f, -0.00760825015f, 0.117034784f, 0.254790808f, 0.325351328f, 0.28447543f, 0.157988499f, 0.0218331708f, -0.0545778655f, -0.0540339854f, -0.0116601411f, 0.023243347f, 0.0262489197f, 0.00700460622f, -0.0106282158f, -0.012949128f, -0.00395905118f, 0.00455172682f, 0.00585498527f, 0.00195371286f, -0.00168502005f, -0.00224493326f, -0.000779675846f, 0.00048876514f, 0.000649250121f, 0.000216839404f, -8.92047117e-05f, -0.000101237482f, -2.27080451e-05f},
+        {-7.79432322e-05f, -0.000116479269f, 9.68612182e-05f, 0.000547209987f, 0.000643373933f, -0.000319736832f, -0.00192611601f, -0.00217243366f, 0.000673849415f, 0.00502587028f, 0.00571785331f, -0.000994104618f, -0.0110209587f, -0.0129831267f, 0.000825481795f, 0.0219683297f, 0.0274991594f, 0.000905516044f, -0.043825264f, -0.0615086528f, -0.00819701955f, 0.116131459f, 0.254061731f, 0.325244865f, 0.285059487f, 0.158897735f, 0.0225492972f, -0.0543537901f, -0.0542211862f, -0.0119460116f, 0.0231184109f, 0.0263225735f, 0.00714333563f, -0.0105611962f, -0.0129810989f, -0.00402541265f, 0.00451889709f, 0.00586847233f, 0.00198246584f, -0.00167124429f, -0.00225014478f, -0.000790138178f, 0.000484278722f, 0.000650997522f, 0.000219655289f, -8.83264271e-05f, -0.000101690831f, -2.30769088e-05f},
+        {-7.74049257e-05f, -0.000116804931f, 9.44958824e-05f, 0.000544606861f, 0.000645636058f, -0.000310351265f, -0.00191770658f, -0.00217986561f, 0.000647379062f, 0.00500386683f, 0.00573569567f, -0.000932525244f, -0.0109702629f, -0.0130184059f, 0.00069750752f, 0.0218582331f, 0.0275593087f, 0.00116238938f, -0.0435737241f, -0.061588086f, -0.00878280346f, 0.115228752f, 0.253329918f, 0.325133796f, 0.285640004f, 0.159806599f, 0.0232679384f, -0.0541265155f, -0.0544066939f, -0.0122322597f, 0.0229921045f, 0.0263953046f, 0.00728216444f, -0.0104935131f, -0.0130125987f, -0.00409181154f, 0.00448575333f, 0.00588174334f, 0.00201123914f, -0.00165733385f, -0.00225527309f, -0.0008006133f, 0.000479743743f, 0.000652721201f, 0.000222478287f, -8.74353286e-05f, -0.000102140971f, -2.34485443e-05f},
+        {-7.68661048e-05f, -0.000117120078f, 9.21421567e-05f, 0.000541990967f, 0.000647852967f, -0.000300997551f, -0.00190924457f, -0.00218716483f, 0.000620982966f, 0.00498171838f, 0.00575322021f, -0.00087110694f, -0.0109192447f, -0.01305301f, 0.000569881759f, 0.0217475147f, 0.0276180938f, 0.00141842729f, -0.0433211434f, -0.0616645963f, -0.00936559427f, 0.114326685f, 0.252595389f, 0.325018125f, 0.286216964f, 0.160715069f, 0.023989082f, -0.053896038f, -0.0545904953f, -0.0125188748f, 0.0228644292f, 0.0264671069f, 0.00742108687f, -0.0104251674f, -0.0130436247f, -0.00415824496f, 0.00445229601f, 0.00589479689f, 0.0020400315f, -0.00164328884f, -0.00226031757f, -0.000811100741f, 0.000475160191f, 0.000654420928f, 0.000225308275f, -8.65313814e-05f, -0.000102587841f, -2.38229418e-05f},
+        {-7.63268184e-05f, -0.000117424768f, 8.98001069e-05f, 0.000539362528f, 0.000650024781f, -0.00029167601f, -0.00190073064f, -0.00219433153f, 0.000594662082f, 0.00495942648f, 0.0057704272f, -0.000809851953f, -0.0108679073f, -0.0130869395f, 0.000442609062f, 0.0216361809f, 0.0276755162f, 0.00167362158f, -0.0430675355f, -0.0617381916f, -0.00994538445f, 0.113425276f, 0.251858162f, 0.324897854f, 0.286790353f, 0.161623123f, 0.0247127155f, -0.0536623541f, -0.0547725771f, -0.0128058459f, 0.0227353864f, 0.0265379749f, 0.00756009713f, -0.0103561603f, -0.0130741739f, -0.00422471004f, 0.00441852559f, 0.00590763163f, 0.00206884163f, -0.0016291094f, -0.00226527759f, -0.000821600031f, 0.000470528056f, 0.000656096474f, 0.000228145132f, -8.56145509e-05f, -0.000103031378f, -2.42000912e-05f},
+        {-7.57871152e-05f, -0.000117719059f, 8.74697976e-05f, 0.000536721763f, 0.000652151624f, -0.000282386962f, -0.00189216545f, -0.0022013659f, 0.000568417364f, 0.00493699268f, 0.00578731695f, -0.000748762515f, -0.0108162541f, -0.013120195f, 0.000315693948f, 0.0215242385f, 0.0277315776f, 0.00192796412f, -0.0428129141f, -0.0618088794f, -0.0105221666f, 0.112524547f, 0.251118255f, 0.324772987f, 0.287360155f, 0.162530741f, 0.0254388265f, -0.0534254603f, -0.0549529261f, -0.0130931622f, 0.0226049774f, 0.0266079026f, 0.00769918943f, -0.0102864926f, -0.0131042436f, -0.00429120389f, 0.00438444257f, 0.00592024618f, 0.00209766825f, -0.00161479567f, -0.00227015257f, -0.000832110695f, 0.000465847331f, 0.000657747607f, 0.000230988734f, -8.46848035e-05f, -0.000103471519f, -2.45799821e-05f},
+        {-7.52470433e-05f, -0.00011800301f, 8.51512925e-05f, 0.000534068893f, 0.000654233621f, -0.000273130721f, -0.00188354963f, -0.00220826816f, 0.000542249754f, 0.00491441852f, 0.00580388977f, -0.000687840844f, -0.0107642883f, -0.0131527771f, 0.000189140909f, 0.021411694f, 0.0277862794f, 0.00218144683f, -0.042557293f, -0.0618766679f, -0.0110959334f, 0.111624517f, 0.250375688f, 0.324643527f, 0.287926356f, 0.163437899f, 0.0261674023f, -0.0531853533f, -0.0551315291f, -0.0133808128f, 0.0224732039f, 0.0266768843f, 0.00783835793f, -0.0102161656f, -0.0131338309f, -0.0043577236f, 0.00435004745f, 0.00593263917f, 0.00212651006f, -0.00160034779f, -0.00227494188f, -0.000842632255f, 0.000461118012f, 0.000659374098f, 0.000233838954f, -8.37421061e-05f, -0.000103908202f, -2.49626035e-05f},
+        {-7.47066509e-05f, -0.000118276681f, 8.28446539e-05f, 0.000531404137f, 0.000656270898f, -0.000263907601f, -0.00187488383f, -0.0022150385f, 0.000516160188f, 0.00489170556f, 0.00582014597f, -0.000627089145f, -0.0107120133f, -0.0131846863f, 6.29544103e-05f, 0.021298554f, 0.0278396234f, 0.00243406169f, -0.0423006859f, -0.0619415649f, -0.0116666776f, 0.110725207f, 0.249630481f, 0.324509477f, 0.288488941f, 0.164344578f, 0.0268984303f, -0.0529420298f, -0.0553083731f, -0.0136687866f, 0.0223400672f, 0.0267449142f, 0.00797759678f, -0.0101451805f, -0.0131629331f, -0.00442426626f, 0.00431534076f, 0.00594480925f, 0.00215536577f, -0.00158576591f, -0.00227964492f, -0.000853164232f, 0.000456340097f, 0.000660975718f, 0.000236695666f, -8.27864262e-05f, -0.000104341363f, -2.53479444e-05f},
+        {-7.41659856e-05f, -0.000118540132f, 8.05499431e-05f, 0.000528727715f, 0.000658263584f, -0.000254717911f, -0.00186616872f, -0.00222167715f, 0.000490149597f, 0.00486885535f, 0.00583608589f, -0.000566509605f, -0.0106594322f, -0.0132159232f, -6.28611148e-05f, 0.0211848251f, 0.0278916112f, 0.00268580075f, -0.0420431065f, -0.0620035784f, -0.0122343922f, 0.109826636f, 0.248882652f, 0.324370842f, 0.289047895f, 0.165250754f, 0.0276318975f, -0.0526954867f, -0.0554834448f, -0.0139570728f, 0.0222055691f, 0.0268119868f, 0.00811690012f, -0.0100735382f, -0.0131915473f, -0.00449082894f, 0.00428032303f, 0.00595675508f, 0.00218423407f, -0.00157105019f, -0.00228426109f, -0.000863706144f, 0.000451513587f, 0.000662552236f, 0.000239558744f, -8.18177321e-05f, -0.000104770939f, -2.57359933e-05f},
+        {-7.36250945e-05f, -0.000118793421f, 7.82672204e-05f, 0.000526039844f, 0.00066021181f, -0.000245561957f, -0.00185740493f, -0.00222818434f, 0.000464218902f, 0.00484586945f, 0.00585170988f, -0.000506104399f, -0.0106065484f, -0.0132464884f, -0.00018830126f, 0.021070514f, 0.0279422447f, 0.0029366561f, -0.0417845685f, -0.0620627167f, -0.0127990702f, 0.108928825f, 0.248132219f, 0.324227625f, 0.289603202f, 0.166156407f, 0.0283677912f, -0.0524457208f, -0.0556567311f, -0.0142456601f, 0.0220697112f, 0.0268780962f, 0.00825626207f, -0.0100012401f, -0.0132196708f, -0.00455740872f, 0.00424499481f, 0.00596847529f, 0.00221311366f, -0.0015562008f, -0.00228878979f, -0.000874257505f, 0.000446638484f, 0.000664103425f, 0.000242428058f, -8.08359926e-05f, -0.000105196867f, -2.61267385e-05f},
+        {-7.30840248e-05f, -0.00011903661f, 7.59965448e-05f, 0.000523340744f, 0.000662115708f, -0.000236440041f, -0.00184859311f, -0.00223456029f, 0.000438369018f, 0.0048227494f, 0.0058670183f, -0.000445875686f, -0.0105533653f, -0.0132763827f, -0.00031336165f, 0.0209556272f, 0.0279915256f, 0.00318661991f, -0.0415250856f, -0.0621189877f, -0.0133607045f, 0.108031794f, 0.247379204f, 0.324079829f, 0.29015485f, 0.167061514f, 0.0291060983f, -0.0521927291f, -0.0558282191f, -0.0145345376f, 0.0219324952f, 0.0269432368f, 0.00839567671f, -0.00992828745f, -0.0132473008f, -0.00462400263f, 0.00420935668f, 0.00597996856f, 0.00224200321f, -0.00154121791f, -0.00229323041f, -0.000884817826f, 0.000441714796f, 0.000665629054f, 0.000245303479f, -7.98411772e-05f, -0.000105619082f, -2.65201677e-05f},
+        {-7.2542823e-05f, -0.000119269759f, 7.37379743e-05f, 0.000520630631f, 0.000663975412f, -0.000227352465f, -0.00183973391f, -0.00224080522f, 0.000412600851f, 0.00479949676f, 0.00588201154f, -0.000385825609f, -0.010499886f, -0.0133056067f, -0.000438037935f, 0.0208401715f, 0.0280394558f, 0.0034356844f, -0.0412646715f, -0.0621723999f, -0.0139192885f, 0.107135562f, 0.246623624f, 0.323927459f, 0.290702822f, 0.167966054f, 0.0298468058f, -0.0519365088f, -0.0559978955f, -0.014823694f, 0.021793923f, 0.0270074031f, 0.00853513812f, -0.00985468143f, -0.0132744346f, -0.00469060775f, 0.00417340923f, 0.00599123354f, 0.00227090142f, -0.00152610169f, -0.00229758236f, -0.000895386618f, 0.00043674253f, 0.000667128895f, 0.000248184876f, -7.88332561e-05f, -0.000106037522f, -2.69162686e-05f},
+        {-7.20015355e-05f, -0.000119492928f, 7.14915658e-05f, 0.000517909722f, 0.000665791057f, -0.000218299523f, -0.00183082798f, -0.0022469194f, 0.000386915304f, 0.00477611309f, 0.00589668997f, -0.000325956299f, -0.0104461139f, -0.0133341612f, -0.000562325799f, 0.0207241534f, 0.0280860372f, 0.00368384183f, -0.0410033399f, -0.0622229615f, -0.0144748154f, 0.10624015f, 0.2458655f, 0.323770518f, 0.291247106f, 0.168870006f, 0.0305899004f, -0.0516770571f, -0.0561657475f, -0.0151131181f, 0.0216539964f, 0.0270705893f, 0.00867464036f, -0.00978042336f, -0.0133010695f, -0.00475722109f, 0.00413715305f, 0.00600226892f, 0.00229980696f, -0.00151085235f, -0.00230184503f, -0.000905963388f, 0.000431721698f, 0.000668602719f, 0.000251072117f, -7.78122002e-05f, -0.000106452122f, -2.73150284e-05f},
+        {-7.14602081e-05f, -0.000119706178f, 6.92573751e-05f, 0.000515178234f, 0.000667562782f, -0.00020928151f, -0.00182187596f, -0.00225290305f, 0.000361313267f, 0.00475259995f, 0.00591105401f, -0.000266269869f, -0.0103920524f, -0.0133620468f, -0.000686220952f, 0.0206075796f, 0.0281312717f, 0.00393108456f, -0.0407411045f, -0.062270681f, -0.0150272787f, 0.105345577f, 0.24510485f, 0.323609012f, 0.291787686f, 0.169773347f, 0.031335369f, -0.0514143713f, -0.056331762f, -0.0154027988f, 0.0215127173f, 0.0271327899f, 0.00881417746f, -0.00970551458f, -0.0133272027f, -0.00482383968f, 0.00410058876f, 0.00601307336f, 0.00232871849f, -0.00149547007f, -0.00230601784f, -0.000916547639f, 0.000426652314f, 0.000670050298f, 0.000253965069f, -7.67779809e-05f, -0.000106862818f, -2.77164339e-05f},
+        {-7.09188865e-05f, -0.000119909572f, 6.70354568e-05f, 0.000512436383f, 0.000669290724f, -0.000200298715f, -0.00181287851f, -0.00225875643f, 0.000335795626f, 0.00472895889f, 0.00592510407f, -0.000206768418f, -0.0103377046f, -0.0133892644f, -0.000809719135f, 0.0204904567f, 0.0281751615f, 0.00417740497f, -0.040477979f, -0.0623155668f, -0.0155766719f, 0.104451862f, 0.244341694f, 0.323442943f, 0.292324548f, 0.170676055f, 0.0320831982f, -0.0511484487f, -0.056495926f, -0.0156927247f, 0.0213700878f, 0.0271939994f, 0.00895374345f, -0.00962995645f, -0.0133528315f, -0.00489046055f, 0.00406371701f, 0.00602364556f, 0.00235763468f, -0.00147995506f, -0.0023101002f, -0.000927138873f, 0.000421534394f, 0.000671471404f, 0.000256863597f, -7.57305706e-05f, -0.000107269545f, -2.81204717e-05f},
+        {-7.0377616e-05f, -0.00012010317f, 6.48258646e-05f, 0.000509684384f, 0.000670975026f, -0.000191351427f, -0.00180383626f, -0.00226447979f, 0.00031036326f, 0.00470519147f, 0.00593884058f, -0.00014745403f, -0.010283074f, -0.0134158148f, -0.000932816119f, 0.0203727915f, 0.0282177085f, 0.00442279552f, -0.0402139769f, -0.0623576274f, -0.0161229885f, 0.103559027f, 0.243576052f, 0.323272317f, 0.292857678f, 0.17157811f, 0.0328333746f, -0.0508792869f, -0.0566582266f, -0.0159828845f, 0.0212261098f, 0.0272542121f, 0.00909333232f, -0.00955375038f, -0.0133779532f, -0.0049570807f, 0.00402653843f, 0.00603398421f, 0.0023865542f, -0.00146430753f, -0.0023140915f, -0.000937736589f, 0.000416367959f, 0.000672865809f, 0.000259767567f, -7.46699422e-05f, -0.000107672239f, -2.8527128e-05f},
+        {-6.98364415e-05f, -0.000120287034f, 6.2628651e-05f, 0.000506922451f, 0.00067261583f, -0.000182439928f, -0.00179474987f, -0.0022700734f, 0.000285017038f, 0.00468129925f, 0.00595226399f, -8.83287738e-05f, -0.0102281638f, -0.0134416988f, -0.0010555077f, 0.0202545905f, 0.028258915f, 0.00466724873f, -0.0399491121f, -0.0623968714f, -0.0166662223f, 0.10266709f, 0.242807944f, 0.323097139f, 0.293387062f, 0.172479488f, 0.0335858846f, -0.0506068833f, -0.0568186509f, -0.0162732668f, 0.0210807855f, 0.0273134227f, 0.00923293805f, -0.00947689778f, -0.0134025653f, -0.00502369714f, 0.00398905371f, 0.00604408799f, 0.0024154757f, -0.00144852768f, -0.00231799117f, -0.000948340283f, 0.00041115303f, 0.000674233286f, 0.000262676841f, -7.35960692e-05f, -0.000108070836f, -2.89363885e-05f},
+        {-6.92954076e-05f, -0.000120461226f, 6.04438673e-05f, 0.000504150798f, 0.00067421328f, -0.000173564499f, -0.00178561997f, -0.00227553753f, 0.000259757825f, 0.00465728378f, 0.00596537474f, -2.93947032e-05f, -0.0101729774f, -0.0134669173f, -0.00117778972f, 0.0201358604f, 0.0282987829f, 0.00491075718f, -0.039683398f, -0.0624333076f, -0.0172063672f, 0.101776071f, 0.242037388f, 0.322917412f, 0.293912686f, 0.17338017f, 0.0343407147f, -0.0503312358f, -0.056977186f, -0.0165638602f, 0.020934117f, 0.0273716256f, 0.00937255461f, -0.00939940012f, -0.0134266649f, -0.00509030684f, 0.00395126352f, 0.00605395563f, 0.00244439782f, -0.00143261576f, -0.00232179862f, -0.000958949449f, 0.000405889632f, 0.000675573608f, 0.000265591283f, -7.2508926e-05f, -0.00010846527f, -2.9348239e-05f},
+        {-6.87545586e-05f, -0.000120625809f, 5.8271564e-05f, 0.000501369639f, 0.000675767522f, -0.000164725418f, -0.00177644722f, -0.00228087244f, 0.000234586475f, 0.00463314664f, 0.00597817331f, 2.93461438e-05f, -0.0101175181f, -0.0134914711f, -0.00129965802f, 0.020016608f, 0.0283373147f, 0.00515331349f, -0.0394168485f, -0.0624669447f, -0.017743417f, 0.10088599f, 0.241264404f, 0.322733142f, 0.294434537f, 0.174280132f, 0.035097851f, -0.050052342f, -0.057133819f, -0.0168546533f, 0.0207861066f, 0.0274288155f, 0.00951217594f, -0.0093212589f, -0.0134502495f, -0.00515690679f, 0.00391316857f, 0.00606358583f, 0.00247331922f, -0.00141657198f, -0.00232551326f, -0.000969563578f, 0.000400577793f, 0.000676886547f, 0.000268510754f, -7.14084876e-05f, -0.000108855476f, -2.97626644e-05f},
+        {-6.82139383e-05f, -0.000120780845f, 5.61117902e-05f, 0.000498579187f, 0.000677278703f, -0.000155922958f, -0.00176723226f, -0.00228607841f, 0.000209503837f, 0.00460888936f, 0.00599066018f, 8.78917442e-05f, -0.0100617892f, -0.0135153612f, -0.0014211085f, 0.0198968398f, 0.0283745125f, 0.00539491037f, -0.0391494771f, -0.0624977914f, -0.0182773657f, 0.0999968659f, 0.240489013f, 0.322544334f, 0.2949526f, 0.175179353f, 0.0358572799f, -0.0497701998f, -0.0572885372f, -0.0171456346f, 0.0206367566f, 0.0274849867f, 0.00965179598f, -0.00924247565f, -0.0134733165f, -0.00522349396f, 0.00387476957f, 0.0060729773f, 0.00250223854f, -0.00140039659f, -0.00232913452f, -0.00098018216f, 0.000395217543f, 0.000678171878f, 0.000271435113f, -7.02947297e-05f, -0.00010924139f, -3.01796497e-05f},
+        {-6.76735903e-05f, -0.000120926398f, 5.39645941e-05f, 0.000495779654f, 0.000678746973f, -0.000147157392f, -0.00175797573f, -0.00229115572f, 0.000184510752f, 0.00458451353f, 0.00600283585f, 0.000146240091f, -0.0100057941f, -0.0135385885f, -0.00154213709f, 0.0197765625f, 0.0284103786f, 0.00563554058f, -0.0388812974f, -0.0625258568f, -0.0188082076f, 0.0991087184f, 0.239711234f, 0.322350992f, 0.295466862f, 0.176077811f, 0.0366189874f, -0.0494848072f, -0.0574413276f, -0.0174367925f, 0.0204860693f, 0.0275401341f, 0.00979140864f, -0.00916305192f, -0.0134958632f, -0.00529006532f, 0.00383606726f, 0.00608212878f, 0.0025311544f, -0.00138408983f, -0.0023326618f, -0.000990804679f, 0.000389808915f, 0.000679429375f, 0.000274364221f, -6.91676289e-05f, -0.000109622946f, -3.05991793e-05f},
+        {-6.71335579e-05f, -0.000121062529f, 5.18300228e-05f, 0.000492971251f, 0.000680172483f, -0.000138428986f, -0.00174867827f, -0.00229610467f, 0.000159608054f, 0.00456002069f, 0.00601470082f, 0.000204389191f, -0.00994953597f, -0.013561154f, -0.00166273972f, 0.0196557828f, 0.0284449155f, 0.00587519692f, -0.0386123231f, -0.0625511497f, -0.0193359368f, 0.098221567f, 0.238931087f, 0.322153123f, 0.29597731f, 0.176975485f, 0.0373829596f, -0.0491961622f, -0.0575921777f, -0.0177281154f, 0.0203340472f, 0.0275942522f, 0.00993100781f, -0.00908298932f, -0.013517887f, -0.00535661782f, 0.00379706238f, 0.00609103899f, 0.00256006544f, -0.00136765197f, -0.00233609454f, -0.00100143062f, 0.000384351944f, 0.000680658812f, 0.000277297934f, -6.80271622e-05f, -0.000110000078f, -3.10212375e-05f},
+        {-6.65938838e-05f, -0.000121189302f, 4.97081223e-05f, 0.000490154189f, 0.000681555384f, -0.000129738006f, -0.00173934053f, -0.00230092554f, 0.000134796567f, 0.0045354124f, 0.00602625561f, 0.000262337068f, -0.00989301827f, -0.0135830586f, -0.00178291238f, 0.0195345075f, 0.0284781255f, 0.00611387228f, -0.0383425677f, -0.0625736791f, -0.0198605476f, 0.097335431f, 0.238148592f, 0.32195073f, 0.296483929f, 0.177872353f, 0.0381491825f, -0.048904263f, -0.0577410745f, -0.0180195918f, 0.0201806927f, 0.0276473356f, 0.0100705874f, -0.00900228946f, -0.0135393854f, -0.0054231484f, 0.00375775571f, 0.00609970667f, 0.00258897029f, -0.00135108325f, -0.00233943217f, -0.00101205947f, 0.00037884667f, 0.000681859963f, 0.00028023611f, -6.68733077e-05f, -0.000110372722f, -3.14458079e-05f},
+        {-6.60546106e-05f, -0.000121306782f, 4.75989375e-05f, 0.000487328678f, 0.000682895831f, -0.000121084713f, -0.00172996315f, -0.00230561864f, 0.000110077111f, 0.00451069023f, 0.00603750076f, 0.000320081762f, -0.00983624429f, -0.0136043034f, -0.00190265108f, 0.0194127431f, 0.0285100111f, 0.0063515596f, -0.0380720449f, -0.0625934542f, -0.0203820346f, 0.0964503297f, 0.237363768f, 0.32174382f, 0.296986707f, 0.178768393f, 0.0389176418f, -0.0486091078f, -0.0578880055f, -0.0183112099f, 0.0200260084f, 0.0276993792f, 0.0102101412f, -0.008920954f, -0.0135603557f, -0.005489654f, 0.00371814802f, 0.00610813057f, 0.00261786757f, -0.00133438395f, -0.0023426741f, -0.00102269069f, 0.000373293134f, 0.000683032603f, 0.000283178605f, -6.57060439e-05f, -0.000110740811f, -3.1872874e-05f},
+        {-6.55157804e-05f, -0.000121415031f, 4.55025123e-05f, 0.000484494928f, 0.000684193979f, -0.000112469365f, -0.00172054676f, -0.00231018426f, 8.54504963e-05f, 0.00448585573f, 0.00604843681f, 0.000377621326f, -0.00977921736f, -0.0136248895f, -0.00202195187f, 0.0192904963f, 0.0285405749f, 0.00658825187f, -0.0378007682f, -0.0626104841f, -0.0209003923f, 0.0955662824f, 0.236576636f, 0.321532398f, 0.29748563f, 0.179663584f, 0.0396883234f, -0.0483106951f, -0.0580329579f, -0.018602958f, 0.0198699968f, 0.0277503775f, 0.0103496631f, -0.00883898465f, -0.0135807955f, -0.00555613155f, 0.00367824012f, 0.00611630944f, 0.00264675589f, -0.00131755434f, -0.00234581977f, -0.00103332378f, 0.00036769138f, 0.00068417651f, 0.000286125273f, -6.45253502e-05f, -0.000111104279f, -3.2302419e-05f},
+        {-6.49774351e-05f, -0.000121514113f, 4.34188895e-05f, 0.000481653148f, 0.000685449986f, -0.000103892218f, -0.00171109201f, -0.00231462272f, 6.09175262e-05f, 0.00446091047f, 0.00605906433f, 0.000434953831f, -0.00972194083f, -0.0136448178f, -0.0021408108f, 0.0191677739f, 0.0285698194f, 0.00682394215f, -0.0375287512f, -0.062624778f, -0.0214156152f, 0.0946833083f, 0.235787216f, 0.321316469f, 0.297980685f, 0.180557902f, 0.0404612129f, -0.0480090231f, -0.0581759192f, -0.0188948245f, 0.0197126608f, 0.0278003254f, 0.0104891469f, -0.00875638313f, -0.0136007023f, -0.00562257797f, 0.00363803282f, 0.00612424205f, 0.00267563387f, -0.00130059471f, -0.00234886861f, -0.0010439582f, 0.000362041455f, 0.000685291457f, 0.000289075968f, -6.33312069e-05f, -0.000111463061f, -3.27344256e-05f},
+        {-6.44396161e-05f, -0.000121604093f, 4.13481108e-05f, 0.000478803545f, 0.000686664009f, -9.53535221e-05f, -0.00170159954f, -0.00231893433f, 3.64789965e-05f, 0.004435856f, 0.00606938388f, 0.000492077361f, -0.00966441802f, -0.0136640896f, -0.00225922399f, 0.0190445826f, 0.0285977471f, 0.00705862358f, -0.0372560075f, -0.0626363453f, -0.0219276982f, 0.0938014265f, 0.234995527f, 0.32109604f, 0.298471859f, 0.181451328f, 0.0412362959f, -0.0477040905f, -0.0583168766f, -0.0191867975f, 0.0195540029f, 0.0278492176f, 0.0106285865f, -0.00867315118f, -0.0136200734f, -0.00568899018f, 0.00359752696f, 0.00613192715f, 0.00270450011f, -0.00128350535f, -0.00235182006f, -0.00105459342f, 0.000356343408f, 0.000686377222f, 0.000292030543f, -6.21235948e-05f, -0.00011181709f, -3.31688762e-05f},
+        {-6.39023645e-05f, -0.000121685034f, 3.92902169e-05f, 0.000475946328f, 0.00068783621f, -8.68535275e-05f, -0.00169206998f, -0.00232311941f, 1.21356955e-05f, 0.00441069389f, 0.00607939604f, 0.00054899002f, -0.00960665227f, -0.0136827059f, -0.00237718757f, 0.0189209289f, 0.0286243609f, 0.00729228932f, -0.0369825505f, -0.0626451952f, -0.0224366361f, 0.0929206562f, 0.234201591f, 0.320871117f, 0.298959139f, 0.182343839f, 0.0420135581f, -0.0473958958f, -0.0584558178f, -0.0194788652f, 0.0193940259f, 0.027897049f, 0.0107679755f, -0.00858929062f, -0.0136389063f, -0.00575536506f, 0.00355672338f, 0.00613936353f, 0.00273335322f, -0.00126628656f, -0.00235467356f, -0.00106522891f, 0.000350597294f, 0.000687433582f, 0.000294988849f, -6.09024955e-05f, -0.0001121663f, -3.36057528e-05f},
+        {-6.3365721e-05f, -0.000121757003f, 3.72452475e-05f, 0.000473081703f, 0.000688966749f, -7.83924792e-05f, -0.00168250398f, -0.00232717828f, -1.21115962e-05f, 0.00438542568f, 0.00608910141f, 0.000605689922f, -0.00954864692f, -0.0137006679f, -0.00249469771f, 0.0187968197f, 0.0286496633f, 0.00752493262f, -0.0367083939f, -0.0626513372f, -0.022942424f, 0.0920410163f, 0.233405426f, 0.320641704f, 0.299442512f, 0.183235413f, 0.0427929847f, -0.0470844379f, -0.05859273f, -0.0197710157f, 0.0192327328f, 0.0279438143f, 0.010907308f, -0.00850480325f, -0.0136571988f, -0.00582169953f, 0.00351562295f, 0.00614654996f, 0.0027621918f, -0.00124893864f, -0.00235742853f, -0.00107586414f, 0.000344803166f, 0.000688460314f, 0.000297950736f, -5.96678915e-05f, -0.000112510625f, -3.40450372e-05f},
+        {-6.28297261e-05f, -0.000121820062f, 3.52132411e-05f, 0.000470209877f, 0.000690055789f, -6.99706196e-05f, -0.00167290217f, -0.00233111126f, -3.62621054e-05f, 0.00436005294f, 0.00609850061f, 0.000662175202f, -0.0094904053f, -0.0137179767f, -0.00261175059f, 0.0186722616f, 0.0286736571f, 0.00775654679f, -0.0364335512f, -0.0626547807f, -0.0234450567f, 0.0911625258f, 0.232607054f, 0.32040781f, 0.299921966f, 0.18412603f, 0.0435745611f, -0.0467697156f, -0.0587276009f, -0.0200632372f, 0.0190701265f, 0.0279895085f, 0.0110465774f, -0.00841969095f, -0.0136749481f, -0.00588799047f, 0.00347422655f, 0.00615348525f, 0.00279101443f, -0.0012314619f, -0.00236008444f, -0.00108649858f, 0.000338961083f, 0.000689457196f, 0.000300916054f, -5.8419766e-05f, -0.000112849998f, -3.44867107e-05f},
+        {-6.22944197e-05f, -0.000121874277f, 3.31942353e-05f, 0.000467331053f, 0.000691103495f, -6.15881878e-05f, -0.00166326518f, -0.0023349187f, -6.03150667e-05f, 0.00433457723f, 0.00610759425f, 0.000718444008f, -0.00943193075f, -0.0137346336f, -0.00272834244f, 0.0185472612f, 0.0286963452f, 0.0079871252f, -0.0361580358f, -0.0626555354f, -0.0239445296f, 0.0902852038f, 0.231806495f, 0.320169438f, 0.300397488f, 0.185015665f, 0.0443582726f, -0.0464517277f, -0.058860418f, -0.0203555177f, 0.0189062099f, 0.0280341265f, 0.0111857778f, -0.00833395559f, -0.0136921519f, -0.00595423475f, 0.00343253509f, 0.00616016817f, 0.00281981971f, -0.00121385668f, -0.00236264072f, -0.00109713168f, 0.000333071107f, 0.000690424007f, 0.000303884651f, -5.7158103e-05f, -0.000113184353f, -3.49307543e-05f},
+        {-6.17598416e-05f, -0.000121919713f, 3.11882664e-05f, 0.000464445438f, 0.000692110033f, -5.32454197e-05f, -0.00165359365f, -0.00233860093f, -8.42697221e-05f, 0.00430900011f, 0.00611638296f, 0.000774494504f, -0.0093732266f, -0.0137506398f, -0.00284446952f, 0.0184218254f, 0.0287177303f, 0.00821666127f, -0.0358818612f, -0.0626536108f, -0.0244408378f, 0.0894090689f, 0.231003768f, 0.319926597f, 0.300869065f, 0.1859043f, 0.0451441044f, -0.0461304734f, -0.0589911688f, -0.0206478452f, 0.0187409861f, 0.0280776633f, 0.0113249026f, -0.00824759911f, -0.0137088078f, -0.00602042926f, 0.00339054947f, 0.00616659755f, 0.00284860623f, -0.00119612329f, -0.00236509682f, -0.00110776291f, 0.000327133302f, 0.000691360525f, 0.000306856373f, -5.58828872e-05f, -0.000113513623f, -3.53771487e-05f},
+        {-6.12260311e-05f, -0.000121956435f, 2.919537e-05f, 0.000461553235f, 0.000693075571f, -4.4942548e-05f, -0.00164388821f, -0.00234215829f, -0.000108125321f, 0.00428332312f, 0.00612486738f, 0.000830324871f, -0.0093142962f, -0.0137659965f, -0.00296012812f, 0.0182959607f, 0.0287378155f, 0.00844514848f, -0.0356050409f, -0.0626490166f, -0.0249339768f, 0.0885341401f, 0.230198895f, 0.319679293f, 0.301336684f, 0.186791911f, 0.0459320416f, -0.0458059516f, -0.059119841f, -0.0209402077f, 0.0185744583f, 0.0281201137f, 0.0114639458f, -0.00816062346f, -0.0137249134f, -0.00608657086f, 0.00334827063f, 0.00617277219f, 0.00287737257f, -0.00117826207f, -0.0023674522f, -0.00111839172f, 0.000321147734f, 0.00069226653f, 0.000309831068f, -5.45941041e-05f, -0.000113837742f, -3.58258741e-05f},
+        {-6.06930271e-05f, -0.000121984509f, 2.72155804e-05f, 0.000458654647f, 0.000694000276f, -3.66798022e-05f, -0.00163414951f, -0.00234559114f, -0.000131881122f, 0.00425754783f, 0.00613304819f, 0.000885933304f, -0.00925514289f, -0.013780705f, -0.00307531456f, 0.0181696739f, 0.0287566035f, 0.0086725804f, -0.0353275884f, -0.0626417625f, -0.025423942f, 0.087660436f, 0.229391895f, 0.319427532f, 0.301800334f, 0.187678476f, 0.0467220691f, -0.0454781618f, -0.0592464222f, -0.0212325932f, 0.0184066294f, 0.0281614727f, 0.011602901f, -0.00807303064f, -0.0137404662f, -0.00615265641f, 0.00330569951f, 0.00617869092f, 0.00290611729f, -0.00116027336f, -0.0023697063f, -0.00112901757f, 0.000315114473f, 0.000693141803f, 0.00031280858f, -5.32917401e-05f, -0.000114156642f, -3.62769105e-05f},
+        {-6.01608682e-05f, -0.000122004f, 2.5248931e-05f, 0.000455749876f, 0.00069488432f, -2.84574088e-05f, -0.00162437815f, -0.00234889982f, -0.000155536388f, 0.00423167578f, 0.00614092603f, 0.000941318016f, -0.00919577f, -0.0137947667f, -0.00319002519f, 0.0180429716f, 0.0287740975f, 0.00889895064f, -0.0350495171f, -0.0626318584f, -0.0259107291f, 0.0867879754f, 0.228582789f, 0.31917132f, 0.302260002f, 0.188563975f, 0.0475141718f, -0.0451471031f, -0.0593709001f, -0.0215249895f, 0.0182375029f, 0.0282017355f, 0.0117417619f, -0.00798482265f, -0.0137554639f, -0.00621868275f, 0.00326283709f, 0.00618435256f, 0.00293483899f, -0.00114215752f, -0.00237185858f, -0.00113963991f, 0.000309033593f, 0.000693986123f, 0.000315788753f, -5.19757823e-05f, -0.000114470256f, -3.67302375e-05f},
+        {-5.96295927e-05f, -0.000122014973f, 2.32954541e-05f, 0.000452839124f, 0.000695727873f, -2.0275591e-05f, -0.00161457479f, -0.00235208469f, -0.000179090393f, 0.00420570855f, 0.0061485016f, 0.000996477236f, -0.00913618086f, -0.0138081828f, -0.00330425638f, 0.0179158606f, 0.0287903004f, 0.00912425286f, -0.0347708404f, -0.062619314f, -0.0263943336f, 0.0859167768f, 0.227771598f, 0.318910665f, 0.302715676f, 0.189448385f, 0.0483083347f, -0.0448127751f, -0.0594932624f, -0.0218173846f, 0.018067082f, 0.0282408971f, 0.0118805221f, -0.00789600157f, -0.013769904f, -0.00628464673f, 0.00321968434f, 0.00618975596f, 0.00296353622f, -0.00112391491f, -0.00237390851f, -0.0011502582f, 0.000302905168f, 0.000694799272f, 0.000318771429f, -5.06462187e-05f, -0.000114778518f, -3.71858342e-05f},
+        {-5.90992385e-05f, -0.000122017496f, 2.13551811e-05f, 0.000449922592f, 0.00069653111f, -1.21345686e-05f, -0.00160474005f, -0.00235514612f, -0.000202542417f, 0.00417964766f, 0.00615577559f, 0.00105140921f, -0.00907637883f, -0.0138209547f, -0.00341800456f, 0.0177883475f, 0.0288052154f, 0.00934848081f, -0.0344915717f, -0.0626041394f, -0.0268747514f, 0.0850468589f, 0.226958342f, 0.318645574f, 0.303167344f, 0.190331685f, 0.0491045425f, -0.0444751771f, -0.0596134969f, -0.0221097663f, 0.0178953701f, 0.0282789525f, 0.0120191754f, -0.00780656948f, -0.0137837844f, -0.0063505452f, 0.00317624226f, 0.00619489995f, 0.00299220755f, -0.00110554589f, -0.00237585554f, -0.00116087187f, 0.000296729277f, 0.000695581033f, 0.000321756452f, -4.9303038e-05f, -0.00011508136f, -3.76436796e-05f},
+        {-5.8569843e-05f, -0.000122011633f, 1.94281422e-05f, 0.00044700048f, 0.000697294203f, -4.03455853e-06f, -0.00159487455f, -0.00235808447f, -0.000225891748f, 0.00415349469f, 0.00616274869f, 0.00110611219f, -0.00901636722f, -0.0138330838f, -0.00353126617f, 0.0176604391f, 0.0288188455f, 0.00957162829f, -0.0342117245f, -0.0625863445f, -0.0273519784f, 0.0841782401f, 0.226143042f, 0.318376054f, 0.303614993f, 0.191213853f, 0.0499027799f, -0.0441343089f, -0.0597315914f, -0.0224021223f, 0.0177223705f, 0.028315897f, 0.0121577153f, -0.00771652849f, -0.0137971026f, -0.00641637497f, 0.00313251187f, 0.00619978339f, 0.00302085154f, -0.00108705084f, -0.00237769914f, -0.00117148038f, 0.000290506002f, 0.000696331187f, 0.000324743661f, -4.79462298e-05f, -0.000115378716f, -3.81037521e-05f},
+        {-5.80414435e-05f, -0.000121997451f, 1.75143667e-05f, 0.000444072987f, 0.000698017328f, 4.02422558e-06f, -0.00158497892f, -0.00236090011f, -0.000249137681f, 0.00412725117f, 0.00616942164f, 0.00116058446f, -0.00895614939f, -0.0138445715f, -0.00364403768f, 0.0175321419f, 0.0288311939f, 0.00979368916f, -0.033931312f, -0.0625659394f, -0.0278260106f, 0.0833109389f, 0.225325718f, 0.318102112f, 0.304058613f, 0.192094868f, 0.0507030314f, -0.0437901702f, -0.0598475338f, -0.0226944405f, 0.0175480869f, 0.0283517256f, 0.0122961356f, -0.00762588078f, -0.0138098563f, -0.00648213287f, 0.0030884942f, 0.00620440515f, 0.00304946675f, -0.00106843013f, -0.00237943879f, -0.00118208316f, 0.000284235427f, 0.000697049517f, 0.000327732897f, -4.65757844e-05f, -0.000115670517f, -3.856603e-05f},
+        {-5.75140767e-05f, -0.000121975016f, 1.56138827e-05f, 0.000441140312f, 0.000698700663f, 1.20415733e-05f, -0.0015750538f, -0.00236359341f, -0.000272279519f, 0.00410091866f, 0.00617579514f, 0.00121482431f, -0.00889572866f, -0.0138554191f, -0.0037563156f, 0.0174034627f, 0.0288422639f, 0.0100146573f, -0.0336503477f, -0.0625429341f, -0.028296844f, 0.0824449736f, 0.22450639f, 0.317823754f, 0.304498191f, 0.192974708f, 0.0515052816f, -0.0434427607f, -0.0599613118f, -0.0229867086f, 0.0173725227f, 0.0283864337f, 0.0124344299f, -0.00753462853f, -0.0138220433f, -0.00654781573f, 0.0030441903f, 0.00620876409f, 0.00307805173f, -0.00104968416f, -0.00238107394f, -0.00119267967f, 0.000277917639f, 0.000697735808f, 0.000330723997f, -4.5191693e-05f, -0.000115956697f, -3.90304909e-05f},
+        {-5.69877791e-05f, -0.000121944394f, 1.37267176e-05f, 0.000438202653f, 0.000699344385f, 2.00172773e-05f, -0.00156509979f, -0.00236616477f, -0.000295316573f, 0.0040744987f, 0.00618186995f, 0.00126883004f, -0.00883510837f, -0.0138656283f, -0.00386809648f, 0.0172744082f, 0.0288520587f, 0.0102345268f, -0.0333688448f, -0.0625173388f, -0.028764475f, 0.0815803626f, 0.223685081f, 0.31754099f, 0.304933716f, 0.19385335f, 0.0523095149f, -0.0430920805f, -0.0600729135f, -0.0232789143f, 0.0171956815f, 0.0284200163f, 0.0125725917f, -0.00744277395f, -0.0138336612f, -0.00661342034f, 0.00299960123f, 0.0062128591f, 0.00310660504f, -0.00103081332f, -0.00238260408f, -0.00120326934f, 0.000271552729f, 0.000698389844f, 0.0003337168f, -4.37939477e-05f, -0.000116237188f, -3.94971123e-05f},
+        {-5.64625867e-05f, -0.000121905652f, 1.18528976e-05f, 0.000435260205f, 0.000699948675f, 2.79511334e-05f, -0.00155511754f, -0.00236861456f, -0.000318248162f, 0.00404799285f, 0.00618764682f, 0.00132259999f, -0.00877429185f, -0.0138752004f, -0.00397937687f, 0.017144985f, 0.0288605816f, 0.0104532916f, -0.0330868167f, -0.0624891637f, -0.0292288997f, 0.0807171241f, 0.222861809f, 0.317253826f, 0.305365177f, 0.194730775f, 0.0531157156f, -0.0427381294f, -0.0601823269f, -0.0235710452f, 0.0170175671f, 0.0284524688f, 0.0127106147f, -0.00735031931f, -0.0138447079f, -0.00667894352f, 0.00295472808f, 0.00621668906f, 0.00313512521f, -0.00101181802f, -0.00238402868f, -0.00121385161f, 0.00026514079f, 0.000699011409f, 0.000336711143f, -4.23825414e-05f, -0.000116511923f, -3.99658713e-05f},
+        {-5.59385353e-05f, -0.000121858857f, 9.99244781e-06f, 0.000432313165f, 0.000700513712f, 3.58429408e-05f, -0.00154510766f, -0.00237094317f, -0.000341073612f, 0.00402140264f, 0.00619312649f, 0.00137613249f, -0.00871328243f, -0.0138841369f, -0.0040901534f, 0.0170151998f, 0.028867836f, 0.0106709459f, -0.0328042767f, -0.0624584192f, -0.0296901146f, 0.0798552763f, 0.222036596f, 0.316962269f, 0.30579256f, 0.195606959f, 0.0539238681f, -0.0423809077f, -0.0602895398f, -0.0238630889f, 0.0168381831f, 0.0284837865f, 0.0128484924f, -0.00725726688f, -0.013855181f, -0.00674438206f, 0.00290957193f, 0.00622025286f, 0.00316361079f, -0.000992698664f, -0.00238534722f, -0.00122442592f, 0.000258681918f, 0.000699600291f, 0.00033970686f, -4.09574678e-05f, -0.000116780834f, -4.04367446e-05f},
+        {-5.54156602e-05f, -0.000121804075f, 8.14539254e-06f, 0.00042936173f, 0.000701039679f, 4.36925016e-05f, -0.00153507077f, -0.002373151f, -0.000363792257f, 0.00399472963f, 0.00619830976f, 0.00142942591f, -0.00865208344f, -0.0138924394f, -0.00420042269f, 0.0168850593f, 0.0288738253f, 0.0108874838f, -0.032521238f, -0.0624251155f, -0.0301481162f, 0.0789948373f, 0.221209464f, 0.316666328f, 0.306215857f, 0.196481882f, 0.0547339565f, -0.0420204156f, -0.0603945404f, -0.0241550332f, 0.0166575334f, 0.0285139647f, 0.0129862185f, -0.007163619f, -0.0138650785f, -0.00680973276f, 0.00286413392f, 0.00622354942f, 0.00319206032f, -0.000973455681f, -0.00238655919f, -0.00123499169f, 0.000252176212f, 0.000700156275f, 0.000342703787f, -3.95187214e-05f, -0.000117043853f, -4.09097085e-05f},
+        {-5.48939964e-05f, -0.000121741373f, 6.31175498e-06f, 0.000426406091f, 0.000701526759f, 5.14996212e-05f, -0.00152500749f, -0.00237523844f, -0.000386403438f, 0.00396797534f, 0.00620319739f, 0.00148247861f, -0.00859069822f, -0.0139001093f, -0.0043101814f, 0.0167545702f, 0.0288785529f, 0.0111028996f, -0.0322377139f, -0.0623892631f, -0.0306029012f, 0.0781358252f, 0.220380431f, 0.316366011f, 0.306635054f, 0.197355521f, 0.0555459649f, -0.0416566533f, -0.0604973168f, -0.0244468654f, 0.0164756218f, 0.0285429988f, 0.0131237865f, -0.00706937801f, -0.013874398f, -0.00687499239f, 0.00281841516f, 0.00622657765f, 0.00322047233f, -0.000954089494f, -0.00238766408f, -0.00124554836f, 0.000245623774f, 0.000700679149f, 0.000345701757f, -3.80662976e-05f, -0.000117300914f, -4.1384739e-05f},
+        {-5.43735785e-05f, -0.000121670818f, 4.49155735e-06f, 0.000423446445f, 0.000701975137f, 5.92641081e-05f, -0.00151491844f, -0.00237720591f, -0.000408906505f, 0.00394114134f, 0.0062077902f, 0.00153528898f, -0.00852913008f, -0.0139071484f, -0.00441942625f, 0.016623739f, 0.0288820222f, 0.0113171875f, -0.0319537176f, -0.0623508724f, -0.0310544662f, 0.0772782579f, 0.219549521f, 0.316061325f, 0.307050142f, 0.198227856f, 0.0563598775f, -0.0412896214f, -0.060597857f, -0.0247385733f, 0.0162924523f, 0.0285708842f, 0.0132611899f, -0.00697454631f, -0.0138831374f, -0.00694015775f, 0.00277241681f, 0.00622933647f, 0.00324884535f, -0.000934600539f, -0.00238866137f, -0.00125609536f, 0.00023902471f, 0.000701168701f, 0.000348700603f, -3.66001928e-05f, -0.000117551947f, -4.18618118e-05f},
+        {-5.38544407e-05f, -0.000121592478f, 2.68482091e-06f, 0.000420482982f, 0.000702384997f, 6.6985774e-05f, -0.00150480424f, -0.0023790538f, -0.000431300814f, 0.00391422914f, 0.00621208898f, 0.00158785543f, -0.00846738236f, -0.0139135581f, -0.00452815396f, 0.0164925725f, 0.0288842369f, 0.011530342f, -0.0316692624f, -0.0623099539f, -0.031502808f, 0.0764221535f, 0.218716752f, 0.315752278f, 0.307461108f, 0.199098864f, 0.057175678f, -0.0409193202f, -0.0606961494f, -0.0250301441f, 0.0161080289f, 0.0285976164f, 0.0133984223f, -0.00687912631f, -0.0138912946f, -0.0070052256f, 0.00272614003f, 0.00623182481f, 0.00327717792f, -0.000914989257f, -0.00238955056f, -0.00126663211f, 0.000232379128f, 0.000701624719f, 0.000351700156f, -3.5120404e-05f, -0.000117796886f, -4.2340902e-05f},
+        {-5.3336617e-05f, -0.000121506418f, 8.91565904e-07f, 0.000417515895f, 0.000702756528f, 7.46644338e-05f, -0.0014946655f, -0.00238078252f, -0.000453585731f, 0.0038872403f, 0.00621609455f, 0.00164017638f, -0.00840545837f, -0.0139193402f, -0.00463636129f, 0.0163610774f, 0.0288852004f, 0.0117423574f, -0.0313843614f, -0.0622665182f, -0.0319479237f, 0.0755675296f, 0.217882147f, 0.31543888f, 0.307867943f, 0.199968525f, 0.0579933505f, -0.0405457505f, -0.060792182f, -0.0253215655f, 0.0159223557f, 0.0286231907f, 0.0135354773f, -0.00678312047f, -0.0138988674f, -0.00707019272f, 0.00267958601f, 0.00623404161f, 0.00330546856f, -0.0008952561f, -0.00239033114f, -0.00127715805f, 0.000225687138f, 0.000702046994f, 0.000354700247f, -3.36269293e-05f, -0.000118035663f, -4.28219847e-05f},
+        {-5.28201408e-05f, -0.000121412707f, -8.88188393e-07f, 0.000414545375f, 0.000703089916f, 8.22999053e-05f, -0.00148450283f, -0.0023823925f, -0.000475760628f, 0.00386017634f, 0.00621980774f, 0.00169225027f, -0.00834336144f, -0.0139244961f, -0.00474404504f, 0.0162292602f, 0.0288849165f, 0.0119532283f, -0.0310990278f, -0.0622205759f, -0.0323898102f, 0.0747144042f, 0.217045726f, 0.315121137f, 0.308270635f, 0.200836817f, 0.0588128787f, -0.0401689129f, -0.0608859433f, -0.0256128248f, 0.0157354366f, 0.0286476028f, 0.0136723483f, -0.00668653126f, -0.0139058537f, -0.00713505586f, 0.00263275594f, 0.00623598582f, 0.00333371578f, -0.000875401524f, -0.00239100262f, -0.00128767259f, 0.000218948856f, 0.000702435316f, 0.000357700705f, -3.21197674e-05f, -0.00011826821f, -4.33050342e-05f},
+        {-5.23050454e-05f, -0.000121311412f, -2.65442368e-06f, 0.000411571613f, 0.000703385352f, 8.98920097e-05f, -0.00147431686f, -0.00238388415f, -0.000497824884f, 0.0038330388f, 0.0062232294f, 0.00174407555f, -0.00828109488f, -0.0139290277f, -0.00485120203f, 0.0160971276f, 0.0288833887f, 0.0121629491f, -0.0308132747f, -0.0621721377f, -0.0328284646f, 0.073862795f, 0.21620751f, 0.31479906f, 0.308669174f, 0.201703717f, 0.0596342463f, -0.0397888083f, -0.0609774214f, -0.0259039095f, 0.015547276f, 0.0286708482f, 0.0138090289f, -0.00658936122f, -0.0139122515f, -0.00719981179f, 0.00258565103f, 0.00623765641f, 0.00336191812f, -0.000855425997f, -0.0023915645f, -0.00129817515f, 0.000212164398f, 0.000702789475f, 0.000360701359f, -3.05989182e-05f, -0.000118494459f, -4.37900248e-05f},
+        {-5.17913634e-05f, -0.000121202599f, -4.40712263e-06f, 0.000408594796f, 0.000703643024f, 9.74405713e-05f, -0.00146410819f, -0.00238525789f, -0.000519777888f, 0.00380582921f, 0.00622636036f, 0.0017956507f, -0.00821866202f, -0.0139329365f, -0.00495782914f, 0.0159646863f, 0.0288806207f, 0.0123715146f, -0.0305271153f, -0.0621212143f, -0.0332638843f, 0.0730127195f, 0.215367521f, 0.314472655f, 0.309063549f, 0.202569205f, 0.060457437f, -0.0394054376f, -0.0610666047f, -0.0261948069f, 0.0153578781f, 0.0286929225f, 0.0139455125f, -0.00649161289f, -0.0139180585f, -0.00726445725f, 0.00253827252f, 0.00623905234f, 0.00339007407f, -0.00083532999f, -0.00239201629f, -0.00130866516f, 0.000205333884f, 0.000703109264f, 0.000363702037f, -2.90643823e-05f, -0.000118714343f, -4.42769303e-05f},
+        {-5.12791274e-05f, -0.000121086337f, -6.14626887e-06f, 0.000405615114f, 0.000703863126f, 0.000104945417f, -0.00145387743f, -0.00238651416f, -0.000541619035f, 0.0037785491f, 0.00622920149f, 0.0018469742f, -0.00815606615f, -0.0139362243f, -0.00506392324f, 0.0158319429f, 0.0288766163f, 0.0125789193f, -0.0302405626f, -0.0620678166f, -0.0336960665f, 0.0721641955f, 0.214525778f, 0.314141933f, 0.30945375f, 0.20343326f, 0.0612824344f, -0.0390188018f, -0.0611534817f, -0.0264855044f, 0.0151672472f, 0.0287138213f, 0.0140817927f, -0.00639328885f, -0.0139232728f, -0.00732898901f, 0.00249062166f, 0.00624017259f, 0.00341818216f, -0.000815113986f, -0.0023923575f, -0.00131914203f, 0.000198457437f, 0.000703394477f, 0.000366702564f, -2.75161612e-05f, -0.000118927793f, -4.47657241e-05f},
+        {-5.07683693e-05f, -0.000120962693f, -7.87184702e-06f, 0.000402632754f, 0.000704045849f, 0.000112406379f, -0.00144362518f, -0.00238765339f, -0.000563347728f, 0.0037512f, 0.00623175367f, 0.00189804456f, -0.0080933106f, -0.0139388928f, -0.00516948127f, 0.015698904f, 0.0288713793f, 0.012785158f, -0.0299536297f, -0.0620119553f, -0.0341250086f, 0.0713172404f, 0.213682305f, 0.313806901f, 0.309839766f, 0.204295859f, 0.0621092219f, -0.0386289021f, -0.0612380408f, -0.0267759892f, 0.0149753877f, 0.0287335403f, 0.0142178629f, -0.00629439173f, -0.0139278924f, -0.0073934038f, 0.00244269971f, 0.00624101615f, 0.00344624089f, -0.000794778473f, -0.00239258763f, -0.00132960518f, 0.000191535184f, 0.000703644906f, 0.000369702767f, -2.59542574e-05f, -0.000119134742f, -4.52563793e-05f},
+        {-5.0259121e-05f, -0.000120831735f, -9.58384262e-06f, 0.000399647903f, 0.000704191386f, 0.000119823288f, -0.00143335207f, -0.00238867601f, -0.000584963379f, 0.00372378343f, 0.00623401777f, 0.0019488603f, -0.00803039867f, -0.0139409439f, -0.00527450019f, 0.0155655762f, 0.0288649135f, 0.0129902256f, -0.0296663297f, -0.0619536413f, -0.0345507083f, 0.0704718716f, 0.21283712f, 0.313467568f, 0.310221587f, 0.205156982f, 0.062937783f, -0.0382357397f, -0.0613202705f, -0.0270662487f, 0.0147823039f, 0.0287520752f, 0.0143537166f, -0.00619492418f, -0.0139319152f, -0.00745769835f, 0.00239450794f, 0.006241582f, 0.00347424877f, -0.000774323947f, -0.00239270622f, -0.00134005402f, 0.000184567255f, 0.000703860346f, 0.00037270247f, -2.4378674e-05f, -0.000119335121f, -4.57488685e-05f},
+        {-4.97514136e-05f, -0.000120693529f, -1.12822422e-05f, 0.000396660747f, 0.000704299933f, 0.000127195984f, -0.00142305868f, -0.00238958246f, -0.000606465406f, 0.00369630091f, 0.00623599469f, 0.00199941995f, -0.00796733367f, -0.0139423792f, -0.00537897697f, 0.0154319662f, 0.0288572227f, 0.0131941168f, -0.0293786756f, -0.0618928857f, -0.0349731631f, 0.0696281066f, 0.211990246f, 0.313123945f, 0.310599203f, 0.206016607f, 0.063768101f, -0.0378393158f, -0.0614001594f, -0.02735627f, 0.0145880005f, 0.0287694216f, 0.0144893473f, -0.00609488887f, -0.0139353393f, -0.00752186941f, 0.00234604767f, 0.00624186917f, 0.0035022043f, -0.000753750913f, -0.00239271278f, -0.00135048796f, 0.000177553781f, 0.000704040593f, 0.000375701498f, -2.27894154e-05f, -0.000119528864f, -4.62431642e-05f},
+        {-4.92452782e-05f, -0.000120548144f, -1.29670332e-05f, 0.000393671469f, 0.000704371685f, 0.000134524304f, -0.00141274563f, -0.00239037319f, -0.000627853235f, 0.00366875397f, 0.00623768533f, 0.00204972207f, -0.00790411889f, -0.0139432005f, -0.00548290865f, 0.0152980805f, 0.0288483109f, 0.0133968267f, -0.0290906804f, -0.0618296994f, -0.0353923709f, 0.0687859626f, 0.211141704f, 0.312776039f, 0.310972604f, 0.206874713f, 0.0646001592f, -0.037439632f, -0.061477696f, -0.0276460405f, 0.014392482f, 0.0287855755f, 0.0146247484f, -0.00599428853f, -0.0139381626f, -0.0075859137f, 0.0022973202f, 0.00624187667f, 0.00353010598f, -0.000733059882f, -0.00239260683f, -0.00136090642f, 0.000170494898f, 0.000704185443f, 0.000378699672f, -2.11864866e-05f, -0.000119715902f, -4.67392383e-05f},
+        {-4.87407453e-05f, -0.000120395648f, -1.4638204e-05f, 0.000390680255f, 0.000704406839f, 0.000141808093f, -0.00140241352f, -0.00239104865f, -0.000649126301f, 0.00364114413f, 0.00623909061f, 0.00209976523f, -0.00784075764f, -0.0139434097f, -0.00558629228f, 0.0151639258f, 0.0288381819f, 0.0135983501f, -0.028802357f, -0.0617640934f, -0.0358083295f, 0.0679454569f, 0.210291515f, 0.31242386f, 0.31134178f, 0.207731277f, 0.0654339408f, -0.0370366898f, -0.0615528689f, -0.0279355473f, 0.0141957529f, 0.0288005326f, 0.0147599134f, -0.0058931259f, -0.0139403832f, -0.00764982795f, 0.00224832687f, 0.00624160352f, 0.00355795232f, -0.000712251375f, -0.00239238791f, -0.0013713088f, 0.000163390745f, 0.000704294694f, 0.000381696814f, -1.95698936e-05f, -0.000119896167f, -4.72370624e-05f},
+        {-4.82378452e-05f, -0.000120236108f, -1.6295744e-05f, 0.000387687286f, 0.000704405592f, 0.000149047196f, -0.00139206295f, -0.00239160928f, -0.000670284045f, 0.0036134729f, 0.00624021144f, 0.00214954801f, -0.0077772532f, -0.0139430086f, -0.00568912495f, 0.0150295087f, 0.0288268399f, 0.0137986822f, -0.0285137184f, -0.0616960789f, -0.0362210367f, 0.0671066067f, 0.2094397f, 0.312067418f, 0.311706721f, 0.20858628f, 0.066269429f, -0.0366304908f, -0.061625667f, -0.0282247775f, 0.0139978181f, 0.0288142888f, 0.0148948357f, -0.00579140377f, -0.0139419992f, -0.00771360888f, 0.00219906902f, 0.00624104876f, 0.00358574179f, -0.000691325917f, -0.00239205555f, -0.00138169451f, 0.000156241463f, 0.000704368144f, 0.000384692746f, -1.79396435e-05f, -0.000120069592f, -4.77366078e-05f},
+        {-4.77366078e-05f, -0.000120069592f, -1.79396435e-05f, 0.000384692746f, 0.000704368144f, 0.000156241463f, -0.00138169451f, -0.00239205555f, -0.000691325917f, 0.00358574179f, 0.00624104876f, 0.00219906902f, -0.00771360888f, -0.0139419992f, -0.00579140377f, 0.0148948357f, 0.0288142888f, 0.0139978181f, -0.0282247775f, -0.061625667f, -0.0366304908f, 0.066269429f, 0.20858628f, 0.311706721f, 0.312067418f, 0.2094397f, 0.0671066067f, -0.0362210367f, -0.0616960789f, -0.0285137184f, 0.0137986822f, 0.0288268399f, 0.0150295087f, -0.00568912495f, -0.0139430086f, -0.0077772532f, 0.00214954801f, 0.00624021144f, 0.0036134729f, -0.000670284045f, -0.00239160928f, -0.00139206295f, 0.000149047196f, 0.000704405592f, 0.000387687286f, -1.6295744e-05f, -0.000120236108f, -4.82378452e-05f},
+        {-4.72370624e-05f, -0.000119896167f, -1.95698936e-05f, 0.000381696814f, 0.000704294694f, 0.000163390745f, -0.0013713088f, -0.00239238791f, -0.000712251375f, 0.00355795232f, 0.00624160352f, 0.00224832687f, -0.00764982795f, -0.0139403832f, -0.0058931259f, 0.0147599134f, 0.0288005326f, 0.0141957529f, -0.0279355473f, -0.0615528689f, -0.0370366898f, 0.0654339408f, 0.207731277f, 0.31134178f, 0.31242386f, 0.210291515f, 0.0679454569f, -0.0358083295f, -0.0617640934f, -0.028802357f, 0.0135983501f, 0.0288381819f, 0.0151639258f, -0.00558629228f, -0.0139434097f, -0.00784075764f, 0.00209976523f, 0.00623909061f, 0.00364114413f, -0.000649126301f, -0.00239104865f, -0.00140241352f, 0.000141808093f, 0.000704406839f, 0.000390680255f, -1.4638204e-05f, -0.000120395648f, -4.87407453e-05f},
+        {-4.67392383e-05f, -0.000119715902f, -2.11864866e-05f, 0.000378699672f, 0.000704185443f, 0.000170494898f, -0.00136090642f, -0.00239260683f, -0.000733059882f, 0.00353010598f, 0.00624187667f, 0.0022973202f, -0.0075859137f, -0.0139381626f, -0.00599428853f, 0.0146247484f, 0.0287855755f, 0.014392482f, -0.0276460405f, -0.061477696f, -0.037439632f, 0.0646001592f, 0.206874713f, 0.310972604f, 0.312776039f, 0.211141704f, 0.0687859626f, -0.0353923709f, -0.0618296994f, -0.0290906804f, 0.0133968267f, 0.0288483109f, 0.0152980805f, -0.00548290865f, -0.0139432005f, -0.00790411889f, 0.00204972207f, 0.00623768533f, 0.00366875397f, -0.000627853235f, -0.00239037319f, -0.00141274563f, 0.000134524304f, 0.000704371685f, 0.000393671469f, -1.29670332e-05f, -0.000120548144f, -4.92452782e-05f},
+        {-4.62431642e-05f, -0.000119528864f, -2.27894154e-05f, 0.000375701498f, 0.000704040593f, 0.000177553781f, -0.00135048796f, -0.00239271278f, -0.000753750913f, 0.0035022043f, 0.00624186917f, 0.00234604767f, -0.00752186941f, -0.0139353393f, -0.00609488887f, 0.0144893473f, 0.0287694216f, 0.0145880005f, -0.02735627f, -0.0614001594f, -0.0378393158f, 0.063768101f, 0.206016607f, 0.310599203f, 0.313123945f, 0.211990246f, 0.0696281066f, -0.0349731631f, -0.0618928857f, -0.0293786756f, 0.0131941168f, 0.0288572227f, 0.0154319662f, -0.00537897697f, -0.0139423792f, -0.00796733367f, 0.00199941995f, 0.00623599469f, 0.00369630091f, -0.000606465406f, -0.00238958246f, -0.00142305868f, 0.000127195984f, 0.000704299933f, 0.000396660747f, -1.12822422e-05f, -0.000120693529f, -4.97514136e-05f},
+        {-4.57488685e-05f, -0.000119335121f, -2.4378674e-05f, 0.00037270247f, 0.000703860346f, 0.000184567255f, -0.00134005402f, -0.00239270622f, -0.000774323947f, 0.00347424877f, 0.006241582f, 0.00239450794f, -0.00745769835f, -0.0139319152f, -0.00619492418f, 0.0143537166f, 0.0287520752f, 0.0147823039f, -0.0270662487f, -0.0613202705f, -0.0382357397f, 0.062937783f, 0.205156982f, 0.310221587f, 0.313467568f, 0.21283712f, 0.0704718716f, -0.0345507083f, -0.0619536413f, -0.0296663297f, 0.0129902256f, 0.0288649135f, 0.0155655762f, -0.00527450019f, -0.0139409439f, -0.00803039867f, 0.0019488603f, 0.00623401777f, 0.00372378343f, -0.000584963379f, -0.00238867601f, -0.00143335207f, 0.000119823288f, 0.000704191386f, 0.000399647903f, -9.58384262e-06f, -0.000120831735f, -5.0259121e-05f},
+        {-4.52563793e-05f, -0.000119134742f, -2.59542574e-05f, 0.000369702767f, 0.000703644906f, 0.000191535184f, -0.00132960518f, -0.00239258763f, -0.000794778473f, 0.00344624089f, 0.00624101615f, 0.00244269971f, -0.0073934038f, -0.0139278924f, -0.00629439173f, 0.0142178629f, 0.0287335403f, 0.0149753877f, -0.0267759892f, -0.0612380408f, -0.0386289021f, 0.0621092219f, 0.204295859f, 0.309839766f, 0.313806901f, 0.213682305f, 0.0713172404f, -0.0341250086f, -0.0620119553f, -0.0299536297f, 0.012785158f, 0.0288713793f, 0.015698904f, -0.00516948127f, -0.0139388928f, -0.0080933106f, 0.00189804456f, 0.00623175367f, 0.0037512f, -0.000563347728f, -0.00238765339f, -0.00144362518f, 0.000112406379f, 0.000704045849f, 0.000402632754f, -7.87184702e-06f, -0.000120962693f, -5.07683693e-05f},
+        {-4.47657241e-05f, -0.000118927793f, -2.75161612e-05f, 0.000366702564f, 0.000703394477f, 0.000198457437f, -0.00131914203f, -0.0023923575f, -0.000815113986f, 0.00341818216f, 0.00624017259f, 0.00249062166f, -0.00732898901f, -0.0139232728f, -0.00639328885f, 0.0140817927f, 0.0287138213f, 0.0151672472f, -0.0264855044f, -0.0611534817f, -0.0390188018f, 0.0612824344f, 0.20343326f, 0.30945375f, 0.314141933f, 0.214525778f, 0.0721641955f, -0.0336960665f, -0.0620678166f, -0.0302405626f, 0.0125789193f, 0.0288766163f, 0.0158319429f, -0.00506392324f, -0.0139362243f, -0.00815606615f, 0.0018469742f, 0.00622920149f, 0.0037785491f, -0.000541619035f, -0.00238651416f, -0.00145387743f, 0.000104945417f, 0.000703863126f, 0.000405615114f, -6.14626887e-06f, -0.000121086337f, -5.12791274e-05f},
+        {-4.42769303e-05f, -0.000118714343f, -2.90643823e-05f, 0.000363702037f, 0.000703109264f, 0.000205333884f, -0.00130866516f, -0.00239201629f, -0.00083532999f, 0.00339007407f, 0.00623905234f, 0.00253827252f, -0.00726445725f, -0.0139180585f, -0.00649161289f, 0.0139455125f, 0.0286929225f, 0.0153578781f, -0.0261948069f, -0.0610666047f, -0.0394054376f, 0.060457437f, 0.202569205f, 0.309063549f, 0.314472655f, 0.215367521f, 0.0730127195f, -0.0332638843f, -0.0621212143f, -0.0305271153f, 0.0123715146f, 0.0288806207f, 0.0159646863f, -0.00495782914f, -0.0139329365f, -0.00821866202f, 0.0017956507f, 0.00622636036f, 0.00380582921f, -0.000519777888f, -0.00238525789f, -0.00146410819f, 9.74405713e-05f, 0.000703643024f, 0.000408594796f, -4.40712263e-06f, -0.000121202599f, -5.17913634e-05f},
+        {-4.37900248e-05f, -0.000118494459f, -3.05989182e-05f, 0.000360701359f, 0.000702789475f, 0.000212164398f, -0.00129817515f, -0.0023915645f, -0.000855425997f, 0.00336191812f, 0.00623765641f, 0.00258565103f, -0.00719981179f, -0.0139122515f, -0.00658936122f, 0.0138090289f, 0.0286708482f, 0.015547276f, -0.0259039095f, -0.0609774214f, -0.0397888083f, 0.0596342463f, 0.201703717f, 0.308669174f, 0.31479906f, 0.21620751f, 0.073862795f, -0.0328284646f, -0.0621721377f, -0.0308132747f, 0.0121629491f, 0.0288833887f, 0.0160971276f, -0.00485120203f, -0.0139290277f, -0.00828109488f, 0.00174407555f, 0.0062232294f, 0.0038330388f, -0.000497824884f, -0.00238388415f, -0.00147431686f, 8.98920097e-05f, 0.000703385352f, 0.000411571613f, -2.65442368e-06f, -0.000121311412f, -5.23050454e-05f},
+        {-4.33050342e-05f, -0.00011826821f, -3.21197674e-05f, 0.000357700705f, 0.000702435316f, 0.000218948856f, -0.00128767259f, -0.00239100262f, -0.000875401524f, 0.00333371578f, 0.00623598582f, 0.00263275594f, -0.00713505586f, -0.0139058537f, -0.00668653126f, 0.0136723483f, 0.0286476028f, 0.0157354366f, -0.0256128248f, -0.0608859433f, -0.0401689129f, 0.0588128787f, 0.200836817f, 0.308270635f, 0.315121137f, 0.217045726f, 0.0747144042f, -0.0323898102f, -0.0622205759f, -0.0310990278f, 0.0119532283f, 0.0288849165f, 0.0162292602f, -0.00474404504f, -0.0139244961f, -0.00834336144f, 0.00169225027f, 0.00621980774f, 0.00386017634f, -0.000475760628f, -0.0023823925f, -0.00148450283f, 8.22999053e-05f, 0.000703089916f, 0.000414545375f, -8.88188393e-07f, -0.000121412707f, -5.28201408e-05f},
+        {-4.28219847e-05f, -0.000118035663f, -3.36269293e-05f, 0.000354700247f, 0.000702046994f, 0.000225687138f, -0.00127715805f, -0.00239033114f, -0.0008952561f, 0.00330546856f, 0.00623404161f, 0.00267958601f, -0.00707019272f, -0.0138988674f, -0.00678312047f, 0.0135354773f, 0.0286231907f, 0.0159223557f, -0.0253215655f, -0.060792182f, -0.0405457505f, 0.0579933505f, 0.199968525f, 0.307867943f, 0.31543888f, 0.217882147f, 0.0755675296f, -0.0319479237f, -0.0622665182f, -0.0313843614f, 0.0117423574f, 0.0288852004f, 0.0163610774f, -0.00463636129f, -0.0139193402f, -0.00840545837f, 0.00164017638f, 0.00621609455f, 0.0038872403f, -0.000453585731f, -0.00238078252f, -0.0014946655f, 7.46644338e-05f, 0.000702756528f, 0.000417515895f, 8.91565904e-07f, -0.000121506418f, -5.3336617e-05f},
+        {-4.2340902e-05f, -0.000117796886f, -3.5120404e-05f, 0.000351700156f, 0.000701624719f, 0.000232379128f, -0.00126663211f, -0.00238955056f, -0.000914989257f, 0.00327717792f, 0.00623182481f, 0.00272614003f, -0.0070052256f, -0.0138912946f, -0.00687912631f, 0.0133984223f, 0.0285976164f, 0.0161080289f, -0.0250301441f, -0.0606961494f, -0.0409193202f, 0.057175678f, 0.199098864f, 0.307461108f, 0.315752278f, 0.218716752f, 0.0764221535f, -0.031502808f, -0.0623099539f, -0.0316692624f, 0.011530342f, 0.0288842369f, 0.0164925725f, -0.00452815396f, -0.0139135581f, -0.00846738236f, 0.00158785543f, 0.00621208898f, 0.00391422914f, -0.000431300814f, -0.0023790538f, -0.00150480424f, 6.6985774e-05f, 0.000702384997f, 0.000420482982f, 2.68482091e-06f, -0.000121592478f, -5.38544407e-05f},
+        {-4.18618118e-05f, -0.000117551947f, -3.66001928e-05f, 0.000348700603f, 0.000701168701f, 0.00023902471f, -0.00125609536f, -0.00238866137f, -0.000934600539f, 0.00324884535f, 0.00622933647f, 0.00277241681f, -0.00694015775f, -0.0138831374f, -0.00697454631f, 0.0132611899f, 0.0285708842f, 0.0162924523f, -0.0247385733f, -0.060597857f, -0.0412896214f, 0.0563598775f, 0.198227856f, 0.307050142f, 0.316061325f, 0.219549521f, 0.0772782579f, -0.0310544662f, -0.0623508724f, -0.0319537176f, 0.0113171875f, 0.0288820222f, 0.016623739f, -0.00441942625f, -0.0139071484f, -0.00852913008f, 0.00153528898f, 0.0062077902f, 0.00394114134f, -0.000408906505f, -0.00237720591f, -0.00151491844f, 5.92641081e-05f, 0.000701975137f, 0.000423446445f, 4.49155735e-06f, -0.000121670818f, -5.43735785e-05f},
+        {-4.1384739e-05f, -0.000117300914f, -3.80662976e-05f, 0.000345701757f, 0.000700679149f, 0.000245623774f, -0.00124554836f, -0.00238766408f, -0.000954089494f, 0.00322047233f, 0.00622657765f, 0.00281841516f, -0.00687499239f, -0.013874398f, -0.00706937801f, 0.0131237865f, 0.0285429988f, 0.0164756218f, -0.0244468654f, -0.0604973168f, -0.0416566533f, 0.0555459649f, 0.197355521f, 0.306635054f, 0.316366011f, 0.220380431f, 0.0781358252f, -0.0306029012f, -0.0623892631f, -0.0322377139f, 0.0111028996f, 0.0288785529f, 0.0167545702f, -0.0043101814f, -0.0139001093f, -0.00859069822f, 0.00148247861f, 0.00620319739f, 0.00396797534f, -0.000386403438f, -0.00237523844f, -0.00152500749f, 5.14996212e-05f, 0.000701526759f, 0.000426406091f, 6.31175498e-06f, -0.000121741373f, -5.48939964e-05f},
+        {-4.09097085e-05f, -0.000117043853f, -3.95187214e-05f, 0.000342703787f, 0.000700156275f, 0.000252176212f, -0.00123499169f, -0.00238655919f, -0.000973455681f, 0.00319206032f, 0.00622354942f, 0.00286413392f, -0.00680973276f, -0.0138650785f, -0.007163619f, 0.0129862185f, 0.0285139647f, 0.0166575334f, -0.0241550332f, -0.0603945404f, -0.0420204156f, 0.0547339565f, 0.196481882f, 0.306215857f, 0.316666328f, 0.221209464f, 0.0789948373f, -0.0301481162f, -0.0624251155f, -0.032521238f, 0.0108874838f, 0.0288738253f, 0.0168850593f, -0.00420042269f, -0.0138924394f, -0.00865208344f, 0.00142942591f, 0.00619830976f, 0.00399472963f, -0.000363792257f, -0.002373151f, -0.00153507077f, 4.36925016e-05f, 0.000701039679f, 0.00042936173f, 8.14539254e-06f, -0.000121804075f, -5.54156602e-05f},
+        {-4.04367446e-05f, -0.000116780834f, -4.09574678e-05f, 0.00033970686f, 0.000699600291f, 0.000258681918f, -0.00122442592f, -0.00238534722f, -0.000992698664f, 0.00316361079f, 0.00622025286f, 0.00290957193f, -0.00674438206f, -0.013855181f, -0.00725726688f, 0.0128484924f, 0.0284837865f, 0.0168381831f, -0.0238630889f, -0.0602895398f, -0.0423809077f, 0.0539238681f, 0.195606959f, 0.30579256f, 0.316962269f, 0.222036596f, 0.0798552763f, -0.0296901146f, -0.0624584192f, -0.0328042767f, 0.0106709459f, 0.028867836f, 0.0170151998f, -0.0040901534f, -0.0138841369f, -0.00871328243f, 0.00137613249f, 0.00619312649f, 0.00402140264f, -0.000341073612f, -0.00237094317f, -0.00154510766f, 3.58429408e-05f, 0.000700513712f, 0.000432313165f, 9.99244781e-06f, -0.000121858857f, -5.59385353e-05f},
+        {-3.99658713e-05f, -0.000116511923f, -4.23825414e-05f, 0.000336711143f, 0.000699011409f, 0.00026514079f, -0.00121385161f, -0.00238402868f, -0.00101181802f, 0.00313512521f, 0.00621668906f, 0.00295472808f, -0.00667894352f, -0.0138447079f, -0.00735031931f, 0.0127106147f, 0.0284524688f, 0.0170175671f, -0.0235710452f, -0.0601823269f, -0.0427381294f, 0.0531157156f, 0.194730775f, 0.305365177f, 0.317253826f, 0.222861809f, 0.0807171241f, -0.0292288997f, -0.0624891637f, -0.0330868167f, 0.0104532916f, 0.0288605816f, 0.017144985f, -0.00397937687f, -0.0138752004f, -0.00877429185f, 0.00132259999f, 0.00618764682f, 0.00404799285f, -0.000318248162f, -0.00236861456f, -0.00155511754f, 2.79511334e-05f, 0.000699948675f, 0.000435260205f, 1.18528976e-05f, -0.000121905652f, -5.64625867e-05f},
+        {-3.94971123e-05f, -0.000116237188f, -4.37939477e-05f, 0.0003337168f, 0.000698389844f, 0.000271552729f, -0.00120326934f, -0.00238260408f, -0.00103081332f, 0.00310660504f, 0.0062128591f, 0.00299960123f, -0.00661342034f, -0.0138336612f, -0.00744277395f, 0.0125725917f, 0.0284200163f, 0.0171956815f, -0.0232789143f, -0.0600729135f, -0.0430920805f, 0.0523095149f, 0.19385335f, 0.304933716f, 0.31754099f, 0.223685081f, 0.0815803626f, -0.028764475f, -0.0625173388f, -0.0333688448f, 0.0102345268f, 0.0288520587f, 0.0172744082f, -0.00386809648f, -0.0138656283f, -0.00883510837f, 0.00126883004f, 0.00618186995f, 0.0040744987f, -0.000295316573f, -0.00236616477f, -0.00156509979f, 2.00172773e-05f, 0.000699344385f, 0.000438202653f, 1.37267176e-05f, -0.000121944394f, -5.69877791e-05f},
+        {-3.90304909e-05f, -0.000115956697f, -4.5191693e-05f, 0.000330723997f, 0.000697735808f, 0.000277917639f, -0.00119267967f, -0.00238107394f, -0.00104968416f, 0.00307805173f, 0.00620876409f, 0.0030441903f, -0.00654781573f, -0.0138220433f, -0.00753462853f, 0.0124344299f, 0.0283864337f, 0.0173725227f, -0.0229867086f, -0.0599613118f, -0.0434427607f, 0.0515052816f, 0.192974708f, 0.304498191f, 0.317823754f, 0.22450639f, 0.0824449736f, -0.028296844f, -0.0625429341f, -0.0336503477f, 0.0100146573f, 0.0288422639f, 0.0174034627f, -0.0037563156f, -0.0138554191f, -0.00889572866f, 0.00121482431f, 0.00617579514f, 0.00410091866f, -0.000272279519f, -0.00236359341f, -0.0015750538f, 1.20415733e-05f, 0.000698700663f, 0.000441140312f, 1.56138827e-05f, -0.000121975016f, -5.75140767e-05f},
+        {-3.856603e-05f, -0.000115670517f, -4.65757844e-05f, 0.000327732897f, 0.000697049517f, 0.000284235427f, -0.00118208316f, -0.00237943879f, -0.00106843013f, 0.00304946675f, 0.00620440515f, 0.0030884942f, -0.00648213287f, -0.0138098563f, -0.00762588078f, 0.0122961356f, 0.0283517256f, 0.0175480869f, -0.0226944405f, -0.0598475338f, -0.0437901702f, 0.0507030314f, 0.192094868f, 0.304058613f, 0.318102112f, 0.225325718f, 0.0833109389f, -0.0278260106f, -0.0625659394f, -0.033931312f, 0.00979368916f, 0.0288311939f, 0.0175321419f, -0.00364403768f, -0.0138445715f, -0.00895614939f, 0.00116058446f, 0.00616942164f, 0.00412725117f, -0.000249137681f, -0.00236090011f, -0.00158497892f, 4.02422558e-06f, 0.000698017328f, 0.000444072987f, 1.75143667e-05f, -0.000121997451f, -5.80414435e-05f},
+        {-3.81037521e-05f, -0.000115378716f, -4.79462298e-05f, 0.000324743661f, 0.000696331187f, 0.000290506002f, -0.00117148038f, -0.00237769914f, -0.00108705084f, 0.00302085154f, 0.00619978339f, 0.00313251187f, -0.00641637497f, -0.0137971026f, -0.00771652849f, 0.0121577153f, 0.028315897f, 0.0177223705f, -0.0224021223f, -0.0597315914f, -0.0441343089f, 0.0499027799f, 0.191213853f, 0.303614993f, 0.318376054f, 0.226143042f, 0.0841782401f, -0.0273519784f, -0.0625863445f, -0.0342117245f, 0.00957162829f, 0.0288188455f, 0.0176604391f, -0.00353126617f, -0.0138330838f, -0.00901636722f, 0.00110611219f, 0.00616274869f, 0.00415349469f, -0.000225891748f, -0.00235808447f, -0.00159487455f, -4.03455853e-06f, 0.000697294203f, 0.00044700048f, 1.94281422e-05f, -0.000122011633f, -5.8569843e-05f},
+        {-3.76436796e-05f, -0.00011508136f, -4.9303038e-05f, 0.000321756452f, 0.000695581033f, 0.000296729277f, -0.00116087187f, -0.00237585554f, -0.00110554589f, 0.00299220755f, 0.00619489995f, 0.00317624226f, -0.0063505452f, -0.0137837844f, -0.00780656948f, 0.0120191754f, 0.0282789525f, 0.0178953701f, -0.0221097663f, -0.0596134969f, -0.0444751771f, 0.0491045425f, 0.190331685f, 0.303167344f, 0.318645574f, 0.226958342f, 0.0850468589f, -0.0268747514f, -0.0626041394f, -0.0344915717f, 0.00934848081f, 0.0288052154f, 0.0177883475f, -0.00341800456f, -0.0138209547f, -0.00907637883f, 0.00105140921f, 0.00615577559f, 0.00417964766f, -0.000202542417f, -0.00235514612f, -0.00160474005f, -1.21345686e-05f, 0.00069653111f, 0.000449922592f, 2.13551811e-05f, -0.000122017496f, -5.90992385e-05f},
+        {-3.71858342e-05f, -0.000114778518f, -5.06462187e-05f, 0.000318771429f, 0.000694799272f, 0.000302905168f, -0.0011502582f, -0.00237390851f, -0.00112391491f, 0.00296353622f, 0.00618975596f, 0.00321968434f, -0.00628464673f, -0.013769904f, -0.00789600157f, 0.0118805221f, 0.0282408971f, 0.018067082f, -0.0218173846f, -0.0594932624f, -0.0448127751f, 0.0483083347f, 0.189448385f, 0.302715676f, 0.318910665f, 0.227771598f, 0.0859167768f, -0.0263943336f, -0.062619314f, -0.0347708404f, 0.00912425286f, 0.0287903004f, 0.0179158606f, -0.00330425638f, -0.0138081828f, -0.00913618086f, 0.000996477236f, 0.0061485016f, 0.00420570855f, -0.000179090393f, -0.00235208469f, -0.00161457479f, -2.0275591e-05f, 0.000695727873f, 0.000452839124f, 2.32954541e-05f, -0.000122014973f, -5.96295927e-05f},
+        {-3.67302375e-05f, -0.000114470256f, -5.19757823e-05f, 0.000315788753f, 0.000693986123f, 0.000309033593f, -0.00113963991f, -0.00237185858f, -0.00114215752f, 0.00293483899f, 0.00618435256f, 0.00326283709f, -0.00621868275f, -0.0137554639f, -0.00798482265f, 0.0117417619f, 0.0282017355f, 0.0182375029f, -0.0215249895f, -0.0593709001f, -0.0451471031f, 0.0475141718f, 0.188563975f, 0.302260002f, 0.31917132f, 0.228582789f, 0.0867879754f, -0.0259107291f, -0.0626318584f, -0.0350495171f, 0.00889895064f, 0.0287740975f, 0.0180429716f, -0.00319002519f, -0.0137947667f, -0.00919577f, 0.000941318016f, 0.00614092603f, 0.00423167578f, -0.000155536388f, -0.00234889982f, -0.00162437815f, -2.84574088e-05f, 0.00069488432f, 0.000455749876f, 2.5248931e-05f, -0.000122004f, -6.01608682e-05f},
+        {-3.62769105e-05f, -0.000114156642f, -5.32917401e-05f, 0.00031280858f, 0.000693141803f, 0.000315114473f, -0.00112901757f, -0.0023697063f, -0.00116027336f, 0.00290611729f, 0.00617869092f, 0.00330569951f, -0.00615265641f, -0.0137404662f, -0.00807303064f, 0.011602901f, 0.0281614727f, 0.0184066294f, -0.0212325932f, -0.0592464222f, -0.0454781618f, 0.0467220691f, 0.187678476f, 0.301800334f, 0.319427532f, 0.229391895f, 0.087660436f, -0.025423942f, -0.0626417625f, -0.0353275884f, 0.0086725804f, 0.0287566035f, 0.0181696739f, -0.00307531456f, -0.013780705f, -0.00925514289f, 0.000885933304f, 0.00613304819f, 0.00425754783f, -0.000131881122f, -0.00234559114f, -0.00163414951f, -3.66798022e-05f, 0.000694000276f, 0.000458654647f, 2.72155804e-05f, -0.000121984509f, -6.06930271e-05f},
+        {-3.58258741e-05f, -0.000113837742f, -5.45941041e-05f, 0.000309831068f, 0.00069226653f, 0.000321147734f, -0.00111839172f, -0.0023674522f, -0.00117826207f, 0.00287737257f, 0.00617277219f, 0.00334827063f, -0.00608657086f, -0.0137249134f, -0.00816062346f, 0.0114639458f, 0.0281201137f, 0.0185744583f, -0.0209402077f, -0.059119841f, -0.0458059516f, 0.0459320416f, 0.186791911f, 0.301336684f, 0.319679293f, 0.230198895f, 0.0885341401f, -0.0249339768f, -0.0626490166f, -0.0356050409f, 0.00844514848f, 0.0287378155f, 0.0182959607f, -0.00296012812f, -0.0137659965f, -0.0093142962f, 0.000830324871f, 0.00612486738f, 0.00428332312f, -0.000108125321f, -0.00234215829f, -0.00164388821f, -4.4942548e-05f, 0.000693075571f, 0.000461553235f, 2.919537e-05f, -0.000121956435f, -6.12260311e-05f},
+        {-3.53771487e-05f, -0.000113513623f, -5.58828872e-05f, 0.000306856373f, 0.000691360525f, 0.000327133302f, -0.00110776291f, -0.00236509682f, -0.00119612329f, 0.00284860623f, 0.00616659755f, 0.00339054947f, -0.00602042926f, -0.0137088078f, -0.00824759911f, 0.0113249026f, 0.0280776633f, 0.0187409861f, -0.0206478452f, -0.0589911688f, -0.0461304734f, 0.0451441044f, 0.1859043f, 0.300869065f, 0.319926597f, 0.231003768f, 0.0894090689f, -0.0244408378f, -0.0626536108f, -0.0358818612f, 0.00821666127f, 0.0287177303f, 0.0184218254f, -0.00284446952f, -0.0137506398f, -0.0093732266f, 0.000774494504f, 0.00611638296f, 0.00430900011f, -8.42697221e-05f, -0.00233860093f, -0.00165359365f, -5.32454197e-05f, 0.000692110033f, 0.000464445438f, 3.11882664e-05f, -0.000121919713f, -6.17598416e-05f},
+        {-3.49307543e-05f, -0.000113184353f, -5.7158103e-05f, 0.000303884651f, 0.000690424007f, 0.000333071107f, -0.00109713168f, -0.00236264072f, -0.00121385668f, 0.00281981971f, 0.00616016817f, 0.00343253509f, -0.00595423475f, -0.0136921519f, -0.00833395559f, 0.0111857778f, 0.0280341265f, 0.0189062099f, -0.0203555177f, -0.058860418f, -0.0464517277f, 0.0443582726f, 0.185015665f, 0.300397488f, 0.320169438f, 0.231806495f, 0.0902852038f, -0.0239445296f, -0.0626555354f, -0.0361580358f, 0.0079871252f, 0.0286963452f, 0.0185472612f, -0.00272834244f, -0.0137346336f, -0.00943193075f, 0.000718444008f, 0.00610759425f, 0.00433457723f, -6.03150667e-05f, -0.0023349187f, -0.00166326518f, -6.15881878e-05f, 0.000691103495f, 0.000467331053f, 3.31942353e-05f, -0.000121874277f, -6.22944197e-05f},
+        {-3.44867107e-05f, -0.000112849998f, -5.8419766e-05f, 0.000300916054f, 0.000689457196f, 0.000338961083f, -0.00108649858f, -0.00236008444f, -0.0012314619f, 0.00279101443f, 0.00615348525f, 0.00347422655f, -0.00588799047f, -0.0136749481f, -0.00841969095f, 0.0110465774f, 0.0279895085f, 0.0190701265f, -0.0200632372f, -0.0587276009f, -0.0467697156f, 0.0435745611f, 0.18412603f, 0.299921966f, 0.32040781f, 0.232607054f, 0.0911625258f, -0.0234450567f, -0.0626547807f, -0.0364335512f, 0.00775654679f, 0.0286736571f, 0.0186722616f, -0.00261175059f, -0.0137179767f, -0.0094904053f, 0.000662175202f, 0.00609850061f, 0.00436005294f, -3.62621054e-05f, -0.00233111126f, -0.00167290217f, -6.99706196e-05f, 0.000690055789f, 0.000470209877f, 3.52132411e-05f, -0.000121820062f, -6.28297261e-05f},
+        {-3.40450372e-05f, -0.000112510625f, -5.96678915e-05f, 0.000297950736f, 0.000688460314f, 0.000344803166f, -0.00107586414f, -0.00235742853f, -0.00124893864f, 0.0027621918f, 0.00614654996f, 0.00351562295f, -0.00582169953f, -0.0136571988f, -0.00850480325f, 0.010907308f, 0.0279438143f, 0.0192327328f, -0.0197710157f, -0.05859273f, -0.0470844379f, 0.0427929847f, 0.183235413f, 0.299442512f, 0.320641704f, 0.233405426f, 0.0920410163f, -0.022942424f, -0.0626513372f, -0.0367083939f, 0.00752493262f, 0.0286496633f, 0.0187968197f, -0.00249469771f, -0.0137006679f, -0.00954864692f, 0.000605689922f, 0.00608910141f, 0.00438542568f, -1.21115962e-05f, -0.00232717828f, -0.00168250398f, -7.83924792e-05f, 0.000688966749f, 0.000473081703f, 3.72452475e-05f, -0.000121757003f, -6.3365721e-05f},
+        {-3.36057528e-05f, -0.0001121663f, -6.09024955e-05f, 0.000294988849f, 0.000687433582f, 0.000350597294f, -0.00106522891f, -0.00235467356f, -0.00126628656f, 0.00273335322f, 0.00613936353f, 0.00355672338f, -0.00575536506f, -0.0136389063f, -0.00858929062f, 0.0107679755f, 0.027897049f, 0.0193940259f, -0.0194788652f, -0.0584558178f, -0.0473958958f, 0.0420135581f, 0.182343839f, 0.298959139f, 0.320871117f, 0.234201591f, 0.0929206562f, -0.0224366361f, -0.0626451952f, -0.0369825505f, 0.00729228932f, 0.0286243609f, 0.0189209289f, -0.00237718757f, -0.0136827059f, -0.00960665227f, 0.00054899002f, 0.00607939604f, 0.00441069389f, 1.21356955e-05f, -0.00232311941f, -0.00169206998f, -8.68535275e-05f, 0.00068783621f, 0.000475946328f, 3.92902169e-05f, -0.000121685034f, -6.39023645e-05f},
+        {-3.31688762e-05f, -0.00011181709f, -6.21235948e-05f, 0.000292030543f, 0.000686377222f, 0.000356343408f, -0.00105459342f, -0.00235182006f, -0.00128350535f, 0.00270450011f, 0.00613192715f, 0.00359752696f, -0.00568899018f, -0.0136200734f, -0.00867315118f, 0.0106285865f, 0.0278492176f, 0.0195540029f, -0.0191867975f, -0.0583168766f, -0.0477040905f, 0.0412362959f, 0.181451328f, 0.298471859f, 0.32109604f, 0.234995527f, 0.0938014265f, -0.0219276982f, -0.0626363453f, -0.0372560075f, 0.00705862358f, 0.0285977471f, 0.0190445826f, -0.00225922399f, -0.0136640896f, -0.00966441802f, 0.000492077361f, 0.00606938388f, 0.004435856f, 3.64789965e-05f, -0.00231893433f, -0.00170159954f, -9.53535221e-05f, 0.000686664009f, 0.000478803545f, 4.13481108e-05f, -0.000121604093f, -6.44396161e-05f},
+        {-3.27344256e-05f, -0.000111463061f, -6.33312069e-05f, 0.000289075968f, 0.000685291457f, 0.000362041455f, -0.0010439582f, -0.00234886861f, -0.00130059471f, 0.00267563387f, 0.00612424205f, 0.00363803282f, -0.00562257797f, -0.0136007023f, -0.00875638313f, 0.0104891469f, 0.0278003254f, 0.0197126608f, -0.0188948245f, -0.0581759192f, -0.0480090231f, 0.0404612129f, 0.180557902f, 0.297980685f, 0.321316469f, 0.235787216f, 0.0946833083f, -0.0214156152f, -0.062624778f, -0.0375287512f, 0.00682394215f, 0.0285698194f, 0.0191677739f, -0.0021408108f, -0.0136448178f, -0.00972194083f, 0.000434953831f, 0.00605906433f, 0.00446091047f, 6.09175262e-05f, -0.00231462272f, -0.00171109201f, -0.000103892218f, 0.000685449986f, 0.000481653148f, 4.34188895e-05f, -0.000121514113f, -6.49774351e-05f},
+        {-3.2302419e-05f, -0.000111104279f, -6.45253502e-05f, 0.000286125273f, 0.00068417651f, 0.00036769138f, -0.00103332378f, -0.00234581977f, -0.00131755434f, 0.00264675589f, 0.00611630944f, 0.00367824012f, -0.00555613155f, -0.0135807955f, -0.00883898465f, 0.0103496631f, 0.0277503775f, 0.0198699968f, -0.018602958f, -0.0580329579f, -0.0483106951f, 0.0396883234f, 0.179663584f, 0.29748563f, 0.321532398f, 0.236576636f, 0.0955662824f, -0.0209003923f, -0.0626104841f, -0.0378007682f, 0.00658825187f, 0.0285405749f, 0.0192904963f, -0.00202195187f, -0.0136248895f, -0.00977921736f, 0.000377621326f, 0.00604843681f, 0.00448585573f, 8.54504963e-05f, -0.00231018426f, -0.00172054676f, -0.000112469365f, 0.000684193979f, 0.000484494928f, 4.55025123e-05f, -0.000121415031f, -6.55157804e-05f},
+        {-3.1872874e-05f, -0.000110740811f, -6.57060439e-05f, 0.000283178605f, 0.000683032603f, 0.000373293134f, -0.00102269069f, -0.0023426741f, -0.00133438395f, 0.00261786757f, 0.00610813057f, 0.00371814802f, -0.005489654f, -0.0135603557f, -0.008920954f, 0.0102101412f, 0.0276993792f, 0.0200260084f, -0.0183112099f, -0.0578880055f, -0.0486091078f, 0.0389176418f, 0.178768393f, 0.296986707f, 0.32174382f, 0.237363768f, 0.0964503297f, -0.0203820346f, -0.0625934542f, -0.0380720449f, 0.0063515596f, 0.0285100111f, 0.0194127431f, -0.00190265108f, -0.0136043034f, -0.00983624429f, 0.000320081762f, 0.00603750076f, 0.00451069023f, 0.000110077111f, -0.00230561864f, -0.00172996315f, -0.000121084713f, 0.000682895831f, 0.000487328678f, 4.75989375e-05f, -0.000121306782f, -6.60546106e-05f},
+        {-3.14458079e-05f, -0.000110372722f, -6.68733077e-05f, 0.00028023611f, 0.000681859963f, 0.00037884667f, -0.00101205947f, -0.00233943217f, -0.00135108325f, 0.00258897029f, 0.00609970667f, 0.00375775571f, -0.0054231484f, -0.0135393854f, -0.00900228946f, 0.0100705874f, 0.0276473356f, 0.0201806927f, -0.0180195918f, -0.0577410745f, -0.048904263f, 0.0381491825f, 0.177872353f, 0.296483929f, 0.32195073f, 0.238148592f, 0.097335431f, -0.0198605476f, -0.0625736791f, -0.0383425677f, 0.00611387228f, 0.0284781255f, 0.0195345075f, -0.00178291238f, -0.0135830586f, -0.00989301827f, 0.000262337068f, 0.00602625561f, 0.0045354124f, 0.000134796567f, -0.00230092554f, -0.00173934053f, -0.000129738006f, 0.000681555384f, 0.000490154189f, 4.97081223e-05f, -0.000121189302f, -6.65938838e-05f},
+        {-3.10212375e-05f, -0.000110000078f, -6.80271622e-05f, 0.000277297934f, 0.000680658812f, 0.000384351944f, -0.00100143062f, -0.00233609454f, -0.00136765197f, 0.00256006544f, 0.00609103899f, 0.00379706238f, -0.00535661782f, -0.013517887f, -0.00908298932f, 0.00993100781f, 0.0275942522f, 0.0203340472f, -0.0177281154f, -0.0575921777f, -0.0491961622f, 0.0373829596f, 0.176975485f, 0.29597731f, 0.322153123f, 0.238931087f, 0.098221567f, -0.0193359368f, -0.0625511497f, -0.0386123231f, 0.00587519692f, 0.0284449155f, 0.0196557828f, -0.00166273972f, -0.013561154f, -0.00994953597f, 0.000204389191f, 0.00601470082f, 0.00456002069f, 0.000159608054f, -0.00229610467f, -0.00174867827f, -0.000138428986f, 0.000680172483f, 0.000492971251f, 5.18300228e-05f, -0.000121062529f, -6.71335579e-05f},
+        {-3.05991793e-05f, -0.000109622946f, -6.91676289e-05f, 0.000274364221f, 0.000679429375f, 0.000389808915f, -0.000990804679f, -0.0023326618f, -0.00138408983f, 0.0025311544f, 0.00608212878f, 0.00383606726f, -0.00529006532f, -0.0134958632f, -0.00916305192f, 0.00979140864f, 0.0275401341f, 0.0204860693f, -0.0174367925f, -0.0574413276f, -0.0494848072f, 0.0366189874f, 0.176077811f, 0.295466862f, 0.322350992f, 0.239711234f, 0.0991087184f, -0.0188082076f, -0.0625258568f, -0.0388812974f, 0.00563554058f, 0.0284103786f, 0.0197765625f, -0.00154213709f, -0.0135385885f, -0.0100057941f, 0.000146240091f, 0.00600283585f, 0.00458451353f, 0.000184510752f, -0.00229115572f, -0.00175797573f, -0.000147157392f, 0.000678746973f, 0.000495779654f, 5.39645941e-05f, -0.000120926398f, -6.76735903e-05f},
+        {-3.01796497e-05f, -0.00010924139f, -7.02947297e-05f, 0.000271435113f, 0.000678171878f, 0.000395217543f, -0.00098018216f, -0.00232913452f, -0.00140039659f, 0.00250223854f, 0.0060729773f, 0.00387476957f, -0.00522349396f, -0.0134733165f, -0.00924247565f, 0.00965179598f, 0.0274849867f, 0.0206367566f, -0.0171456346f, -0.0572885372f, -0.0497701998f, 0.0358572799f, 0.175179353f, 0.2949526f, 0.322544334f, 0.240489013f, 0.0999968659f, -0.0182773657f, -0.0624977914f, -0.0391494771f, 0.00539491037f, 0.0283745125f, 0.0198968398f, -0.0014211085f, -0.0135153612f, -0.0100617892f, 8.78917442e-05f, 0.00599066018f, 0.00460888936f, 0.000209503837f, -0.00228607841f, -0.00176723226f, -0.000155922958f, 0.000677278703f, 0.000498579187f, 5.61117902e-05f, -0.000120780845f, -6.82139383e-05f},
+        {-2.97626644e-05f, -0.000108855476f, -7.14084876e-05f, 0.000268510754f, 0.000676886547f, 0.000400577793f, -0.000969563578f, -0.00232551326f, -0.00141657198f, 0.00247331922f, 0.00606358583f, 0.00391316857f, -0.00515690679f, -0.0134502495f, -0.0093212589f, 0.00951217594f, 0.0274288155f, 0.0207861066f, -0.0168546533f, -0.057133819f, -0.050052342f, 0.035097851f, 0.174280132f, 0.294434537f, 0.322733142f, 0.241264404f, 0.10088599f, -0.017743417f, -0.0624669447f, -0.0394168485f, 0.00515331349f, 0.0283373147f, 0.020016608f, -0.00129965802f, -0.0134914711f, -0.0101175181f, 2.93461438e-05f, 0.00597817331f, 0.00463314664f, 0.000234586475f, -0.00228087244f, -0.00177644722f, -0.000164725418f, 0.000675767522f, 0.000501369639f, 5.8271564e-05f, -0.000120625809f, -6.87545586e-05f},
+        {-2.9348239e-05f, -0.00010846527f, -7.2508926e-05f, 0.000265591283f, 0.000675573608f, 0.000405889632f, -0.000958949449f, -0.00232179862f, -0.00143261576f, 0.00244439782f, 0.00605395563f, 0.00395126352f, -0.00509030684f, -0.0134266649f, -0.00939940012f, 0.00937255461f, 0.0273716256f, 0.020934117f, -0.0165638602f, -0.056977186f, -0.0503312358f, 0.0343407147f, 0.17338017f, 0.293912686f, 0.322917412f, 0.242037388f, 0.101776071f, -0.0172063672f, -0.0624333076f, -0.039683398f, 0.00491075718f, 0.0282987829f, 0.0201358604f, -0.00117778972f, -0.0134669173f, -0.0101729774f, -2.93947032e-05f, 0.00596537474f, 0.00465728378f, 0.000259757825f, -0.00227553753f, -0.00178561997f, -0.000173564499f, 0.00067421328f, 0.000504150798f, 6.04438673e-05f, -0.000120461226f, -6.92954076e-05f},
+        {-2.89363885e-05f, -0.000108070836f, -7.35960692e-05f, 0.000262676841f, 0.000674233286f, 0.00041115303f, -0.000948340283f, -0.00231799117f, -0.00144852768f, 0.0024154757f, 0.00604408799f, 0.00398905371f, -0.00502369714f, -0.0134025653f, -0.00947689778f, 0.00923293805f, 0.0273134227f, 0.0210807855f, -0.0162732668f, -0.0568186509f, -0.0506068833f, 0.0335858846f, 0.172479488f, 0.293387062f, 0.323097139f, 0.242807944f, 0.10266709f, -0.0166662223f, -0.0623968714f, -0.0399491121f, 0.00466724873f, 0.028258915f, 0.0202545905f, -0.0010555077f, -0.0134416988f, -0.0102281638f, -8.83287738e-05f, 0.00595226399f, 0.00468129925f, 0.000285017038f, -0.0022700734f, -0.00179474987f, -0.000182439928f, 0.00067261583f, 0.000506922451f, 6.2628651e-05f, -0.000120287034f, -6.98364415e-05f},
+        {-2.8527128e-05f, -0.000107672239f, -7.46699422e-05f, 0.000259767567f, 0.000672865809f, 0.000416367959f, -0.000937736589f, -0.0023140915f, -0.00146430753f, 0.0023865542f, 0.00603398421f, 0.00402653843f, -0.0049570807f, -0.0133779532f, -0.00955375038f, 0.00909333232f, 0.0272542121f, 0.0212261098f, -0.0159828845f, -0.0566582266f, -0.0508792869f, 0.0328333746f, 0.17157811f, 0.292857678f, 0.323272317f, 0.243576052f, 0.103559027f, -0.0161229885f, -0.0623576274f, -0.0402139769f, 0.00442279552f, 0.0282177085f, 0.0203727915f, -0.000932816119f, -0.0134158148f, -0.010283074f, -0.00014745403f, 0.00593884058f, 0.00470519147f, 0.00031036326f, -0.00226447979f, -0.00180383626f, -0.000191351427f, 0.000670975026f, 0.000509684384f, 6.48258646e-05f, -0.00012010317f, -7.0377616e-05f},
+        {-2.81204717e-05f, -0.000107269545f, -7.57305706e-05f, 0.000256863597f, 0.000671471404f, 0.000421534394f, -0.000927138873f, -0.0023101002f, -0.00147995506f, 0.00235763468f, 0.00602364556f, 0.00406371701f, -0.00489046055f, -0.0133528315f, -0.00962995645f, 0.00895374345f, 0.0271939994f, 0.0213700878f, -0.0156927247f, -0.056495926f, -0.0511484487f, 0.0320831982f, 0.170676055f, 0.292324548f, 0.323442943f, 0.244341694f, 0.104451862f, -0.0155766719f, -0.0623155668f, -0.040477979f, 0.00417740497f, 0.0281751615f, 0.0204904567f, -0.000809719135f, -0.0133892644f, -0.0103377046f, -0.000206768418f, 0.00592510407f, 0.00472895889f, 0.000335795626f, -0.00225875643f, -0.00181287851f, -0.000200298715f, 0.000669290724f, 0.000512436383f, 6.70354568e-05f, -0.000119909572f, -7.09188865e-05f},
+        {-2.77164339e-05f, -0.000106862818f, -7.67779809e-05f, 0.000253965069f, 0.000670050298f, 0.000426652314f, -0.000916547639f, -0.00230601784f, -0.00149547007f, 0.00232871849f, 0.00601307336f, 0.00410058876f, -0.00482383968f, -0.0133272027f, -0.00970551458f, 0.00881417746f, 0.0271327899f, 0.0215127173f, -0.0154027988f, -0.056331762f, -0.0514143713f, 0.031335369f, 0.169773347f, 0.291787686f, 0.323609012f, 0.24510485f, 0.105345577f, -0.0150272787f, -0.062270681f, -0.0407411045f, 0.00393108456f, 0.0281312717f, 0.0206075796f, -0.000686220952f, -0.0133620468f, -0.0103920524f, -0.000266269869f, 0.00591105401f, 0.00475259995f, 0.000361313267f, -0.00225290305f, -0.00182187596f, -0.00020928151f, 0.000667562782f, 0.000515178234f, 6.92573751e-05f, -0.000119706178f, -7.14602081e-05f},
+        {-2.73150284e-05f, -0.000106452122f, -7.78122002e-05f, 0.000251072117f, 0.000668602719f, 0.000431721698f, -0.000905963388f, -0.00230184503f, -0.00151085235f, 0.00229980696f, 0.00600226892f, 0.00413715305f, -0.00475722109f, -0.0133010695f, -0.00978042336f, 0.00867464036f, 0.0270705893f, 0.0216539964f, -0.0151131181f, -0.0561657475f, -0.0516770571f, 0.0305899004f, 0.168870006f, 0.291247106f, 0.323770518f, 0.2458655f, 0.10624015f, -0.0144748154f, -0.0622229615f, -0.0410033399f, 0.00368384183f, 0.0280860372f, 0.0207241534f, -0.000562325799f, -0.0133341612f, -0.0104461139f, -0.000325956299f, 0.00589668997f, 0.00477611309f, 0.000386915304f, -0.0022469194f, -0.00183082798f, -0.000218299523f, 0.000665791057f, 0.000517909722f, 7.14915658e-05f, -0.000119492928f, -7.20015355e-05f},
+        {-2.69162686e-05f, -0.000106037522f, -7.88332561e-05f, 0.000248184876f, 0.000667128895f, 0.00043674253f, -0.000895386618f, -0.00229758236f, -0.00152610169f, 0.00227090142f, 0.00599123354f, 0.00417340923f, -0.00469060775f, -0.0132744346f, -0.00985468143f, 0.00853513812f, 0.0270074031f, 0.021793923f, -0.014823694f, -0.0559978955f, -0.0519365088f, 0.0298468058f, 0.167966054f, 0.290702822f, 0.323927459f, 0.246623624f, 0.107135562f, -0.0139192885f, -0.0621723999f, -0.0412646715f, 0.0034356844f, 0.0280394558f, 0.0208401715f, -0.000438037935f, -0.0133056067f, -0.010499886f, -0.000385825609f, 0.00588201154f, 0.00479949676f, 0.000412600851f, -0.00224080522f, -0.00183973391f, -0.000227352465f, 0.000663975412f, 0.000520630631f, 7.37379743e-05f, -0.000119269759f, -7.2542823e-05f},
+        {-2.65201677e-05f, -0.000105619082f, -7.98411772e-05f, 0.000245303479f, 0.000665629054f, 0.000441714796f, -0.000884817826f, -0.00229323041f, -0.00154121791f, 0.00224200321f, 0.00597996856f, 0.00420935668f, -0.00462400263f, -0.0132473008f, -0.00992828745f, 0.00839567671f, 0.0269432368f, 0.0219324952f, -0.0145345376f, -0.0558282191f, -0.0521927291f, 0.0291060983f, 0.167061514f, 0.29015485f, 0.324079829f, 0.247379204f, 0.108031794f, -0.0133607045f, -0.0621189877f, -0.0415250856f, 0.00318661991f, 0.0279915256f, 0.0209556272f, -0.00031336165f, -0.0132763827f, -0.0105533653f, -0.000445875686f, 0.0058670183f, 0.0048227494f, 0.000438369018f, -0.00223456029f, -0.00184859311f, -0.000236440041f, 0.000662115708f, 0.000523340744f, 7.59965448e-05f, -0.00011903661f, -7.30840248e-05f},
+        {-2.61267385e-05f, -0.000105196867f, -8.08359926e-05f, 0.000242428058f, 0.000664103425f, 0.000446638484f, -0.000874257505f, -0.00228878979f, -0.0015562008f, 0.00221311366f, 0.00596847529f, 0.00424499481f, -0.00455740872f, -0.0132196708f, -0.0100012401f, 0.00825626207f, 0.0268780962f, 0.0220697112f, -0.0142456601f, -0.0556567311f, -0.0524457208f, 0.0283677912f, 0.166156407f, 0.289603202f, 0.324227625f, 0.248132219f, 0.108928825f, -0.0127990702f, -0.0620627167f, -0.0417845685f, 0.0029366561f, 0.0279422447f, 0.021070514f, -0.00018830126f, -0.0132464884f, -0.0106065484f, -0.000506104399f, 0.00585170988f, 0.00484586945f, 0.000464218902f, -0.00222818434f, -0.00185740493f, -0.000245561957f, 0.00066021181f, 0.000526039844f, 7.82672204e-05f, -0.000118793421f, -7.36250945e-05f},
+        {-2.57359933e-05f, -0.000104770939f, -8.18177321e-05f, 0.000239558744f, 0.000662552236f, 0.000451513587f, -0.000863706144f, -0.00228426109f, -0.00157105019f, 0.00218423407f, 0.00595675508f, 0.00428032303f, -0.00449082894f, -0.0131915473f, -0.0100735382f, 0.00811690012f, 0.0268119868f, 0.0222055691f, -0.0139570728f, -0.0554834448f, -0.0526954867f, 0.0276318975f, 0.165250754f, 0.289047895f, 0.324370842f, 0.248882652f, 0.109826636f, -0.0122343922f, -0.0620035784f, -0.0420431065f, 0.00268580075f, 0.0278916112f, 0.0211848251f, -6.28611148e-05f, -0.0132159232f, -0.0106594322f, -0.000566509605f, 0.00583608589f, 0.00486885535f, 0.000490149597f, -0.00222167715f, -0.00186616872f, -0.000254717911f, 0.000658263584f, 0.000528727715f, 8.05499431e-05f, -0.000118540132f, -7.41659856e-05f},
+        {-2.53479444e-05f, -0.000104341363f, -8.27864262e-05f, 0.000236695666f, 0.000660975718f, 0.000456340097f, -0.000853164232f, -0.00227964492f, -0.00158576591f, 0.00215536577f, 0.00594480925f, 0.00431534076f, -0.00442426626f, -0.0131629331f, -0.0101451805f, 0.00797759678f, 0.0267449142f, 0.0223400672f, -0.0136687866f, -0.0553083731f, -0.0529420298f, 0.0268984303f, 0.164344578f, 0.288488941f, 0.324509477f, 0.249630481f, 0.110725207f, -0.0116666776f, -0.0619415649f, -0.0423006859f, 0.00243406169f, 0.0278396234f, 0.021298554f, 6.29544103e-05f, -0.0131846863f, -0.0107120133f, -0.000627089145f, 0.00582014597f, 0.00489170556f, 0.000516160188f, -0.0022150385f, -0.00187488383f, -0.000263907601f, 0.000656270898f, 0.000531404137f, 8.28446539e-05f, -0.000118276681f, -7.47066509e-05f},
+        {-2.49626035e-05f, -0.000103908202f, -8.37421061e-05f, 0.000233838954f, 0.000659374098f, 0.000461118012f, -0.000842632255f, -0.00227494188f, -0.00160034779f, 0.00212651006f, 0.00593263917f, 0.00435004745f, -0.0043577236f, -0.0131338309f, -0.0102161656f, 0.00783835793f, 0.0266768843f, 0.0224732039f, -0.0133808128f, -0.0551315291f, -0.0531853533f, 0.0261674023f, 0.163437899f, 0.287926356f, 0.324643527f, 0.250375688f, 0.111624517f, -0.0110959334f, -0.0618766679f, -0.042557293f, 0.00218144683f, 0.0277862794f, 0.021411694f, 0.000189140909f, -0.0131527771f, -0.0107642883f, -0.000687840844f, 0.00580388977f, 0.00491441852f, 0.000542249754f, -0.00220826816f, -0.00188354963f, -0.000273130721f, 0.000654233621f, 0.000534068893f, 8.51512925e-05f, -0.00011800301f, -7.52470433e-05f},
+        {-2.45799821e-05f, -0.000103471519f, -8.46848035e-05f, 0.000230988734f, 0.000657747607f, 0.000465847331f, -0.000832110695f, -0.00227015257f, -0.00161479567f, 0.00209766825f, 0.00592024618f, 0.00438444257f, -0.00429120389f, -0.0131042436f, -0.0102864926f, 0.00769918943f, 0.0266079026f, 0.0226049774f, -0.0130931622f, -0.0549529261f, -0.0534254603f, 0.0254388265f, 0.162530741f, 0.287360155f, 0.324772987f, 0.251118255f, 0.112524547f, -0.0105221666f, -0.0618088794f, -0.0428129141f, 0.00192796412f, 0.0277315776f, 0.0215242385f, 0.000315693948f, -0.013120195f, -0.0108162541f, -0.000748762515f, 0.00578731695f, 0.00493699268f, 0.000568417364f, -0.0022013659f, -0.00189216545f, -0.000282386962f, 0.000652151624f, 0.000536721763f, 8.74697976e-05f, -0.000117719059f, -7.57871152e-05f},
+        {-2.42000912e-05f, -0.000103031378f, -8.56145509e-05f, 0.000228145132f, 0.000656096474f, 0.000470528056f, -0.000821600031f, -0.00226527759f, -0.0016291094f, 0.00206884163f, 0.00590763163f, 0.00441852559f, -0.00422471004f, -0.0130741739f, -0.0103561603f, 0.00756009713f, 0.0265379749f, 0.0227353864f, -0.0128058459f, -0.0547725771f, -0.0536623541f, 0.0247127155f, 0.161623123f, 0.286790353f, 0.324897854f, 0.251858162f, 0.113425276f, -0.00994538445f, -0.0617381916f, -0.0430675355f, 0.00167362158f, 0.0276755162f, 0.0216361809f, 0.000442609062f, -0.0130869395f, -0.0108679073f, -0.000809851953f, 0.0057704272f, 0.00495942648f, 0.000594662082f, -0.00219433153f, -0.00190073064f, -0.00029167601f, 0.000650024781f, 0.000539362528f, 8.98001069e-05f, -0.000117424768f, -7.63268184e-05f},
+        {-2.38229418e-05f, -0.000102587841f, -8.65313814e-05f, 0.000225308275f, 0.000654420928f, 0.000475160191f, -0.000811100741f, -0.00226031757f, -0.00164328884f, 0.0020400315f, 0.00589479689f, 0.00445229601f, -0.00415824496f, -0.0130436247f, -0.0104251674f, 0.00742108687f, 0.0264671069f, 0.0228644292f, -0.0125188748f, -0.0545904953f, -0.053896038f, 0.023989082f, 0.160715069f, 0.286216964f, 0.325018125f, 0.252595389f, 0.114326685f, -0.00936559427f, -0.0616645963f, -0.0433211434f, 0.00141842729f, 0.0276180938f, 0.0217475147f, 0.000569881759f, -0.01305301f, -0.0109192447f, -0.00087110694f, 0.00575322021f, 0.00498171838f, 0.000620982966f, -0.00218716483f, -0.00190924457f, -0.000300997551f, 0.000647852967f, 0.000541990967f, 9.21421567e-05f, -0.000117120078f, -7.68661048e-05f},
+        {-2.34485443e-05f, -0.000102140971f, -8.74353286e-05f, 0.000222478287f, 0.000652721201f, 0.000479743743f, -0.0008006133f, -0.00225527309f, -0.00165733385f, 0.00201123914f, 0.00588174334f, 0.00448575333f, -0.00409181154f, -0.0130125987f, -0.0104935131f, 0.00728216444f, 0.0263953046f, 0.0229921045f, -0.0122322597f, -0.0544066939f, -0.0541265155f, 0.0232679384f, 0.159806599f, 0.285640004f, 0.325133796f, 0.253329918f, 0.115228752f, -0.00878280346f, -0.061588086f, -0.0435737241f, 0.00116238938f, 0.0275593087f, 0.0218582331f, 0.00069750752f, -0.0130184059f, -0.0109702629f, -0.000932525244f, 0.00573569567f, 0.00500386683f, 0.000647379062f, -0.00217986561f, -0.00191770658f, -0.000310351265f, 0.000645636058f, 0.000544606861f, 9.44958824e-05f, -0.000116804931f, -7.74049257e-05f},
+        {-2.30769088e-05f, -0.000101690831f, -8.83264271e-05f, 0.000219655289f, 0.000650997522f, 0.000484278722f, -0.000790138178f, -0.00225014478f, -0.00167124429f, 0.00198246584f, 0.00586847233f, 0.00451889709f, -0.00402541265f, -0.0129810989f, -0.0105611962f, 0.00714333563f, 0.0263225735f, 0.0231184109f, -0.0119460116f, -0.0542211862f, -0.0543537901f, 0.0225492972f, 0.158897735f, 0.285059487f, 0.325244865f, 0.254061731f, 0.116131459f, -0.00819701955f, -0.0615086528f, -0.043825264f, 0.000905516044f, 0.0274991594f, 0.0219683297f, 0.000825481795f, -0.0129831267f, -0.0110209587f, -0.000994104618f, 0.00571785331f, 0.00502587028f, 0.000673849415f, -0.00217243366f, -0.00192611601f, -0.000319736832f, 0.000643373933f, 0.000547209987f, 9.68612182e-05f, -0.000116479269f, -7.79432322e-05f},
+        {-2.27080451e-05f, -0.000101237482f, -8.92047117e-05f, 0.000216839404f, 0.000649250121f, 0.00048876514f, -0.000779675846f, -0.00224493326f, -0.00168502005f, 0.00195371286f, 0.00585498527f, 0.00455172682f, -0.00395905118f, -0.012949128f, -0.0106282158f, 0.00700460622f, 0.0262489197f, 0.023243347f, -0.0116601411f, -0.0540339854f, -0.0545778655f, 0.0218331708f, 0.157988499f, 0.28447543f, 0.325351328f, 0.254790808f, 0.117034784f, -0.00760825015f, -0.061426289f, -0.0440757492f, 0.000647815529f, 0.0274376445f, 0.0220777978f, 0.000953800005f, -0.0129471721f, -0.0110713288f, -0.0010558428f, 0.00569969287f, 0.00504772718f, 0.000700393057f, -0.00216486881f, -0.00193447223f, -0.000329153924f, 0.000641066473f, 0.000549800125f, 9.92380973e-05f, -0.000116143033f, -7.8480975e-05f},
+        {-2.23419628e-05f, -0.000100780988f, -9.00702181e-05f, 0.000214030753f, 0.000647479229f, 0.000493203012f, -0.000769226769f, -0.00223963912f, -0.00169866101f, 0.00192498149f, 0.00584128352f, 0.00458424209f, -0.00389272998f, -0.012916689f, -0.0106945708f, 0.00686598195f, 0.0261743489f, 0.0233669116f, -0.0113746591f, -0.0538451047f, -0.0547987454f, 0.0211195713f, 0.157078913f, 0.283887846f, 0.325453183f, 0.25551713f, 0.117938707f, -0.00701650299f, -0.0613409871f, -0.0443251661f, 0.000389296144f, 0.0273747627f, 0.022186631f, 0.00108245755f, -0.0129105415f, -0.0111213701f, -0.00111773751f, 0.00568121408f, 0.005069436f, 0.000727009017f, -0.00215717087f, -0.00194277458f, -0.000338602215f, 0.000638713559f, 0.000552377052f, 0.000101626452f, -0.000115796166f, -7.90181045e-05f},
+        {-2.1978671e-05f, -0.000100321409f, -9.09229825e-05f, 0.000211229454f, 0.000645685076f, 0.000497592355f, -0.00075879141f, -0.002234263f, -0.00171216706f, 0.00189627298f, 0.00582736848f, 0.00461644247f, -0.00382645191f, -0.0128837847f, -0.0107602603f, 0.00672746853f, 0.0260988669f, 0.0234891036f, -0.0110895762f, -0.0536545575f, -0.0550164336f, 0.020408511f, 0.156168998f, 0.283296752f, 0.325550427f, 0.256240679f, 0.118843209f, -0.00642178588f, -0.0612527396f, -0.0445735009f, 0.000129966254f, 0.0273105125f, 0.0222948225f, 0.00121144978f, -0.0128732345f, -0.0111710791f, -0.00117978646f, 0.00566241672f, 0.00509099518f, 0.000753696316f, -0.00214933966f, -0.00195102241f, -0.000348081372f, 0.000636315078f, 0.000554940545f, 0.000104026212f, -0.000115438611f, -7.95545708e-05f},
+        {-2.16181785e-05f, -9.98588075e-05f, -9.17630418e-05f, 0.000208435627f, 0.000643867894f, 0.000501933189f, -0.000748370231f, -0.0022288055f, -0.00172553809f, 0.00186758859f, 0.00581324155f, 0.00464832755f, -0.00376021981f, -0.012850418f, -0.0108252834f, 0.00658907168f, 0.0260224798f, 0.0236099217f, -0.0108049031f, -0.053462357f, -0.055230934f, 0.0197000019f, 0.155258775f, 0.282702163f, 0.325643057f, 0.256961436f, 0.119748267f, -0.00582410675f, -0.0611615389f, -0.0448207399f, -0.000130165717f, 0.0272448927f, 0.0224023659f, 0.00134077206f, -0.0128352508f, -0.0112204526f, -0.00124198735f, 0.00564330055f, 0.00511240319f, 0.000780453966f, -0.00214137501f, -0.00195921507f, -0.000357591062f, 0.000633870913f, 0.000557490383f, 0.000106437308f, -0.000115070311f, -8.00903237e-05f},
+        {-2.1260494e-05f, -9.93932451e-05f, -9.25904333e-05f, 0.000205649389f, 0.000642027912f, 0.000506225537f, -0.000737963688f, -0.00222326725f, -0.00173877401f, 0.00183892958f, 0.00579890413f, 0.00467989694f, -0.00369403649f, -0.0128165918f, -0.0108896393f, 0.00645079707f, 0.0259451934f, 0.023729365f, -0.0105206503f, -0.0532685166f, -0.0554422506f, 0.0189940559f, 0.154348267f, 0.282104095f, 0.325731071f, 0.257679382f, 0.120653863f, -0.00522347362f, -0.0610673779f, -0.0450668693f, -0.00039109129f, 0.027177902f, 0.0225092546f, 0.00147041967f, -0.0127965899f, -0.0112694875f, -0.00130433785f, 0.00562386536f, 0.00513365849f, 0.000807280974f, -0.00213327675f, -0.00196735192f, -0.000367130947f, 0.000631380955f, 0.000560026341f, 0.000108859669f, -0.000114691208f, -8.06253126e-05f},
+        {-2.09056256e-05f, -9.89247828e-05f, -9.34051951e-05f, 0.000202870855f, 0.000640165361f, 0.000510469423f, -0.000727572238f, -0.00221764887f, -0.00175187474f, 0.00181029719f, 0.00578435762f, 0.00471115025f, -0.00362790479f, -0.012782309f, -0.010953327f, 0.00631265037f, 0.0258670137f, 0.0238474324f, -0.0102368284f, -0.0530730496f, -0.0556503876f, 0.018290685f, 0.153437495f, 0.281502564f, 0.325814466f, 0.2583945f, 0.121559975f, -0.00461989463f, -0.0609702491f, -0.0453118755f, -0.000652801928f, 0.0271095393f, 0.0226154821f, 0.00160038792f, -0.0127572517f, -0.0113181804f, -0.00136683563f, 0.00560411096f, 0.00515475955f, 0.000834176338f, -0.00212504474f, -0.00197543229f, -0.000376700684f, 0.000628845092f, 0.000562548197f, 0.000111293222f, -0.000114301247f, -8.11594866e-05f},
+        {-2.05535812e-05f, -9.84534817e-05f, -9.42073659e-05f, 0.000200100141f, 0.000638280473f, 0.000514664874f, -0.000717196332f, -0.00221195098f, -0.0017648402f, 0.00178169266f, 0.00576960344f, 0.00474208714f, -0.00356182751f, -0.0127475725f, -0.0110163458f, 0.00617463722f, 0.0257879465f, 0.023964123f, -0.009953448f, -0.0528759695f, -0.055855349f, 0.0175899009f, 0.15252648f, 0.280897584f, 0.325893241f, 0.25910677f, 0.122466584f, -0.004013378f, -0.0608701453f, -0.0455557447f, -0.000915289036f, 0.0270398035f, 0.0227210419f, 0.00173067204f, -0.0127172358f, -0.0113665281f, -0.00142947835f, 0.00558403716f, 0.00517570481f, 0.000861139052f, -0.0021166788f, -0.00198345555f, -0.000386299932f, 0.000626263218f, 0.000565055725f, 0.000113737893f, -0.000113900373f, -8.16927946e-05f},
+        {-2.02043685e-05f, -9.79794024e-05f, -9.49969848e-05f, 0.00019733736f, 0.000636373478f, 0.000518811922f, -0.000706836419f, -0.0022061742f, -0.0017776703f, 0.00175311724f, 0.005754643f, 0.00477270724f, -0.00349580744f, -0.0127123854f, -0.0110786949f, 0.00603676323f, 0.025707998f, 0.0240794359f, -0.00967051942f, -0.0526772895f, -0.0560571392f, 0.0168917152f, 0.151615243f, 0.280289172f, 0.325967393f, 0.259816175f, 0.123373667f, -0.00340393207f, -0.0607670596f, -0.0457984632f, -0.00117854396f, 0.0269686935f, 0.0228259275f, 0.00186126728f, -0.0126765418f, -0.0114145275f, -0.00149226364f, 0.0055636438f, 0.00519649276f, 0.0008881681f, -0.00210817881f, -0.00199142105f, -0.000395928342f, 0.000623635226f, 0.000567548701f, 0.000116193607f, -0.000113488529f, -8.2225185e-05f},
+        {-1.98579946e-05f, -9.75026057e-05f, -9.57740917e-05f, 0.000194582626f, 0.000634444606f, 0.000522910596f, -0.000696492947f, -0.00220031915f, -0.00179036498f, 0.00172457214f, 0.00573947773f, 0.00480301024f, -0.00342984736f, -0.0126767504f, -0.0111403736f, 0.00589903399f, 0.025627174f, 0.0241933702f, -0.00938805312f, -0.0524770231f, -0.0562557625f, 0.0161961396f, 0.150703807f, 0.279677344f, 0.326036919f, 0.260522695f, 0.124281206f, -0.00279156526f, -0.0606609847f, -0.0460400171f, -0.001442558f, 0.0268962082f, 0.0229301323f, 0.00199216882f, -0.0126351697f, -0.0114621751f, -0.00155518913f, 0.00554293073f, 0.00521712186f, 0.00091526246f, -0.00209954461f, -0.00199932812f, -0.000405585564f, 0.000620961012f, 0.0005700269f, 0.000118660289f, -0.00011306566f, -8.27566061e-05f},
+        {-1.95144666e-05f, -9.70231517e-05f, -9.65387268e-05f, 0.000191836049f, 0.00063249409f, 0.000526960934f, -0.000686166358f, -0.00219438648f, -0.00180292418f, 0.0016960586f, 0.00572410904f, 0.00483299581f, -0.00336395006f, -0.0126406706f, -0.0112013811f, 0.00576145509f, 0.0255454807f, 0.0243059253f, -0.00910605944f, -0.0522751838f, -0.0564512234f, 0.0155031856f, 0.149792193f, 0.279062116f, 0.326101819f, 0.261226313f, 0.125189178f, -0.00217628612f, -0.0605519137f, -0.046280393f, -0.00170732239f, 0.0268223468f, 0.0230336498f, 0.00212337185f, -0.0125931191f, -0.011509468f, -0.00161825242f, 0.00552189779f, 0.00523759059f, 0.000942421104f, -0.00209077607f, -0.00200717614f, -0.000415271245f, 0.000618240475f, 0.000572490097f, 0.000121137861f, -0.000112631712f, -8.32870057e-05f},
+        {-1.9173791e-05f, -9.65411005e-05f, -9.72909312e-05f, 0.000189097739f, 0.00063052216f, 0.000530962971f, -0.000675857094f, -0.00218837679f, -0.00181534785f, 0.00166757783f, 0.00570853837f, 0.00486266367f, -0.00329811829f, -0.012604149f, -0.0112617167f, 0.00562403206f, 0.0254629241f, 0.0244171003f, -0.00882454869f, -0.0520717849f, -0.0566435264f, 0.0148128646f, 0.148880423f, 0.278443503f, 0.326162091f, 0.26192701f, 0.126097565f, -0.00155810326f, -0.0604398398f, -0.0465195769f, -0.00197282831f, 0.0267471082f, 0.0231364737f, 0.00225487151f, -0.0125503899f, -0.0115564027f, -0.00168145112f, 0.00550054488f, 0.0052578974f, 0.000969642996f, -0.00208187307f, -0.00201496444f, -0.000424985028f, 0.000615473514f, 0.000574938067f, 0.000123626246f, -0.00011218663f, -8.38163315e-05f},
+        {-1.88359744e-05f, -9.60565121e-05f, -9.80307462e-05f, 0.000186367807f, 0.000628529046f, 0.000534916748f, -0.000665565592f, -0.00218229073f, -0.00182763595f, 0.00163913104f, 0.00569276716f, 0.00489201351f, -0.0032323548f, -0.0125671885f, -0.0113213798f, 0.00548677045f, 0.0253795101f, 0.0245268947f, -0.00854353112f, -0.05186684f, -0.0568326761f, 0.0141251878f, 0.147968517f, 0.277821523f, 0.326217733f, 0.262624769f, 0.127006344f, -0.000937025442f, -0.060324756f, -0.0467575552f, -0.00223906687f, 0.0266704918f, 0.0232385974f, 0.00238666291f, -0.012506982f, -0.0116029762f, -0.0017447828f, 0.00547887187f, 0.00527804079f, 0.000996927094f, -0.00207283548f, -0.00202269237f, -0.000434726554f, 0.000612660031f, 0.000577370582f, 0.000126125364f, -0.00011173036f, -8.43445306e-05f},
+        {-1.85010225e-05f, -9.5569446e-05f, -9.8758214e-05f, 0.00018364636f, 0.000626514979f, 0.000538822306f, -0.000655292287f, -0.00217612891f, -0.00183978842f, 0.00161071943f, 0.00567679684f, 0.00492104509f, -0.00316666233f, -0.0125297921f, -0.0113803698f, 0.00534967574f, 0.025295245f, 0.0246353078f, -0.00826301694f, -0.0516603625f, -0.0570186773f, 0.0134401665f, 0.147056497f, 0.277196191f, 0.326268743f, 0.263319571f, 0.127915495f, -0.000313061488f, -0.0602066558f, -0.0469943141f, -0.00250602916f, 0.0265924966f, 0.0233400144f, 0.00251874116f, -0.0124628952f, -0.0116491853f, -0.00180824504f, 0.00545687867f, 0.00529801923f, 0.00102427235f, -0.00206366317f, -0.0020303593f, -0.000444495461f, 0.000609799932f, 0.000579787418f, 0.000128635134f, -0.00011126285f, -8.487155e-05f},
+        {-1.81689413e-05f, -9.50799615e-05f, -9.94733771e-05f, 0.000180933505f, 0.000624480192f, 0.00054267969f, -0.000645037611f, -0.00216989198f, -0.00185180524f, 0.00158234421f, 0.00566062886f, 0.00494975815f, -0.0031010436f, -0.0124919629f, -0.011438686f, 0.00521275343f, 0.0252101348f, 0.0247423391f, -0.0079830163f, -0.0514523658f, -0.0572015347f, 0.0127578117f, 0.146144385f, 0.276567523f, 0.32631512f, 0.264011398f, 0.128824997f, 0.000313779662f, -0.0600855324f, -0.04722984f, -0.00277370618f, 0.0265131219f, 0.0234407184f, 0.00265110131f, -0.0124181295f, -0.0116950266f, -0.00187183538f, 0.0054345652f, 0.00531783119f, 0.0010516777f, -0.00205435606f, -0.00203796458f, -0.000454291381f, 0.000606893121f, 0.000582188346f, 0.000131155476f, -0.000110784045f, -8.53973366e-05f},
+        {-1.78397361e-05f, -9.45881178e-05f, -0.000100176279f, 0.000178229347f, 0.000622424913f, 0.000546488947f, -0.000634801994f, -0.00216358056f, -0.00186368638f, 0.00155400657f, 0.00564426467f, 0.00497815244f, -0.00303550133f, -0.0124537038f, -0.0114963279f, 0.00507600897f, 0.0251241856f, 0.0248479882f, -0.00770353931f, -0.0512428635f, -0.0573812533f, 0.0120781346f, 0.145232202f, 0.275935536f, 0.326356863f, 0.264700232f, 0.129734829f, 0.000943488971f, -0.0599613792f, -0.0474641192f, -0.0030420889f, 0.0264323671f, 0.0235407028f, 0.0027837384f, -0.0123726848f, -0.0117404971f, -0.00193555138f, 0.0054119314f, 0.00533747517f, 0.00107914209f, -0.00204491402f, -0.00204550754f, -0.000464113946f, 0.000603939508f, 0.000584573141f, 0.000133686305f, -0.000110293893f, -8.59218365e-05f},
+        {-1.75134121e-05f, -9.40939737e-05f, -0.000100866963f, 0.000175533992f, 0.000620349374f, 0.000550250126f, -0.000624585862f, -0.00215719529f, -0.00187543183f, 0.0015257077f, 0.00562770571f, 0.00500622776f, -0.00297003822f, -0.0124150179f, -0.0115532951f, 0.0049394478f, 0.0250374036f, 0.0249522547f, -0.00742459602f, -0.0510318692f, -0.057557838f, 0.0114011459f, 0.144319969f, 0.275300247f, 0.32639397f, 0.265386056f, 0.130644972f, 0.0015760573f, -0.0598341898f, -0.0476971379f, -0.0033111682f, 0.0263502316f, 0.0236399613f, 0.00291664745f, -0.012326561f, -0.0117855935f, -0.00199939056f, 0.0053889772f, 0.00535694965f, 0.00110666444f, -0.00203533696f, -0.00205298756f, -0.000473962785f, 0.000600939004f, 0.000586941574f, 0.000136227539f, -0.000109792341f, -8.64449958e-05f},
+        {-1.7189974e-05f, -9.35975878e-05f, -0.000101545473f, 0.000172847543f, 0.000618253805f, 0.000553963278f, -0.000614389637f, -0.0021507368f, -0.00188704156f, 0.00149744878f, 0.00561095345f, 0.0050339839f, -0.00290465697f, -0.0123759081f, -0.0116095869f, 0.00480307533f, 0.024949795f, 0.0250551381f, -0.00714619643f, -0.0508193963f, -0.0577312938f, 0.0107268565f, 0.143407708f, 0.274661672f, 0.326426442f, 0.266068852f, 0.131555402f, 0.00221147541f, -0.0597039578f, -0.0479288824f, -0.00358093495f, 0.0262667147f, 0.0237384875f, 0.00304982345f, -0.0122797582f, -0.0118303128f, -0.00206335043f, 0.00536570258f, 0.00537625311f, 0.00113424369f, -0.00202562479f, -0.00206040397f, -0.000483837523f, 0.000597891519f, 0.000589293419f, 0.000138779091f, -0.000109279339f, -8.69667605e-05f},
+        {-1.68694263e-05f, -9.30990185e-05f, -0.000102211854f, 0.000170170101f, 0.000616138437f, 0.000557628458f, -0.000604213741f, -0.00214420573f, -0.00189851558f, 0.00146923098f, 0.00559400934f, 0.00506142066f, -0.00283936024f, -0.0123363776f, -0.0116652029f, 0.00466689695f, 0.0248613658f, 0.0251566382f, -0.00686835048f, -0.0506054584f, -0.057901626f, 0.0100552771f, 0.14249544f, 0.274019828f, 0.326454276f, 0.266748602f, 0.132466101f, 0.00284973397f, -0.0595706768f, -0.0481593391f, -0.00385137993f, 0.0261818159f, 0.0238362749f, 0.00318326135f, -0.0122322764f, -0.0118746517f, -0.00212742849f, 0.00534210751f, 0.00539538404f, 0.00116187874f, -0.00201577743f, -0.00206775615f, -0.00049373778f, 0.000594796971f, 0.000591628447f, 0.000141340877f, -0.000108754834f, -8.74870759e-05f},
+        {-1.65517734e-05f, -9.25983239e-05f, -0.000102866151f, 0.000167501769f, 0.000614003501f, 0.000561245721f, -0.00059405859f, -0.00213760271f, -0.00190985388f, 0.00144105546f, 0.00557687486f, 0.00508853787f, -0.0027741507f, -0.0122964294f, -0.0117201428f, 0.00453091802f, 0.0247721223f, 0.0252567548f, -0.00659106809f, -0.0503900691f, -0.0580688398f, 0.00938641845f, 0.141583186f, 0.273374731f, 0.326477472f, 0.267425288f, 0.133377046f, 0.00349082353f, -0.0594343406f, -0.0483884943f, -0.00412249387f, 0.0260955349f, 0.0239333172f, 0.00331695609f, -0.0121841157f, -0.011918607f, -0.00219162224f, 0.00531819199f, 0.00541434095f, 0.00118956851f, -0.00200579479f, -0.00207504343f, -0.000503663176f, 0.000591655274f, 0.00059394643f, 0.000143912809f, -0.000108218776f, -8.80058872e-05f},
+        {-1.62370192e-05f, -9.20955618e-05f, -0.000103508411f, 0.000164842646f, 0.000611849226f, 0.000564815127f, -0.000583924599f, -0.00213092838f, -0.00192105648f, 0.0014129234f, 0.00555955146f, 0.00511533537f, -0.00270903101f, -0.0122560665f, -0.011774406f, 0.00439514388f, 0.0246820707f, 0.0253554877f, -0.0063143591f, -0.0501732419f, -0.0582329404f, 0.00872029092f, 0.140670968f, 0.272726398f, 0.32649603f, 0.268098893f, 0.134288217f, 0.00413473457f, -0.0592949429f, -0.0486163343f, -0.00439426747f, 0.0260078711f, 0.024029608f, 0.00345090257f, -0.0121352761f, -0.0119621757f, -0.00225592914f, 0.00529395601f, 0.00543312232f, 0.00121731189f, -0.00199567681f, -0.00208226517f, -0.000513613327f, 0.000588466349f, 0.00059624714f, 0.000146494797f, -0.000107671113f, -8.85231394e-05f},
+        {-1.59251671e-05f, -9.15907898e-05f, -0.000104138679f, 0.000162192831f, 0.000609675843f, 0.000568336736f, -0.00057381218f, -0.00212418338f, -0.00193212338f, 0.00138483595f, 0.00554204063f, 0.00514181303f, -0.00264400381f, -0.0122152921f, -0.0118279922f, 0.00425957986f, 0.0245912173f, 0.0254528368f, -0.0060382333f, -0.0499549905f, -0.0583939334f, 0.00805690499f, 0.139758806f, 0.272074846f, 0.326509949f, 0.2687694f, 0.135199593f, 0.00478145743f, -0.0591524779f, -0.0488428455f, -0.00466669136f, 0.0259188244f, 0.024125141f, 0.00358509569f, -0.0120857578f, -0.0120053545f, -0.00232034667f, 0.00526939961f, 0.00545172667f, 0.00124510779f, -0.00198542341f, -0.00208942074f, -0.000523587846f, 0.000585230116f, 0.000598530348f, 0.000149086754f, -0.000107111796f, -8.9038777e-05f},
+        {-1.56162207e-05f, -9.10840652e-05f, -0.000104757001f, 0.000159552422f, 0.000607483581f, 0.000571810611f, -0.000563721741f, -0.00211736836f, -0.0019430546f, 0.00135679425f, 0.00552434383f, 0.00516797071f, -0.00257907172f, -0.0121741092f, -0.0118809011f, 0.00412423123f, 0.0244995682f, 0.0255488019f, -0.00576270044f, -0.0497353283f, -0.0585518241f, 0.007396271f, 0.138846723f, 0.271420092f, 0.326519228f, 0.26943679f, 0.136111153f, 0.00543098239f, -0.0590069393f, -0.0490680141f, -0.0049397561f, 0.0258283942f, 0.0242199099f, 0.00371953029f, -0.012035561f, -0.0120481404f, -0.00238487226f, 0.00524452282f, 0.00547015248f, 0.0012729551f, -0.00197503455f, -0.00209650949f, -0.000533586341f, 0.000581946499f, 0.000600795826f, 0.000151688587f, -0.000106540776f, -8.95527445e-05f},
+        {-1.53101829e-05f, -9.05754449e-05f, -0.000105363427f, 0.000156921514f, 0.000605272672f, 0.000575236817f, -0.000553653687f, -0.00211048394f, -0.00195385018f, 0.00132879946f, 0.00550646255f, 0.00519380829f, -0.00251423737f, -0.0121325209f, -0.0119331324f, 0.00398910326f, 0.0244071297f, 0.0256433831f, -0.0054877702f, -0.0495142692f, -0.0587066182f, 0.00673839916f, 0.137934739f, 0.270762154f, 0.326523868f, 0.270101047f, 0.137022875f, 0.00608329961f, -0.0588583214f, -0.0492918265f, -0.00521345223f, 0.0257365806f, 0.0243139082f, 0.00385420121f, -0.0119846858f, -0.0120905303f, -0.00244950335f, 0.00521932569f, 0.00548839827f, 0.0013008527f, -0.00196451015f, -0.00210353077f, -0.00054360842f, 0.000578615424f, 0.000603043343f, 0.000154300205f, -0.000105958002f, -9.00649859e-05f},
+    };
+};
@@ -0,0 +1,12 @@
+// This file is automatically generated by python/nodes/Resampler.py. Do not edit.
+#pragma once
+
+// Polyphase filter for a 1/3 resampler
+template <>
+struct ResamplerFilter<1, 3>
+{
+    static constexpr int tapsPerPhase = 48;
+    static constexpr float coefs[1][48] = {
+        {-4.95577543e-06f, 6.66401869e-05f, 0.000201406071f, 0.00017260526f, -0.000293709799f, -0.00102004325f, -0.00111102124f, 0.000360012198f, 0.00291195387f, 0.00403043029f, 0.000958540206f, -0.00576371567f, -0.0105493486f, -0.00627663437f, 0.00804888905f, 0.0223157974f, 0.0203085527f, -0.00572376917f, -0.0418998631f, -0.0548816602f, -0.0130884092f, 0.0862894708f, 0.206419817f, 0.288529016f, 0.288529016f, 0.206419817f, 0.0862894708f, -0.0130884092f, -0.0548816602f, -0.0418998631f, -0.00572376917f, 0.0203085527f, 0.0223157974f, 0.00804888905f, -0.00627663437f, -0.0105493486f, -0.00576371567f, 0.000958540206f, 0.00403043029f, 0.00291195387f, 0.000360012198f, -0.00111102124f, -0.00102004325f, -0.000293709799f, 0.00017260526f, 0.000201406071f, 6.66401869e-05f, -4.95577543e-06f},
+    };
+};
@@ -0,0 +1,14 @@
+// This file is automatically generated by python/nodes/Resampler.py. Do not edit.
+#pragma once
+
+// Polyphase filter for a 3/1 resampler
+template <>
+struct ResamplerFilter<3, 1>
+{
+    static constexpr int tapsPerPhase = 16;
+    static constexpr float coefs[3][16] = {
+        {0.000604218212f, -0.00306012974f, 0.00873586162f, -0.017291147f, 0.0241466672f, -0.0171713075f, -0.0392652275f, 0.865587047f, 0.258868412f, -0.125699589f, 0.0669473923f, -0.0316480458f, 0.0120912909f, -0.00333306371f, 0.000517815781f, -1.48673263e-05f},
+        {0.000199920561f, -0.000881129397f, 0.00108003659f, 0.00287562062f, -0.0188299031f, 0.0609256581f, -0.164644981f, 0.61925945f, 0.61925945f, -0.164644981f, 0.0609256581f, -0.0188299031f, 0.00287562062f, 0.00108003659f, -0.000881129397f, 0.000199920561f},
+        {-1.48673263e-05f, 0.000517815781f, -0.00333306371f, 0.0120912909f, -0.0316480458f, 0.0669473923f, -0.125699589f, 0.258868412f, 0.865587047f, -0.0392652275f, -0.0171713075f, 0.0241466672f, -0.017291147f, 0.00873586162f, -0.00306012974f, 0.000604218212f},
+    };
+};
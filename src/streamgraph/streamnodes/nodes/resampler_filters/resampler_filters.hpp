@@ -0,0 +1,6 @@
+// This file is automatically generated by python/nodes/Resampler.py. Do not edit.
+#pragma once
+
+#include "ResamplerFilter_160_441.hpp"
+#include "ResamplerFilter_1_3.hpp"
+#include "ResamplerFilter_3_1.hpp"
@@ -0,0 +1,176 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(streamapps, CONFIG_STREAMAPPS_LOG_LEVEL);
+
+#include "app_config.hpp"
+#include "stream_platform_config.hpp"
+#include "cg_enums.h"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+
+#include "appnodes/Mixer.hpp"
+
+#include <cmath>
+
+using namespace arm_cmsis_stream;
+
+#define BLOCK_SIZE 320
+// 4 s: 8 periods of the 2 Hz crossfade so that the phase wraps
+#define NB_BLOCKS (4 * CONFIG_SAMPLE_RATE / BLOCK_SIZE)
+
+/*
+
+Tolerances against the per sample reference computed in double.
+On the host, the max errors are 6e-6 for the gain, 7e-6 for the f32
+outputs and 3 LSB for the Q15 outputs (the Q15 multiplications are
+truncated).
+
+*/
+#define ALPHA_TOLERANCE 1e-4
+#define F32_TOLERANCE 1e-4
+#define Q15_TOLERANCE 4
+
+// Per sample reference of the crossfade gain of the sample n
+static double reference_alpha(long n)
+{
+	return 0.5 * (1.0 + sin(2.0 * M_PI * 2.0 * n / CONFIG_SAMPLE_RATE));
+}
+
+// Inputs of the mixer: two tones of different levels
+static double input_left(long n)
+{
+	return 0.8 * sin(2.0 * M_PI * 440.0 * n / CONFIG_SAMPLE_RATE);
+}
+
+static double input_right(long n)
+{
+	return 0.5 * cos(2.0 * M_PI * 1000.0 * n / CONFIG_SAMPLE_RATE);
+}
+
+ZTEST(mixer, test_crossfade_ramp)
+{
+	static float32_t alpha[2 * BLOCK_SIZE];
+	CrossfadeRamp mono;
+	CrossfadeRamp stereo;
+	double err = 0.0;
+
+	for (int b = 0; b < NB_BLOCKS; b++) {
+		mono.fill(alpha, BLOCK_SIZE);
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			err = fmax(err, fabs(alpha[i] - reference_alpha((long)b * BLOCK_SIZE + i)));
+		}
+
+		// The gain is repeated for both channels of a sample
+		stereo.fill(alpha, BLOCK_SIZE, 2);
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			zassert_equal(alpha[2 * i], alpha[2 * i + 1], "block %d sample %d", b, i);
+			err = fmax(err, fabs(alpha[2 * i] - reference_alpha((long)b * BLOCK_SIZE + i)));
+		}
+	}
+
+	zassert_true(err <= ALPHA_TOLERANCE, "gain error %e", err);
+}
+
+ZTEST(mixer, test_mixer_f32)
+{
+	static float inlBuf[BLOCK_SIZE], inrBuf[BLOCK_SIZE];
+	static float outlBuf[BLOCK_SIZE], outrBuf[BLOCK_SIZE];
+	FIFO<float, BLOCK_SIZE, 1, 0> inl(inlBuf), inr(inrBuf);
+	FIFO<float, BLOCK_SIZE, 1, 0> outl(outlBuf), outr(outrBuf);
+	Mixer<float, BLOCK_SIZE, float, BLOCK_SIZE, float, BLOCK_SIZE, float, BLOCK_SIZE> mixer(
+		inl, inr, outl, outr);
+	double err = 0.0;
+
+	for (int b = 0; b < NB_BLOCKS; b++) {
+		const long start = (long)b * BLOCK_SIZE;
+
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			inlBuf[i] = (float)input_left(start + i);
+			inrBuf[i] = (float)input_right(start + i);
+		}
+
+		zassert_equal(mixer.run(), CG_SUCCESS);
+
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			const double a = reference_alpha(start + i);
+			const double l = inlBuf[i];
+			const double r = inrBuf[i];
+			err = fmax(err, fabs(outlBuf[i] - (a * l + (1.0 - a) * r)));
+			err = fmax(err, fabs(outrBuf[i] - ((1.0 - a) * l + a * r)));
+		}
+	}
+
+	zassert_true(err <= F32_TOLERANCE, "f32 error %e", err);
+}
+
+ZTEST(mixer, test_mixer_sf32)
+{
+	static sf32 inlBuf[BLOCK_SIZE], inrBuf[BLOCK_SIZE];
+	static sf32 outlBuf[BLOCK_SIZE], outrBuf[BLOCK_SIZE];
+	FIFO<sf32, BLOCK_SIZE, 1, 0> inl(inlBuf), inr(inrBuf);
+	FIFO<sf32, BLOCK_SIZE, 1, 0> outl(outlBuf), outr(outrBuf);
+	Mixer<sf32, BLOCK_SIZE, sf32, BLOCK_SIZE, sf32, BLOCK_SIZE, sf32, BLOCK_SIZE> mixer(
+		inl, inr, outl, outr);
+	double err = 0.0;
+
+	for (int b = 0; b < NB_BLOCKS; b++) {
+		const long start = (long)b * BLOCK_SIZE;
+
+		// The right channels are the left ones of the other stream
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			inlBuf[i].left = (float)input_left(start + i);
+			inlBuf[i].right = (float)input_right(start + i);
+			inrBuf[i].left = (float)input_right(start + i);
+			inrBuf[i].right = (float)input_left(start + i);
+		}
+
+		zassert_equal(mixer.run(), CG_SUCCESS);
+
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			const double a = reference_alpha(start + i);
+			const sf32 l = inlBuf[i];
+			const sf32 r = inrBuf[i];
+			err = fmax(err, fabs(outlBuf[i].left - (a * l.left + (1.0 - a) * r.left)));
+			err = fmax(err, fabs(outlBuf[i].right - (a * l.right + (1.0 - a) * r.right)));
+			err = fmax(err, fabs(outrBuf[i].left - ((1.0 - a) * l.left + a * r.left)));
+			err = fmax(err, fabs(outrBuf[i].right - ((1.0 - a) * l.right + a * r.right)));
+		}
+	}
+
+	zassert_true(err <= F32_TOLERANCE, "sf32 error %e", err);
+}
+
+ZTEST(mixer, test_mixer_q15)
+{
+	static q15_t inlBuf[BLOCK_SIZE], inrBuf[BLOCK_SIZE];
+	static q15_t outlBuf[BLOCK_SIZE], outrBuf[BLOCK_SIZE];
+	FIFO<q15_t, BLOCK_SIZE, 1, 0> inl(inlBuf), inr(inrBuf);
+	FIFO<q15_t, BLOCK_SIZE, 1, 0> outl(outlBuf), outr(outrBuf);
+	Mixer<q15_t, BLOCK_SIZE, q15_t, BLOCK_SIZE, q15_t, BLOCK_SIZE, q15_t, BLOCK_SIZE> mixer(
+		inl, inr, outl, outr);
+	long err = 0;
+
+	for (int b = 0; b < NB_BLOCKS; b++) {
+		const long start = (long)b * BLOCK_SIZE;
+
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			inlBuf[i] = (q15_t)(32767.0 * input_left(start + i));
+			inrBuf[i] = (q15_t)(32767.0 * input_right(start + i));
+		}
+
+		zassert_equal(mixer.run(), CG_SUCCESS);
+
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			const double a = reference_alpha(start + i);
+			const double l = inlBuf[i];
+			const double r = inrBuf[i];
+			err = MAX(err, labs(outlBuf[i] - lround(a * l + (1.0 - a) * r)));
+			err = MAX(err, labs(outrBuf[i] - lround((1.0 - a) * l + a * r)));
+		}
+	}
+
+	zassert_true(err <= Q15_TOLERANCE, "q15 error of %ld LSB", err);
+}
+
+ZTEST_SUITE(mixer, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,221 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(streamapps, CONFIG_STREAMAPPS_LOG_LEVEL);
+
+#include "app_config.hpp"
+#include "stream_platform_config.hpp"
+#include "cg_enums.h"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+
+#include "dsp/complex_math_functions.h"
+#if defined(ARM_FLOAT16_SUPPORTED)
+#include "dsp/complex_math_functions_f16.h"
+#include "dsp/support_functions_f16.h"
+#endif
+
+#include "nodes/Convert.hpp"
+#include "nodes/Hanning.hpp"
+#include "nodes/RealToComplex.hpp"
+#include "nodes/CFFT.hpp"
+
+#include <cmath>
+#include <cstring>
+
+using namespace arm_cmsis_stream;
+
+// Same sizes as the spectrogram graph (python/spectrogram.py)
+#define SAMPLING_FREQ_HZ 16000
+#define NB_WINDOW_SAMPLES 640
+#define FFT_SIZE 1024
+#define NB_MAG (FFT_SIZE >> 1)
+
+/*
+
+Tolerances: max absolute error on the magnitudes relative to the peak
+magnitude of the spectrum.
+
+The f32 chain is compared with a DFT computed in double.
+The f16 chain is compared with the f32 chain. A model of a radix-2 f16
+FFT rounding each operation gives an error of 3.5e-4 of the peak for
+the test signal: the magnitude itself is rounded to 11 bits.
+
+*/
+#define F32_TOLERANCE 1e-4f
+#define F16_TOLERANCE 2e-3f
+
+static q15_t test_signal[NB_WINDOW_SAMPLES];
+static float32_t mag_f32[NB_MAG];
+
+/*
+
+Two tones (1 kHz at -6 dBFS and 3.15 kHz at -12 dBFS) and a low level
+noise so that no bin of the spectrum is zero.
+
+*/
+static void make_signal(void)
+{
+	uint32_t seed = 1;
+
+	for (int i = 0; i < NB_WINDOW_SAMPLES; i++) {
+		seed = seed * 1664525u + 1013904223u;
+		float32_t noise = (float32_t)((int32_t)(seed >> 16) - 32768) / 32768.0f;
+		float32_t x = 0.5f * sinf(2.0f * PI * 1000.0f * i / SAMPLING_FREQ_HZ) +
+			      0.25f * sinf(2.0f * PI * 3150.0f * i / SAMPLING_FREQ_HZ) +
+			      0.01f * noise;
+		test_signal[i] = (q15_t)(x * 32767.0f);
+	}
+}
+
+static void magnitude(cf32 *in, float32_t *mag)
+{
+	arm_cmplx_mag_f32((float32_t *)in, mag, NB_MAG);
+}
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+// Magnitudes computed in f16 as in the f16 Spectrogram node
+static void magnitude(cf16 *in, float32_t *mag)
+{
+	static float16_t mag_f16[NB_MAG];
+
+	arm_cmplx_mag_f16((float16_t *)in, mag_f16, NB_MAG);
+	arm_f16_to_float(mag_f16, mag, NB_MAG);
+}
+#endif
+
+/*
+
+Chain of the spectrogram graph from the microphone samples:
+Convert -> Hanning -> RealToComplex -> CFFT
+and the magnitude of the first half of the spectrum.
+
+*/
+template <typename T, typename C>
+static void run_chain(float32_t *mag)
+{
+	static q15_t inputBuf[NB_WINDOW_SAMPLES] __aligned(16);
+	static T samplesBuf[NB_WINDOW_SAMPLES] __aligned(16);
+	static T windowedBuf[FFT_SIZE] __aligned(16);
+	static C complexBuf[FFT_SIZE] __aligned(16);
+	static C spectrumBuf[FFT_SIZE] __aligned(16);
+
+	static FIFO<q15_t, NB_WINDOW_SAMPLES, 1, 0> input(inputBuf);
+	static FIFO<T, NB_WINDOW_SAMPLES, 1, 0> samples(samplesBuf);
+	static FIFO<T, FFT_SIZE, 1, 0> windowed(windowedBuf);
+	static FIFO<C, FFT_SIZE, 1, 0> complexFifo(complexBuf);
+	static FIFO<C, FFT_SIZE, 1, 0> spectrum(spectrumBuf);
+
+	static Convert<q15_t, NB_WINDOW_SAMPLES, T, NB_WINDOW_SAMPLES> convert(input, samples);
+	static Hanning<T, NB_WINDOW_SAMPLES, T, FFT_SIZE> hanning(samples, windowed);
+	static RealToComplex<T, FFT_SIZE, C, FFT_SIZE> toComplex(windowed, complexFifo);
+	static CFFT<C, FFT_SIZE, C, FFT_SIZE> fft(complexFifo, spectrum);
+
+	memcpy(input.getWriteBuffer(NB_WINDOW_SAMPLES), test_signal, sizeof(test_signal));
+
+	zassert_equal(convert.run(), CG_SUCCESS);
+	zassert_equal(hanning.run(), CG_SUCCESS);
+	zassert_equal(toComplex.run(), CG_SUCCESS);
+	zassert_equal(fft.run(), CG_SUCCESS);
+
+	magnitude(spectrum.getReadBuffer(FFT_SIZE), mag);
+}
+
+// Max absolute error relative to the peak of the reference
+static float32_t relative_error(const float32_t *mag, const float32_t *ref, int *peakBin)
+{
+	float32_t peak = 0.0f;
+	float32_t err = 0.0f;
+
+	*peakBin = 0;
+	for (int k = 0; k < NB_MAG; k++) {
+		if (ref[k] > peak) {
+			peak = ref[k];
+			*peakBin = k;
+		}
+		err = fmaxf(err, fabsf(mag[k] - ref[k]));
+	}
+	return err / peak;
+}
+
+static int peak_bin(const float32_t *mag)
+{
+	int bin = 0;
+
+	for (int k = 1; k < NB_MAG; k++) {
+		if (mag[k] > mag[bin]) {
+			bin = k;
+		}
+	}
+	return bin;
+}
+
+static void *spectrogram_f16_setup(void)
+{
+	make_signal();
+	run_chain<float32_t, cf32>(mag_f32);
+	return NULL;
+}
+
+/*
+
+Reference of the f32 chain: the windowed and zero padded samples are
+transformed with a DFT in double.
+
+*/
+ZTEST(spectrogram_f16, test_f32_chain)
+{
+	static double twiddle_re[FFT_SIZE];
+	static double twiddle_im[FFT_SIZE];
+	static double windowed[FFT_SIZE];
+	static float32_t ref[NB_MAG];
+	const int offset = (FFT_SIZE - NB_WINDOW_SAMPLES) >> 1;
+
+	for (int n = 0; n < FFT_SIZE; n++) {
+		twiddle_re[n] = cos(2.0 * M_PI * n / FFT_SIZE);
+		twiddle_im[n] = -sin(2.0 * M_PI * n / FFT_SIZE);
+		windowed[n] = 0.0;
+	}
+	for (int i = 0; i < NB_WINDOW_SAMPLES; i++) {
+		double w = 0.5 * (1.0 - cos(2.0 * M_PI * i / NB_WINDOW_SAMPLES));
+		windowed[offset + i] = w * test_signal[i] / 32768.0;
+	}
+
+	for (int k = 0; k < NB_MAG; k++) {
+		double re = 0.0;
+		double im = 0.0;
+		for (int n = 0; n < FFT_SIZE; n++) {
+			int t = (n * k) % FFT_SIZE;
+			re += windowed[n] * twiddle_re[t];
+			im += windowed[n] * twiddle_im[t];
+		}
+		ref[k] = (float32_t)sqrt(re * re + im * im);
+	}
+
+	int peakBin;
+	float32_t err = relative_error(mag_f32, ref, &peakBin);
+
+	// 1 kHz is bin 64 of a 1024 FFT at 16 kHz
+	zassert_equal(peakBin, 64, "peak of the reference in bin %d", peakBin);
+	zassert_true(err <= F32_TOLERANCE, "f32 error %e of the peak", (double)err);
+}
+
+ZTEST(spectrogram_f16, test_f16_chain)
+{
+#if defined(ARM_FLOAT16_SUPPORTED)
+	static float32_t mag_f16[NB_MAG];
+
+	run_chain<float16_t, cf16>(mag_f16);
+
+	int peakBin;
+	float32_t err = relative_error(mag_f16, mag_f32, &peakBin);
+
+	zassert_equal(peak_bin(mag_f16), peakBin, "f16 peak in bin %d instead of %d",
+		      peak_bin(mag_f16), peakBin);
+	zassert_true(err <= F16_TOLERANCE, "f16 error %e of the peak", (double)err);
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST_SUITE(spectrogram_f16, NULL, spectrogram_f16_setup, NULL, NULL, NULL);
@@ -0,0 +1,227 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(streamapps, CONFIG_STREAMAPPS_LOG_LEVEL);
+
+#include "app_config.hpp"
+#include "stream_platform_config.hpp"
+#include "cg_enums.h"
+#include "StreamNode.hpp"
+#include "EventQueue.hpp"
+#include "GenericNodes.hpp"
+
+#include "stream_runtime_init.hpp"
+#include "stream_runner.hpp"
+
+#include "nodes/ZephyrDebugAudioSource.hpp"
+#include "test_nodes.hpp"
+
+using namespace arm_cmsis_stream;
+
+#define CHECKERROR                                                                                 \
+	if (cgStaticError < 0) {                                                                   \
+		goto errorHandling;                                                                \
+	}
+
+#define NB_GRAPHS 2
+#define BLOCK_SIZE 320
+#define RUN_DURATION_MS 1000
+
+/*
+
+Test graphs: debug audio source -> counting sink
+
+They are written like the generated schedulers so that the dataflow
+loop is controlled by CG_BEFORE_NODE_EXECUTION from app_config.hpp
+(the control event of the runner).
+
+*/
+struct test_graph {
+	FIFO<sq15, BLOCK_SIZE, 1, 0> *fifo;
+	ZephyrDebugAudioSource<sq15, BLOCK_SIZE> *audio;
+	CountingSink<sq15, BLOCK_SIZE> *sink;
+	EventQueue *queue;
+};
+
+static uint8_t fifo_buffers[NB_GRAPHS][BLOCK_SIZE * sizeof(sq15)] __aligned(16);
+static struct test_graph graphs[NB_GRAPHS];
+static stream_execution_context_t contexts[NB_GRAPHS];
+static struct stream_runner runners[NB_GRAPHS];
+
+static const int dataflow_priorities[NB_GRAPHS] = {2, 3};
+static const int event_priorities[NB_GRAPHS] = {5, 6};
+static const char *runner_names[NB_GRAPHS] = {"test0", "test1"};
+
+template <int graph>
+static uint32_t scheduler_test(int *error)
+{
+	int cgStaticError = 0;
+	uint32_t nbSchedule = 0;
+	struct test_graph *g = &graphs[graph];
+
+	while (cgStaticError == 0) {
+		CG_BEFORE_NODE_EXECUTION(0);
+		cgStaticError = g->audio->run();
+		CHECKERROR;
+
+		CG_BEFORE_NODE_EXECUTION(1);
+		cgStaticError = g->sink->run();
+		CHECKERROR;
+
+		nbSchedule++;
+	}
+errorHandling:
+	*error = cgStaticError;
+	return (nbSchedule);
+}
+
+static void reset_fifos_test(int all)
+{
+	(void)all;
+}
+
+static void no_context_switch(const stream_execution_context_t *context)
+{
+	(void)context;
+}
+
+// No identified nodes in the test graphs
+static void *get_test_node(int32_t nodeID)
+{
+	(void)nodeID;
+	return nullptr;
+}
+
+static uint32_t (*const schedulers[NB_GRAPHS])(int *) = {scheduler_test<0>, scheduler_test<1>};
+
+static int init_test_graph(int graph)
+{
+	struct test_graph *g = &graphs[graph];
+
+	g->queue = stream_new_event_queue();
+	if (g->queue == nullptr) {
+		return CG_MEMORY_ALLOCATION_FAILURE;
+	}
+
+	g->fifo = new FIFO<sq15, BLOCK_SIZE, 1, 0>(fifo_buffers[graph]);
+	g->audio = new ZephyrDebugAudioSource<sq15, BLOCK_SIZE>(*g->fifo, g->queue);
+	g->sink = new CountingSink<sq15, BLOCK_SIZE>(*g->fifo, g->queue);
+
+	g->audio->subscribe(0, *g->sink, 0);
+
+	contexts[graph] = {.dataflow_scheduler = schedulers[graph],
+			   .reset_fifos = reset_fifos_test,
+			   .pause_all_nodes = no_context_switch,
+			   .resume_all_nodes = no_context_switch,
+			   .get_node_by_id = get_test_node,
+			   .evtQueue = g->queue,
+			   .nb_identified_nodes = 0,
+			   .scheduler_length = 2};
+
+	runners[graph].context = &contexts[graph];
+	runners[graph].name = runner_names[graph];
+	runners[graph].graph = graph;
+	runners[graph].dataflow_priority = dataflow_priorities[graph];
+	runners[graph].event_priority = event_priorities[graph];
+
+	return CG_SUCCESS;
+}
+
+static void free_test_graph(int graph)
+{
+	struct test_graph *g = &graphs[graph];
+
+	delete g->sink;
+	delete g->audio;
+	delete g->fifo;
+	delete g->queue;
+}
+
+static void *stream_runner_setup(void)
+{
+	zassert_equal(stream_init_memory(), 0, "stream memory not initialized");
+	for (int graph = 0; graph < NB_GRAPHS; graph++) {
+		zassert_equal(init_test_graph(graph), CG_SUCCESS, "graph %d not initialized",
+			      graph);
+	}
+	return NULL;
+}
+
+static void stream_runner_teardown(void *fixture)
+{
+	(void)fixture;
+	for (int graph = 0; graph < NB_GRAPHS; graph++) {
+		free_test_graph(graph);
+	}
+	stream_free_memory();
+}
+
+/*
+
+Both graphs are run at the same time by their runners. The foreground
+graph is changed while they are running and only the foreground graph
+owns the display. The runners are then stopped and joined.
+
+*/
+ZTEST(stream_runner, test_concurrent_graphs)
+{
+	// Not a runner thread: only one graph is running
+	zassert_equal(stream_runner_current_graph(), -1);
+	zassert_true(stream_runner_owns_display());
+
+	stream_runner_set_foreground(0);
+	for (int graph = 0; graph < NB_GRAPHS; graph++) {
+		zassert_equal(stream_runner_start(&runners[graph]), 0, "runner %d not started",
+			      graph);
+	}
+
+	k_msleep(RUN_DURATION_MS);
+
+	atomic_val_t display0 = atomic_get(&graphs[0].sink->displayBlocks);
+	atomic_val_t display1 = atomic_get(&graphs[1].sink->displayBlocks);
+	zassert_true(display0 > 0, "foreground graph did not own the display");
+	zassert_equal(display1, 0, "background graph owned the display");
+
+	stream_runner_set_foreground(1);
+	k_msleep(RUN_DURATION_MS);
+
+	// One block of graph 0 may have been started before the switch
+	zassert_true(atomic_get(&graphs[0].sink->displayBlocks) <= display0 + 1,
+		     "background graph owned the display");
+	zassert_true(atomic_get(&graphs[1].sink->displayBlocks) > 0,
+		     "foreground graph did not own the display");
+
+	for (int graph = 0; graph < NB_GRAPHS; graph++) {
+		stream_runner_stop(&runners[graph]);
+	}
+	for (int graph = 0; graph < NB_GRAPHS; graph++) {
+		stream_runner_join(&runners[graph]);
+	}
+
+	// The debug source sleeps 100 ms per block: ~20 blocks per graph
+	for (int graph = 0; graph < NB_GRAPHS; graph++) {
+		CountingSink<sq15, BLOCK_SIZE> *sink = graphs[graph].sink;
+		atomic_val_t blocks = atomic_get(&sink->blocks);
+
+		zassert_true(blocks >= 10, "graph %d only ran %d blocks", graph, (int)blocks);
+		// The runner may be stopped between the source and the sink
+		atomic_val_t late = atomic_get(&sink->lastFrame) - blocks;
+		zassert_true((late == 0) || (late == 1), "graph %d: source and sink out of sync",
+			     graph);
+		// The events still in the queue when the runner ends are dropped
+		atomic_val_t events = atomic_get(&sink->events);
+		zassert_true((events > 0) && (events <= blocks), "graph %d: %d events for %d blocks",
+			     graph, (int)events, (int)blocks);
+		zassert_equal(sink->dataflowGraph, graph, "graph %d run by another runner",
+			      graph);
+		zassert_equal(sink->eventGraph, graph, "graph %d events run by another runner",
+			      graph);
+	}
+
+	// The runners are stopped: the graphs do not progress anymore
+	atomic_val_t blocks = atomic_get(&graphs[0].sink->blocks);
+	k_msleep(300);
+	zassert_equal(atomic_get(&graphs[0].sink->blocks), blocks);
+}
+
+ZTEST_SUITE(stream_runner, NULL, stream_runner_setup, NULL, NULL, stream_runner_teardown);
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include "cg_enums.h"
+#include "EventQueue.hpp"
+#include "StreamNode.hpp"
+#include "GenericNodes.hpp"
+#include "EventDispatch.hpp"
+
+#include "stream_runner.hpp"
+
+using namespace arm_cmsis_stream;
+
+/*
+
+Sink of the test graphs.
+
+It counts the blocks received from the debug audio source and the
+frame numbers received as events from the source. For each block, an
+asynchronous event is posted to the node itself so that the event
+thread of the graph is also checked.
+
+The graph seen by the dataflow thread and by the event thread is
+recorded, and whether the dataflow thread owned the display.
+
+*/
+template <typename IN, int inputSamples>
+class CountingSink : public GenericSink<IN, inputSamples>
+{
+      public:
+	CountingSink(FIFOBase<IN> &src, EventQueue *queue)
+	    : GenericSink<IN, inputSamples>(src), queue_(queue)
+	{
+	}
+
+	int run() final
+	{
+		IN *input = this->getReadBuffer();
+		(void)input;
+
+		atomic_inc(&blocks);
+		dataflowGraph = stream_runner_current_graph();
+		if (stream_runner_owns_display()) {
+			atomic_inc(&displayBlocks);
+		}
+
+		Event evt(kDo, kNormalPriority);
+		queue_->push(LocalDestination{this, 1}, std::move(evt));
+
+		return (CG_SUCCESS);
+	}
+
+	void processFrame(uint32_t frame)
+	{
+		atomic_set(&lastFrame, (atomic_val_t)frame);
+	}
+
+	void processDo()
+	{
+		atomic_inc(&events);
+		eventGraph = stream_runner_current_graph();
+	}
+
+	void processEvent(int dstPort, Event &&evt) final override
+	{
+		using Dispatch = EventDispatch<
+			EventHandler<0, kValue, uint32_t, &CountingSink::processFrame>,
+			EventHandler<1, kDo, void, &CountingSink::processDo>>;
+
+		Dispatch::dispatch(*this, dstPort, std::move(evt));
+	}
+
+	atomic_t blocks = ATOMIC_INIT(0);
+	atomic_t displayBlocks = ATOMIC_INIT(0);
+	atomic_t events = ATOMIC_INIT(0);
+	atomic_t lastFrame = ATOMIC_INIT(0);
+	volatile int dataflowGraph = -1;
+	volatile int eventGraph = -1;
+
+      protected:
+	EventQueue *queue_;
+};